@@ -107,7 +107,10 @@ typedef struct Input {
     void serialize(Archive & ar, const unsigned int version) {
         ar & BOOST_SERIALIZATION_NVP(threshold);
         ar & BOOST_SERIALIZATION_NVP(max_iterations);
-        ar & BOOST_SERIALIZATION_NVP(coefficients.getData());
+        // the matrix rows are no longer stored as nested vectors, so round-trip them through a copy
+        auto coefficient_rows = coefficients.getData();
+        ar & boost::serialization::make_nvp("coefficients", coefficient_rows);
+        coefficients = MyBLAS::Matrix<MyBLAS::NumericType>(coefficient_rows);
         ar & BOOST_SERIALIZATION_NVP(constants.getData());
     }
 } InLab10Inputs;
@@ -15,6 +15,7 @@
  */
 #include "math/relaxation/ConjugateGradient.h"
 #include "math/relaxation/SOR.h"
+#include "math/factorization/SparseCholesky.h"
 namespace Compute {
 
 static void usingConjugateGradient(InLab11Outputs &outputs, InLab11Inputs &inputs) {
@@ -43,5 +44,34 @@ static void usingJacobiPreconditionedConjugateGradient(InLab11Outputs &outputs,
     std::cout << outputs.solution <<std::endl;
 }
 
+static void usingPipelinedConjugateGradient(InLab11Outputs &outputs, InLab11Inputs &inputs) {
+    const MyBLAS::Matrix<MyBLAS::NumericType> &A = inputs.input.coefficients;
+    const MyBLAS::Vector<MyBLAS::NumericType> &b = inputs.input.constants;
+    const size_t max_iterations = inputs.input.max_iterations;
+    const MyBLAS::NumericType threshold = inputs.input.convergence_threshold;
+    auto profiler = Profiler([&] {
+        outputs.solution = MyRelaxationMethod::applyPipelinedConjugateGradient(A, b, max_iterations, threshold);
+    },100, 0, "Pipelined Conjugate Gradient Method").run();
+    outputs.summary = profiler.getSummary();
+    std::cout << profiler << std::endl;
+    std::cout << outputs.solution <<std::endl;
+}
+
+/**
+ * @brief Solves the circuit system directly with the supernodal sparse Cholesky factorization.
+ * @details The circuit matrix carries no mesh, so the elimination order comes from graph nested dissection of its
+ * sparsity pattern.
+ */
+static void usingSparseCholesky(InLab11Outputs &outputs, InLab11Inputs &inputs) {
+    const MyBLAS::Matrix<MyBLAS::NumericType> &A = inputs.input.coefficients;
+    const MyBLAS::Vector<MyBLAS::NumericType> &b = inputs.input.constants;
+    auto profiler = Profiler([&] {
+        outputs.solution = MyFactorizationMethod::applySparseCholesky(A, b);
+    },100, 0, "Sparse Cholesky (Graph Nested Dissection)").run();
+    outputs.summary = profiler.getSummary();
+    std::cout << profiler << std::endl;
+    std::cout << outputs.solution <<std::endl;
+}
+
 } // namespace Compute
 #endif // NE591_008_INLAB11_COMPUTE_H
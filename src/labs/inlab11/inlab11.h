@@ -126,6 +126,16 @@ class InLab11 : public Project<InLab11Inputs, Parser, InLab11Outputs> {
         cgResults.toJSON(results["outputs"]["CG"]);
         Parser::printLine();
 
+        InLab11Outputs pipelinedResults;
+        Compute::usingPipelinedConjugateGradient(pipelinedResults, inputs);
+        pipelinedResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::METHOD_PIPELINED_CONJUGATE_GRADIENT)]);
+        Parser::printLine();
+
+        InLab11Outputs sparseCholeskyResults;
+        Compute::usingSparseCholesky(sparseCholeskyResults, inputs);
+        sparseCholeskyResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::METHOD_SPARSE_CHOLESKY)]);
+        Parser::printLine();
+
         inputs.toJSON(results["inputs"]);
         writeJSON(values["output-json"].as<std::string>(), results);
     }
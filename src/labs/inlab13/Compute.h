@@ -16,6 +16,7 @@
 #include "math/blas/vector/MatrixVectorExpression.h"
 #include "math/factorization/LU.h"
 #include "math/factorization/LUP.h"
+#include "math/relaxation/Anderson.h"
 #include "math/relaxation/SOR.h"
 #include "math/relaxation/SORPJ.h"
 #include "math/relaxation/SSOR.h"
@@ -128,9 +129,11 @@ bool has_converged_residual(const std::vector<std::vector<MyBLAS::NumericType>>&
  * @param beta Coefficient for the nonlinearity in the removal term.
  * @param max_iterations Maximum number of iterations to perform.
  * @param tolerance Convergence tolerance based on the infinity norm of the difference between iterations.
+ * @param anderson_depth Number of previous sweeps mixed into each update by Anderson acceleration. With zero, each
+ * update is the plain Picard sweep.
  * @return The final scalar flux distribution phi.
  */
-MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n, MyBLAS::NumericType L, MyBLAS::NumericType rho_0, MyBLAS::NumericType beta, size_t max_iterations, MyBLAS::NumericType tolerance) {
+MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n, MyBLAS::NumericType L, MyBLAS::NumericType rho_0, MyBLAS::NumericType beta, size_t max_iterations, MyBLAS::NumericType tolerance, const size_t anderson_depth = 0) {
 
     // Calculate the mesh spacing
     MyBLAS::NumericType h = L / (static_cast<MyBLAS::NumericType>(n) + 1);
@@ -139,32 +142,46 @@ MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n,
     std::vector<std::vector<MyBLAS::NumericType>> phi(n + 2, std::vector<MyBLAS::NumericType>(n + 2, 0.0));
     std::vector<std::vector<MyBLAS::NumericType>> phi_new(n + 2, std::vector<MyBLAS::NumericType>(n + 2, 0.0));
 
+    // The interior nodes, row by row, are the iterate that Anderson acceleration mixes
+    MyBLAS::Vector<MyBLAS::NumericType> x(n * n, 0);
+    MyBLAS::Vector<MyBLAS::NumericType> Gx(n * n, 0);
+    MyRelaxationMethod::AndersonAccelerator<MyBLAS::NumericType> anderson(n * n, anderson_depth);
+
     // Perform Fixed Point Iterations
     size_t iteration;
+    MyBLAS::NumericType residual = tolerance;
     for (iteration = 0; iteration < max_iterations; iteration++) {
         // Update phi values for the interior points
         for (size_t i = 1; i <= n; ++i) {
             for (size_t j = 1; j <= n; ++j) {
                 phi_new[i][j] = compute_phi_new(i, j, n, h, rho_0, beta, phi);
+                Gx[(i - 1) * n + (j - 1)] = phi_new[i][j];
             }
         }
 
-        // Check for convergence
+        // Check for convergence, against the tolerance rather than the last residual it is overwritten with
+        residual = tolerance;
 //        if (has_converged(phi, phi_new, tolerance)) {
-        if (has_converged_residual(phi_new, n, h, rho_0, beta, tolerance)) {
+        if (has_converged_residual(phi_new, n, h, rho_0, beta, residual)) {
             //std::cout << "Convergence achieved after " << iteration + 1 << " iterations." << std::endl;
+            phi = phi_new;
             break;
         }
 
-        // Update phi for the next iteration
-        phi = phi_new;
+        // Update phi for the next iteration, mixing in the previous sweeps
+        anderson.mix(x, Gx, x);
+        for (size_t i = 1; i <= n; ++i) {
+            for (size_t j = 1; j <= n; ++j) {
+                phi[i][j] = x[(i - 1) * n + (j - 1)];
+            }
+        }
     }
 
     MyBLAS::Solver::Solution<MyBLAS::NumericType> results(n+2);
-    results.phi.getData() = phi;
+    results.phi = MyBLAS::Matrix<MyBLAS::NumericType>(phi);
     results.converged = (iteration < max_iterations);
     results.iterations = iteration + 1;
-    results.iterative_error = tolerance;
+    results.iterative_error = residual;
     return results;
 }
 
@@ -193,7 +210,7 @@ MyBLAS::NumericType compute_phi_new(size_t i, size_t j, size_t n, MyBLAS::Numeri
     // Apply the discretized equation to calculate the new flux value
 //    MyBLAS::NumericType phi_new_ij2 = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] - h2) / (2.0 * h2 + rho * h2);
     // Apply the discretized equation to calculate the new flux value
-    MyBLAS::NumericType phi_new_ij = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] + h2) / (2.0 * h2 + rho * h2); // Corrected the source term sign
+    MyBLAS::NumericType phi_new_ij = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] + h2) / (4.0 + rho * h2); // Corrected the source term sign, and the diagonal of the 5-point stencil
     return phi_new_ij;
 }
 
@@ -230,7 +247,7 @@ void usingFixedPoint(SolverOutputs &outputs, SolverInputs &inputs) {
 
     auto profiler = Profiler([&]() {
         // Solve the nonlinear neutron diffusion equation
-        outputs.solution = solve_diffusion_equation(n, L, rho_0, beta, max_iterations, tolerance);
+        outputs.solution = solve_diffusion_equation(n, L, rho_0, beta, max_iterations, tolerance, inputs.andersonDepth);
     }, 2, 0, "Fixed Point Method").run();
 
     outputs.summary = profiler.getSummary();
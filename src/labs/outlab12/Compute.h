@@ -8,6 +8,7 @@
 #ifndef NE591_008_OUTLAB12_COMPUTE_H
 #define NE591_008_OUTLAB12_COMPUTE_H
 
+#include "math/relaxation/KrylovEigenSolvers.h"
 #include "math/relaxation/PowerIteration.h"
 
 /**
@@ -50,6 +51,36 @@ static void usingInversePowerIteration(OutLab12Outputs &outputs, OutLab12Inputs
 }
 
 
+static void usingLanczos(OutLab12Outputs &outputs, OutLab12Inputs &inputs) {
+    if (!MyBLAS::isSymmetricMatrix(inputs.input.coefficients)) {
+        std::cerr << "Warning: Lanczos assumes that A is symmetric, use the Arnoldi method instead.\n";
+    }
+    auto profiler = Profiler([&] {
+                        outputs.eigenpairs = MyRelaxationMethod::applyLanczos(inputs.input.coefficients, inputs.eigenpairs, inputs.input.max_iterations, inputs.input.convergence_threshold);
+    }, 100, 0, "Implicitly Restarted Lanczos Method").run();
+    if (!outputs.eigenpairs.empty()) {
+        outputs.solution = outputs.eigenpairs.front();
+    }
+    outputs.summary = profiler.getSummary();
+    std::cout << profiler << std::endl;
+    for (const auto &eigenpair : outputs.eigenpairs) {
+        std::cout << eigenpair << std::endl;
+    }
+}
+
+static void usingArnoldi(OutLab12Outputs &outputs, OutLab12Inputs &inputs) {
+    auto profiler = Profiler([&] {
+                        outputs.eigenpairs = MyRelaxationMethod::applyArnoldi(inputs.input.coefficients, inputs.eigenpairs, inputs.input.max_iterations, inputs.input.convergence_threshold);
+    }, 100, 0, "Implicitly Restarted Arnoldi Method").run();
+    if (!outputs.eigenpairs.empty()) {
+        outputs.solution = outputs.eigenpairs.front();
+    }
+    outputs.summary = profiler.getSummary();
+    std::cout << profiler << std::endl;
+    for (const auto &eigenpair : outputs.eigenpairs) {
+        std::cout << eigenpair << std::endl;
+    }
+}
 
 } // namespace Compute
 #endif // NE591_008_OUTLAB12_COMPUTE_H
@@ -33,6 +33,7 @@ typedef struct Input {
     std::set<MyBLAS::Solver::Type> methods = {};
     MyBLAS::Solver::Parameters<long double> input;
     MyBLAS::Vector<long double> known_solution;
+    size_t eigenpairs = 1;
 
     /**
      * @brief Converts the input parameters to a JSON object.
@@ -46,6 +47,7 @@ typedef struct Input {
         jsonMap["coefficients"] = input.coefficients.getData();
         jsonMap["constants"] = input.constants.getData();
         jsonMap["known-solution"] = known_solution.getData();
+        jsonMap["eigenpairs"] = eigenpairs;
         jsonMap["methods"] = [this]() -> std::vector<std::string> {
             std::vector<std::string> result;
             std::transform(methods.begin(), methods.end(), std::back_inserter(result),
@@ -66,6 +68,10 @@ typedef struct Output {
      */
 
     MyBLAS::Solver::Solution<long double> solution;
+    /**
+     * @brief The eigenpairs found by a Krylov eigensolver, in the order of their eigenvalues, and empty otherwise
+     */
+    std::vector<MyBLAS::Solver::Solution<long double>> eigenpairs;
     /**
      * @brief The summary of the benchmark runs
      * This structure holds the summary statistics of computation runtime, including the mean, standard deviation, etc.
@@ -77,7 +83,12 @@ typedef struct Output {
      * @param jsonMap The JSON object to which the output parameters are added.
      */
     void toJSON(nlohmann::json &jsonMap) const {
-        solution.toJSON(jsonMap["solution"]);
+        if (eigenpairs.empty()) {
+            solution.toJSON(jsonMap["solution"]);
+        }
+        for (size_t i = 0; i < eigenpairs.size(); i++) {
+            eigenpairs[i].toJSON(jsonMap["solutions"][i]);
+        }
         //jsonMap["solution"] = solution;
         summary.toJSON(jsonMap["benchmark"]);
     }
@@ -58,7 +58,10 @@ class Parser : public CommandLine<OutLab12Inputs> {
                 "lambda", boost::program_options::value<long double>(), "= guess for eigenvalue")(
                 "use-direct", "= use the direct PI method")(
                 "use-rayleigh", "= use the Rayleigh Quotient PI method")
-                ("use-inverse", "= use the inverse PI method");
+                ("use-inverse", "= use the inverse PI method")
+                ("use-lanczos", "= use the implicitly restarted Lanczos method")
+                ("use-arnoldi", "= use the implicitly restarted Arnoldi method")(
+                "eigenpairs,e", boost::program_options::value<size_t>()->default_value(1), "= eigenpairs for Lanczos/Arnoldi [n ∈ ℕ]");
 
         boost::program_options::options_description fileOptions("File I/O Options");
         fileOptions.add_options()(
@@ -89,6 +92,9 @@ class Parser : public CommandLine<OutLab12Inputs> {
         std::cout << "\tUse inverse PI method     : " << (inverse ? "Yes" : "No") << "\n";
         std::cout << "\tUse direct PI method      : " << (direct ? "Yes" : "No") << "\n";
         std::cout << "\tUse Rayleigh PI method    : " << (rayleigh ? "Yes" : "No") << "\n";
+        std::cout << "\tUse Lanczos method        : " << (vm.count("use-lanczos") ? "Yes" : "No") << "\n";
+        std::cout << "\tUse Arnoldi method        : " << (vm.count("use-arnoldi") ? "Yes" : "No") << "\n";
+        std::cout << "\tEigenpairs (Krylov),     e: " << vm["eigenpairs"].as<size_t>() << "\n";
         std::cout << "\tGenerate A               g: " << (gen ? "Yes" : "No") << "\n";
         std::cout << "\tInput JSON (for A),      i: " << (gen ? "[IGNORED] " : " ") << inputJson << "\n";
         std::cout << "\tOutput JSON (for x),     o: " << vm["output-json"].as<std::string>() << "\n";
@@ -187,6 +193,8 @@ class Parser : public CommandLine<OutLab12Inputs> {
 
         promptAndSetFlags("use-direct", "the direct PI method", map);
         promptAndSetFlags("use-rayleigh", "the Rayleigh Quotient PI method", map);
+        promptAndSetFlags("use-lanczos", "the implicitly restarted Lanczos method", map);
+        promptAndSetFlags("use-arnoldi", "the implicitly restarted Arnoldi method", map);
     }
 
     /**
@@ -277,6 +285,20 @@ class Parser : public CommandLine<OutLab12Inputs> {
             input.methods.insert(MyRelaxationMethod::Type::METHOD_RAYLEIGH_QUOTIENT_POWER_ITERATION);
         }
 
+        if (values["use-lanczos"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_LANCZOS);
+        }
+
+        if (values["use-arnoldi"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_ARNOLDI);
+        }
+
+        input.eigenpairs = values["eigenpairs"].as<size_t>();
+        if (input.eigenpairs == 0) {
+            std::cerr << "Warning: At least one eigenpair is needed, defaulting to 1\n";
+            input.eigenpairs = 1;
+        }
+
         if (!values.count("quiet")) {
             const auto precision = getCurrentPrecision();
             printLine();
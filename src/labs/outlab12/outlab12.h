@@ -131,11 +131,25 @@ class OutLab12 : public Project<OutLab12Inputs, Parser, OutLab12Outputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_INVERSE_POWER_ITERATION)) {
             OutLab12Outputs iPowerIterationResults;
-            Compute::usingRayleighQuotientPowerIteration(iPowerIterationResults, inputs);
+            Compute::usingInversePowerIteration(iPowerIterationResults, inputs);
             iPowerIterationResults.toJSON(results["outputs"]["inverse-power-iteration"]);
             Parser::printLine();
         }
 
+        if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_LANCZOS)) {
+            OutLab12Outputs lanczosResults;
+            Compute::usingLanczos(lanczosResults, inputs);
+            lanczosResults.toJSON(results["outputs"]["lanczos"]);
+            Parser::printLine();
+        }
+
+        if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_ARNOLDI)) {
+            OutLab12Outputs arnoldiResults;
+            Compute::usingArnoldi(arnoldiResults, inputs);
+            arnoldiResults.toJSON(results["outputs"]["arnoldi"]);
+            Parser::printLine();
+        }
+
 
         inputs.toJSON(results["inputs"]);
         writeJSON(values["output-json"].as<std::string>(), results);
@@ -16,6 +16,8 @@
 #include "math/blas/vector/MatrixVectorExpression.h"
 #include "math/factorization/LU.h"
 #include "math/factorization/LUP.h"
+#include "math/relaxation/NewtonKrylov.h"
+#include "math/relaxation/Anderson.h"
 #include "math/relaxation/SOR.h"
 #include "math/relaxation/SORPJ.h"
 #include "math/relaxation/SSOR.h"
@@ -128,9 +130,11 @@ bool has_converged_residual(const std::vector<std::vector<MyBLAS::NumericType>>&
  * @param beta Coefficient for the nonlinearity in the removal term.
  * @param max_iterations Maximum number of iterations to perform.
  * @param tolerance Convergence tolerance based on the infinity norm of the difference between iterations.
+ * @param anderson_depth Number of previous sweeps mixed into each update by Anderson acceleration. With zero, each
+ * update is the plain Picard sweep.
  * @return The final scalar flux distribution phi.
  */
-MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n, MyBLAS::NumericType L, MyBLAS::NumericType rho_0, MyBLAS::NumericType beta, size_t max_iterations, MyBLAS::NumericType tolerance) {
+MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n, MyBLAS::NumericType L, MyBLAS::NumericType rho_0, MyBLAS::NumericType beta, size_t max_iterations, MyBLAS::NumericType tolerance, const size_t anderson_depth = 0) {
 
     // Calculate the mesh spacing
     MyBLAS::NumericType h = L / (static_cast<MyBLAS::NumericType>(n) + 1);
@@ -139,32 +143,46 @@ MyBLAS::Solver::Solution<MyBLAS::NumericType> solve_diffusion_equation(size_t n,
     std::vector<std::vector<MyBLAS::NumericType>> phi(n + 2, std::vector<MyBLAS::NumericType>(n + 2, 0.0));
     std::vector<std::vector<MyBLAS::NumericType>> phi_new(n + 2, std::vector<MyBLAS::NumericType>(n + 2, 0.0));
 
+    // The interior nodes, row by row, are the iterate that Anderson acceleration mixes
+    MyBLAS::Vector<MyBLAS::NumericType> x(n * n, 0);
+    MyBLAS::Vector<MyBLAS::NumericType> Gx(n * n, 0);
+    MyRelaxationMethod::AndersonAccelerator<MyBLAS::NumericType> anderson(n * n, anderson_depth);
+
     // Perform Fixed Point Iterations
     size_t iteration;
+    MyBLAS::NumericType residual = tolerance;
     for (iteration = 0; iteration < max_iterations; iteration++) {
         // Update phi values for the interior points
         for (size_t i = 1; i <= n; ++i) {
             for (size_t j = 1; j <= n; ++j) {
                 phi_new[i][j] = compute_phi_new(i, j, n, h, rho_0, beta, phi);
+                Gx[(i - 1) * n + (j - 1)] = phi_new[i][j];
             }
         }
 
-        // Check for convergence
+        // Check for convergence, against the tolerance rather than the last residual it is overwritten with
+        residual = tolerance;
 //        if (has_converged(phi, phi_new, tolerance)) {
-        if (has_converged_residual(phi_new, n, h, rho_0, beta, tolerance)) {
+        if (has_converged_residual(phi_new, n, h, rho_0, beta, residual)) {
             //std::cout << "Convergence achieved after " << iteration + 1 << " iterations." << std::endl;
+            phi = phi_new;
             break;
         }
 
-        // Update phi for the next iteration
-        phi = phi_new;
+        // Update phi for the next iteration, mixing in the previous sweeps
+        anderson.mix(x, Gx, x);
+        for (size_t i = 1; i <= n; ++i) {
+            for (size_t j = 1; j <= n; ++j) {
+                phi[i][j] = x[(i - 1) * n + (j - 1)];
+            }
+        }
     }
 
     MyBLAS::Solver::Solution<MyBLAS::NumericType> results(n+2);
-    results.phi.getData() = phi;
+    results.phi = MyBLAS::Matrix<MyBLAS::NumericType>(phi);
     results.converged = (iteration < max_iterations);
     results.iterations = iteration + 1;
-    results.iterative_error = tolerance;
+    results.iterative_error = residual;
     return results;
 }
 
@@ -193,7 +211,7 @@ MyBLAS::NumericType compute_phi_new(size_t i, size_t j, size_t n, MyBLAS::Numeri
     // Apply the discretized equation to calculate the new flux value
 //    MyBLAS::NumericType phi_new_ij2 = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] - h2) / (2.0 * h2 + rho * h2);
     // Apply the discretized equation to calculate the new flux value
-    MyBLAS::NumericType phi_new_ij = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] + h2) / (2.0 * h2 + rho * h2); // Corrected the source term sign
+    MyBLAS::NumericType phi_new_ij = (phi[i+1][j] + phi[i-1][j] + phi[i][j+1] + phi[i][j-1] + h2) / (4.0 + rho * h2); // Corrected the source term sign, and the diagonal of the 5-point stencil
     return phi_new_ij;
 }
 
@@ -230,7 +248,7 @@ void usingFixedPoint(SolverOutputs &outputs, SolverInputs &inputs) {
 
     auto profiler = Profiler([&]() {
         // Solve the nonlinear neutron diffusion equation
-        outputs.solution = solve_diffusion_equation(n, L, rho_0, beta, max_iterations, tolerance);
+        outputs.solution = solve_diffusion_equation(n, L, rho_0, beta, max_iterations, tolerance, inputs.andersonDepth);
     }, 2, 0, "Fixed Point Method").run();
 
     outputs.summary = profiler.getSummary();
@@ -251,6 +269,48 @@ void usingFixedPoint(SolverOutputs &outputs, SolverInputs &inputs) {
     std::cout<<"Average Flux: "<<sum/std::pow(n, 2)<<std::endl;
 }
 
+/**
+ * @brief Evaluates the residual of the discretized nonlinear diffusion equation, at every interior node.
+ *
+ * F(i, j) = (4 phi(i, j) - phi(i+1, j) - phi(i-1, j) - phi(i, j+1) - phi(i, j-1)) / h^2 + rho(phi(i, j)) phi(i, j) - 1,
+ * with rho(phi) = rho_0 + beta / sqrt(phi + 1e-6) for positive phi, as in has_converged_residual, and phi = 0 on the
+ * boundary. The nodes are stored row by row, at (i - 1) * n + (j - 1).
+ *
+ * @param phi Scalar flux at the n * n interior nodes.
+ * @param F The residual at the interior nodes, of the same size as phi.
+ * @param n Number of mesh points in each direction, excluding the boundary points.
+ * @param h Mesh spacing.
+ * @param rho_0 Base removal term.
+ * @param beta Coefficient for the nonlinearity in the removal term.
+ */
+void nonlinear_diffusion_residual(const MyBLAS::Vector<MyBLAS::NumericType> &phi, MyBLAS::Vector<MyBLAS::NumericType> &F, const size_t n, const MyBLAS::NumericType h, const MyBLAS::NumericType rho_0, const MyBLAS::NumericType beta) {
+    const MyBLAS::NumericType h2 = h * h;
+    #pragma omp parallel for default(none) shared(phi, F, n, h2, rho_0, beta)
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const size_t idx = i * n + j;
+            const MyBLAS::NumericType phi_ij = phi[idx];
+            MyBLAS::NumericType rho = rho_0;
+            if (phi_ij > 0) {
+                rho += beta / std::sqrt(phi_ij + static_cast<MyBLAS::NumericType>(1e-6));
+            }
+            MyBLAS::NumericType neighbors = 0;
+            neighbors += (i > 0) ? phi[idx - n] : 0;
+            neighbors += (i + 1 < n) ? phi[idx + n] : 0;
+            neighbors += (j > 0) ? phi[idx - 1] : 0;
+            neighbors += (j + 1 < n) ? phi[idx + 1] : 0;
+            F[idx] = (4 * phi_ij - neighbors) / h2 + rho * phi_ij - 1;
+        }
+    }
+}
+
+/**
+ * @brief Solves the nonlinear neutron diffusion equation using Jacobian-free Newton-Krylov.
+ * @details Newton converges on the same residual as the fixed point method, starting from the same zero guess, in a
+ * handful of outer iterations. The inner GMRES solves are matrix-free, and cost one residual evaluation per iteration.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the problem parameters.
+ */
 void usingNewtons(SolverOutputs &outputs, SolverInputs &inputs) {
 
     // Define problem parameters
@@ -258,13 +318,32 @@ void usingNewtons(SolverOutputs &outputs, SolverInputs &inputs) {
     auto L = inputs.L; // Side length of the square problem domain
     auto rho_0 = inputs.rho; // Base removal term
     auto beta = inputs.beta; // Coefficient for the nonlinearity in the removal term
-    auto max_iterations = inputs.solverParams.max_iterations; // Maximum number of iterations to perform
+    auto max_iterations = inputs.solverParams.max_iterations; // Maximum number of Newton and GMRES iterations
     auto tolerance = inputs.solverParams.convergence_threshold; // Convergence tolerance
+    const size_t restart = 50; // GMRES restart length
 
+    const MyBLAS::NumericType h = L / (static_cast<MyBLAS::NumericType>(n) + 1);
+    const auto residual = [n, h, rho_0, beta](const MyBLAS::Vector<MyBLAS::NumericType> &phi, MyBLAS::Vector<MyBLAS::NumericType> &F) {
+        nonlinear_diffusion_residual(phi, F, n, h, rho_0, beta);
+    };
+    const MyBLAS::Vector<MyBLAS::NumericType> initial(n * n, 0);
+
+    MyBLAS::Solver::Solution<MyBLAS::NumericType> solution;
     auto profiler = Profiler([&]() {
                         // Solve the nonlinear neutron diffusion equation
-                        outputs.solution = solve_diffusion_equation(n, L, rho_0, beta, max_iterations, tolerance);
-                    }, 2, 0, "Netwon's Method").run();
+                        solution = MyRelaxationMethod::applyNewtonKrylov(residual, initial, max_iterations, tolerance, max_iterations, restart);
+                    }, 2, 0, "Newton's Method").run();
+
+    // the flux on the mesh, with the zero boundary
+    outputs.solution = solution;
+    outputs.solution.phi = MyBLAS::Matrix<MyBLAS::NumericType>(n + 2, n + 2, 0);
+    for (size_t i = 1; i <= n; ++i) {
+        for (size_t j = 1; j <= n; ++j) {
+            outputs.solution.phi[i][j] = solution.x[(i - 1) * n + (j - 1)];
+        }
+    }
+    outputs.residual = MyBLAS::Vector<MyBLAS::NumericType>(n * n, 0);
+    residual(solution.x, outputs.residual);
 
     outputs.summary = profiler.getSummary();
     std::cout << profiler << std::endl;
@@ -276,7 +355,7 @@ void usingNewtons(SolverOutputs &outputs, SolverInputs &inputs) {
     for (size_t i = 1; i <= n; ++i) {
         for (size_t j = 1; j <= n; ++j) {
             sum += outputs.solution.phi[i][j];
-            std::cout << std::fixed << std::setprecision(6) << outputs.solution.phi[i][j];
+            std::cout << std::fixed << std::setprecision(6) << outputs.solution.phi[i][j] << " ";
         }
         std::cout << std::endl;
     }
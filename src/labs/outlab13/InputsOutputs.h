@@ -36,6 +36,7 @@ typedef struct Input {
     size_t n;
 
     MyBLAS::Solver::Parameters<MyBLAS::NumericType> solverParams;
+    size_t andersonDepth = 0;
 
     MyBLAS::Matrix<MyBLAS::NumericType> sources = MyBLAS::Matrix<MyBLAS::NumericType>();
 
@@ -61,6 +62,7 @@ typedef struct Input {
         jsonMap["mesh"]["n"] = diffusionParams.getN();
         jsonMap["mesh"]["𝛿"] = diffusionParams.getDelta();
         jsonMap["mesh"]["𝛾"] = diffusionParams.getGamma();
+        jsonMap["anderson-depth"] = andersonDepth;
         jsonMap["methods"] = [this]() -> std::vector<std::string> {
             std::vector<std::string> result;
             std::transform(methods.begin(), methods.end(), std::back_inserter(result),
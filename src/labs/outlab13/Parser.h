@@ -44,6 +44,7 @@ class Parser : public CommandLine<SolverInputs> {
         methods.add_options()
             ("use-fixed-point", "= Use fixed point iteration")
             ("use-newton","= Use newton's method")(
+            "anderson-depth", boost::program_options::value<size_t>()->default_value(5), "= Anderson acceleration depth for fixed point [0=off]")(
             "threshold,t", boost::program_options::value<MyBLAS::NumericType>(),"= convergence threshold [𝜀 > 0]")(
             "max-iterations,k", boost::program_options::value<MyBLAS::NumericType>(), "= maximum iterations [n ∈ ℕ]");
         values.add(methods);
@@ -74,6 +75,7 @@ class Parser : public CommandLine<SolverInputs> {
         std::cout << "\tMax iterations,                         k: " << static_cast<size_t>(vm["max-iterations"].as<MyBLAS::NumericType>())<< "\n";
         std::cout << "\tUse Fixed Point Iterations               : " << (vm["use-fixed-point"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Newton's method                      : " << (vm["use-newton"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tAnderson acceleration depth,            m: " << vm["anderson-depth"].as<size_t>() << "\n";
         std::cout << "\t----\n";
         std::cout << "\tLength,                                 L: " << vm["L"].as<MyBLAS::NumericType>() << "\n";
         std::cout << "\trho,                                  rho: " << vm["rho"].as<MyBLAS::NumericType>() << "\n";
@@ -236,6 +238,7 @@ class Parser : public CommandLine<SolverInputs> {
 //
         input.solverParams.convergence_threshold = map["threshold"].as<MyBLAS::NumericType>();
         input.solverParams.max_iterations = static_cast<size_t>(map["max-iterations"].as<MyBLAS::NumericType>());
+        input.andersonDepth = map["anderson-depth"].as<size_t>();
         input.solverParams.n = input.diffusionParams.getM() * input.diffusionParams.getN();
 
         if (map["use-fixed-point"].as<bool>()) {
@@ -14,6 +14,7 @@
 #include "FileParser.h"
 #include "math/blas/matrix/Matrix.h"
 #include "math/blas/vector/MatrixVectorExpression.h"
+#include "math/factorization/BandedFactorization.h"
 #include "math/factorization/LU.h"
 #include "math/factorization/LUP.h"
 #include "math/relaxation/SORPJ.h"
@@ -77,11 +78,24 @@ static MatrixType &fill_fluxes(SolverOutputs &outputs) {
     return outputs.fluxes;
 }
 
+/**
+ * @brief Builds the diffusion operator in the working precision T.
+ * @tparam T The working precision of the solve.
+ * @param inputs The solver inputs containing the diffusion parameters.
+ * @return The matrix-free diffusion stencil in T.
+ */
+template <typename T>
+MyPhysics::Diffusion::Matrix<T> diffusion_matrix(const SolverInputs &inputs) {
+    return MyPhysics::Diffusion::Matrix<T>(MyPhysics::Diffusion::Params<T>(inputs.diffusionParams));
+}
+
 /**
  * @brief Solves a linear system using LUP decomposition.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto A = inputs.diffusionCoefficients;
@@ -92,14 +106,17 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
         return;
     }
 
-    auto inMemoryA = MyBLAS::Matrix<MyBLAS::NumericType>(inputs.diffusionCoefficients);
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
 
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = outputs.solution = MyBLAS::LUP::applyLUP(inMemoryA, b);
+        solution = MyFactorizationMethod::applyBandedLUP(AT, bT);
     }, inputs.numRuns, inputs.timeout, "LUP");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -116,27 +133,34 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Point Jacobi method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto A = inputs.diffusionCoefficients;
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting Point jacobi calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold);
+        solution = MyRelaxationMethod::applyPointJacobi(AT, bT, max_iterations, threshold);
     }, inputs.numRuns, inputs.timeout, "Point Jacobi");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -152,26 +176,33 @@ void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Gauss-Seidel method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting Gauss Seidel calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySOR(A, b, max_iterations, threshold);
+        solution = MyRelaxationMethod::applySOR(AT, bT, max_iterations, threshold);
     }, inputs.numRuns, inputs.timeout, "Gauss Seidel");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -187,27 +218,34 @@ void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Successive Over-Relaxation (SOR) method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting SOR calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySOR(A, b, max_iterations, threshold, omega);
+        solution = MyRelaxationMethod::applySOR(AT, bT, max_iterations, threshold, omega);
     }, inputs.numRuns, inputs.timeout, "SOR"); // Run the block 10 times
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -223,26 +261,33 @@ void usingSOR(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Jacobi SOR method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingJacobiSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting SOR point jacobi calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold, 2.0f - omega);
+        solution = MyRelaxationMethod::applyPointJacobi(AT, bT, max_iterations, threshold, 2.0f - omega);
     }, inputs.numRuns, inputs.timeout, "SORJ");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -258,27 +303,34 @@ void usingJacobiSOR(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Symmetric SOR method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingSymmetricSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting symmetric SOR calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySSOR(A, b, max_iterations, threshold, omega);
+        solution = MyRelaxationMethod::applySSOR(AT, bT, max_iterations, threshold, omega);
     }, inputs.numRuns, inputs.timeout, "SSOR");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -107,6 +107,9 @@ typedef struct Output {
         // jsonMap["l2-error"] = getSolutionError();
 
         summary.toJSON(jsonMap["wall-time-ns"]);
+        if (!summary.counters.empty()) {
+            summary.countersToJSON(jsonMap["counters"]);
+        }
     }
 } SolverOutputs;
 
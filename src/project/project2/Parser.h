@@ -18,7 +18,9 @@
 class Parser : public CommandLine<SolverInputs> {
 
   public:
-    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {}
+    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {
+        dispatchesWorkingPrecision = true;
+    }
 
     explicit Parser() = default;
 
@@ -123,10 +123,13 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         nlohmann::json results;
         inputs.toJSON(results["inputs"]);
+        results["inputs"]["working-precision"] = MyBLAS::PrecisionKey(terminal.getWorkingPrecision());
 
         if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_LUP)) {
             SolverOutputs runResults(inputs);
-            Compute::usingLUP(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingLUP<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_LUP)]);
             Parser::printLine();
             std::cout << "LUP Factorization Results" << std::endl;
@@ -136,7 +139,9 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)) {
             SolverOutputs runResults(inputs);
-            Compute::usingPointJacobi(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingPointJacobi<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)]);
             Parser::printLine();
             std::cout << "Point Jacobi Method Results" << std::endl;
@@ -146,7 +151,9 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SORPJ)) {
             SolverOutputs runResults(inputs);
-            Compute::usingJacobiSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingJacobiSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SORPJ)]);
             Parser::printLine();
             std::cout << "SOR Point Jacobi Method Results" << std::endl;
@@ -156,7 +163,9 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)) {
             SolverOutputs runResults(inputs);
-            Compute::usingGaussSeidel(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingGaussSeidel<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(
                 results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)]);
             Parser::printLine();
@@ -167,7 +176,9 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SOR)) {
             SolverOutputs runResults(inputs);
-            Compute::usingSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SOR)]);
             Parser::printLine();
             std::cout << "SOR Method Results" << std::endl;
@@ -177,7 +188,9 @@ class Project2 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SSOR)) {
             SolverOutputs runResults(inputs);
-            Compute::usingSymmetricSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSymmetricSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SSOR)]);
             Parser::printLine();
             std::cout << "Symmetric SOR Method Results" << std::endl;
@@ -13,12 +13,16 @@
 
 #include "FileParser.h"
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/solver/IterativeRefinement.h"
 #include "math/blas/vector/MatrixVectorExpression.h"
+#include "math/factorization/BandedFactorization.h"
 #include "math/factorization/LU.h"
 #include "math/factorization/LUP.h"
+#include "math/factorization/SparseCholesky.h"
 #include "math/relaxation/SOR.h"
 #include "math/relaxation/SORPJ.h"
 #include "math/relaxation/SSOR.h"
+#include "physics/diffusion/SineTransformSolver.h"
 
 /**
  * @namespace Compute
@@ -77,11 +81,26 @@ static MatrixType &fill_fluxes(SolverOutputs &outputs) {
     return outputs.fluxes;
 }
 
+/**
+ * @brief Builds the diffusion operator in the working precision T.
+ * @tparam T The working precision of the solve.
+ * @param inputs The solver inputs containing the diffusion parameters.
+ * @return The matrix-free diffusion stencil in T.
+ */
+template <typename T>
+MyPhysics::Diffusion::Matrix<T> diffusion_matrix(const SolverInputs &inputs) {
+    return MyPhysics::Diffusion::Matrix<T>(MyPhysics::Diffusion::Params<T>(inputs.diffusionParams));
+}
+
 /**
  * @brief Solves a linear system using LUP decomposition.
+ * @details With a mixed precision type in the inputs, the factors are computed in that type, and the solution is
+ * refined to the working precision with at most max-iterations refinement steps.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto A = inputs.diffusionCoefficients;
@@ -92,20 +111,34 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
         return;
     }
 
-    auto inMemoryA = MyBLAS::Matrix<MyBLAS::NumericType>(inputs.diffusionCoefficients);
+    const size_t max_refinements = inputs.solverParams.getMaxIterations();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
 
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyBLAS::LUP::applyLUP(inMemoryA, b);
-    }, inputs.numRuns, inputs.timeout, "LUP");
+        if (inputs.mixedPrecision == "float") {
+            solution = MyBLAS::Solver::applyMixedPrecisionLUP<float>(AT, bT, max_refinements, threshold);
+        } else if (inputs.mixedPrecision == "double") {
+            solution = MyBLAS::Solver::applyMixedPrecisionLUP<double>(AT, bT, max_refinements, threshold);
+        } else {
+            solution = MyFactorizationMethod::applyBandedLUP(AT, bT);
+        }
+    }, inputs.numRuns, inputs.timeout, inputs.mixedPrecision.empty() ? "LUP" : "Mixed Precision LUP");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
 
     std::cout<<std::endl<<profiler;
 
     // post-process
     {
-        outputs.solution.converged = true;
+        if (inputs.mixedPrecision.empty()) {
+            outputs.solution.converged = true;
+        }
         outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
         auto b_prime = A * outputs.solution.x;
         outputs.residual = b - b_prime;
@@ -115,29 +148,110 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
     }
 }
 
+/**
+ * @brief Solves a linear system directly, by diagonalizing the diffusion operator with discrete sine transforms.
+ * @details The transforms are planned in every profiled run, so their setup cost is part of the reported time.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingSineTransform(SolverOutputs &outputs, SolverInputs &inputs) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+
+    const MyPhysics::Diffusion::Params<T> params(inputs.diffusionParams);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        solution = MyPhysics::Diffusion::applySineTransform(params, bT);
+    }, inputs.numRuns, inputs.timeout, "Fast Sine Transform");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "DST.csv", outputs.fluxes);
+        }
+    }
+}
+
+/**
+ * @brief Solves a linear system using the supernodal sparse Cholesky factorization, in geometric nested dissection
+ * order of the mesh.
+ * @details The ordering, symbolic analysis and numeric factorization are all repeated in every profiled run, so the
+ * reported time is that of a full direct solve.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingSparseCholesky(SolverOutputs &outputs, SolverInputs &inputs) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const size_t m = inputs.diffusionParams.getM();
+    const size_t n = inputs.diffusionParams.getN();
+
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        solution = MyFactorizationMethod::applySparseCholesky(AT, bT, m, n);
+    }, inputs.numRuns, inputs.timeout, "Sparse Cholesky");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "SparseCholesky.csv", outputs.fluxes);
+        }
+    }
+}
+
 /**
  * @brief Solves a linear system using the Point Jacobi method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto A = inputs.diffusionCoefficients;
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting Point jacobi calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold);
+        solution = MyRelaxationMethod::applyPointJacobi(AT, bT, max_iterations, threshold);
     }, inputs.numRuns, inputs.timeout, "Point Jacobi");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -153,26 +267,33 @@ void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Jacobi SOR method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingJacobiSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting SOR point jacobi calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold, 2.0f - omega);
+        solution = MyRelaxationMethod::applyPointJacobi(AT, bT, max_iterations, threshold, 2.0f - omega);
     }, inputs.numRuns, inputs.timeout, "SORPJ");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -188,26 +309,33 @@ void usingJacobiSOR(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Gauss-Seidel method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting Gauss Seidel calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySOR(A, b, max_iterations, threshold);
+        solution = MyRelaxationMethod::applySOR(AT, bT, max_iterations, threshold);
     }, inputs.numRuns, inputs.timeout, "Gauss Seidel");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -223,26 +351,33 @@ void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Symmetric Gauss-Seidel method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingSymmetricGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting Symmetric Gauss Seidel calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySSOR(A, b, max_iterations, threshold);
+        solution = MyRelaxationMethod::applySSOR(AT, bT, max_iterations, threshold);
     }, inputs.numRuns, inputs.timeout, "Symmetric Gauss Seidel");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -258,27 +393,34 @@ void usingSymmetricGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Successive Over-Relaxation (SOR) method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting SOR calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySOR(A, b, max_iterations, threshold, omega);
+        solution = MyRelaxationMethod::applySOR(AT, bT, max_iterations, threshold, omega);
     }, inputs.numRuns, inputs.timeout, "SOR"); // Run the block 10 times
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -294,27 +436,34 @@ void usingSOR(SolverOutputs &outputs, SolverInputs &inputs) {
 
 /**
  * @brief Solves a linear system using the Symmetric SOR method.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingSymmetricSOR(SolverOutputs &outputs, SolverInputs &inputs) {
     auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = inputs.solverParams.getRelaxationFactor();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = static_cast<T>(inputs.solverParams.getRelaxationFactor());
 
     if (!MyRelaxationMethod::passesPreChecks(A, b)) {
         std::cerr << "Aborting symmetric SOR calculation\n";
         return;
     }
 
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySSOR(A, b, max_iterations, threshold, omega);
+        solution = MyRelaxationMethod::applySSOR(AT, bT, max_iterations, threshold, omega);
     }, inputs.numRuns, inputs.timeout, "SSOR");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -39,6 +39,7 @@ typedef struct Input {
     MyBLAS::Vector<MyBLAS::NumericType> diffusionConstants;
 
     std::string fluxOutputDirectory;
+    std::string mixedPrecision; ///< "float" or "double" to solve in that precision with iterative refinement, or empty.
 
     size_t numRuns;
     long double timeout;
@@ -62,6 +63,9 @@ typedef struct Input {
                            [](MyBLAS::Solver::Type method) { return MyBLAS::Solver::TypeKey(method); });
             return result;
         }();
+        if (!mixedPrecision.empty()) {
+            jsonMap["mixed-precision"] = mixedPrecision;
+        }
     }
 } SolverInputs;
 
@@ -99,12 +103,23 @@ typedef struct Output {
         jsonMap["iterative-error"]["maximum"] = inputs.solverParams.getThreshold();
         jsonMap["iterative-error"]["actual"] = solution.iterative_error;
 
+        if (solution.refinements > 0) {
+            jsonMap["refinement-steps"] = solution.refinements;
+        }
+
         jsonMap["solution"] = solution.x.getData();
         jsonMap["residual"] = residual.getData();
         jsonMap["max-residual"] = max_residual();
 
         jsonMap["max-bytes"] = summary.maxBytes;
+        jsonMap["peak-rss-bytes"] = summary.peakResidentBytes;
+        if (!summary.memory.empty()) {
+            summary.memoryToJSON(jsonMap["memory"]);
+        }
         summary.toJSON(jsonMap["wall-time-ns"]);
+        if (!summary.counters.empty()) {
+            summary.countersToJSON(jsonMap["counters"]);
+        }
     }
 } SolverOutputs;
 
@@ -18,7 +18,9 @@
 class Parser : public CommandLine<SolverInputs> {
 
   public:
-    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {}
+    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {
+        dispatchesWorkingPrecision = true;
+    }
 
     explicit Parser() = default;
 
@@ -47,6 +49,8 @@ class Parser : public CommandLine<SolverInputs> {
         boost::program_options::options_description methods("Solver Options");
         methods.add_options()
             ("use-LUP", "= Use LUP factorization")
+            ("use-DST", "= Use the fast sine transform direct solver")
+            ("use-sparse-cholesky", "= Use the supernodal sparse Cholesky factorization")
             ("use-point-jacobi","= Use the Point-Jacobi method")
             ("use-SORPJ", "= Use the SOR Jacobi method")
             ("use-symmetric-gauss-seidel", "= Use the symmetric Gauss-Seidel method")
@@ -55,7 +59,8 @@ class Parser : public CommandLine<SolverInputs> {
             ("use-SSOR", "= Use the symmetric SOR method")(
             "threshold,t", boost::program_options::value<MyBLAS::NumericType>(),"= convergence threshold [𝜀 > 0]")(
             "max-iterations,k", boost::program_options::value<MyBLAS::NumericType>(), "= maximum iterations [n ∈ ℕ]")(
-            "relaxation-factor,w", boost::program_options::value<MyBLAS::NumericType>(), "= SOR weight, typical ω ∈ [0,2]");
+            "relaxation-factor,w", boost::program_options::value<MyBLAS::NumericType>(), "= SOR weight, typical ω ∈ [0,2]")(
+            "mixed-precision", boost::program_options::value<std::string>()->implicit_value("double"), "= Solve in {float, double}, refined to the working precision");
         values.add(methods);
         values.add(files);
     }
@@ -83,7 +88,10 @@ class Parser : public CommandLine<SolverInputs> {
         std::cout << "\tConvergence Threshold,                  𝜀: " << vm["threshold"].as<MyBLAS::NumericType>() << "\n";
         std::cout << "\tMax iterations,                         k: " << static_cast<size_t>(vm["max-iterations"].as<MyBLAS::NumericType>())<< "\n";
         std::cout << "\tSOR weight,                             ω: "<< (vm.count("relaxation-factor") ? std::to_string(vm["relaxation-factor"].as<MyBLAS::NumericType>()) : "N/A") << "\n";
+        std::cout << "\tMixed precision,                         : " << (vm.count("mixed-precision") ? vm["mixed-precision"].as<std::string>() : "No") << "\n";
         std::cout << "\tUse LUP factorization                    : " << (vm["use-LUP"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse fast sine transform                  : " << (vm["use-DST"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse sparse Cholesky factorization        : " << (vm["use-sparse-cholesky"].as<bool>() ? "Yes" : "No") << "\n";
 
         std::cout << "\tUse Point-Jacobi                         : " << (vm["use-point-jacobi"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Point-Jacobi with SOR                : " << (vm["use-SORPJ"].as<bool>() ? "Yes" : "No") << "\n";
@@ -208,6 +216,17 @@ class Parser : public CommandLine<SolverInputs> {
             }
         }
 
+        // OPTIONAL
+        // the corrections of a mixed precision solve are computed in float or double
+        if (map.count("mixed-precision")) {
+            while (map["mixed-precision"].as<std::string>() != "float" && map["mixed-precision"].as<std::string>() != "double") {
+                std::cerr << "ERROR: Mixed precision type must be float or double.\n" << std::endl;
+                std::cout << "Enter the mixed precision type (float or double): ";
+                std::cin >> input;
+                replace(map, "mixed-precision", input);
+            }
+        }
+
         // read the input json and populate the variables_map
         nlohmann::json inputMap;
         try {
@@ -253,6 +272,18 @@ class Parser : public CommandLine<SolverInputs> {
             promptAndSetFlags("use-LUP", "LUP factorization method", map);
         }
 
+        if(contains(methods, "DST")) {
+            replace(map, "use-DST", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-DST", "fast sine transform direct solver", map);
+        }
+
+        if(contains(methods, "sparse-cholesky")) {
+            replace(map, "use-sparse-cholesky", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-sparse-cholesky", "supernodal sparse Cholesky factorization", map);
+        }
+
         if(contains(methods, "point-jacobi")) {
             replace(map, "use-point-jacobi", asYesOrNo("yes"));
         } else {
@@ -349,6 +380,14 @@ class Parser : public CommandLine<SolverInputs> {
             input.methods.insert(MyFactorizationMethod::Type::METHOD_LUP);
         }
 
+        if (map["use-DST"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_DST);
+        }
+
+        if (map["use-sparse-cholesky"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY);
+        }
+
         if (map["use-point-jacobi"].as<bool>()) {
             input.methods.insert(MyRelaxationMethod::Type::METHOD_POINT_JACOBI);
         }
@@ -377,6 +416,10 @@ class Parser : public CommandLine<SolverInputs> {
             input.solverParams.relaxation_factor = map["relaxation-factor"].as<MyBLAS::NumericType>();
         }
 
+        if (map.count("mixed-precision")) {
+            input.mixedPrecision = map["mixed-precision"].as<std::string>();
+        }
+
         if (map.count("bench")) {
             input.numRuns = map.count("bench-runs") ? static_cast<size_t>(map["bench-runs"].as<long double>()) : 1;
             input.timeout = map.count("bench-timeout") ? map["bench-timeout"].as<long double>() : 0;
@@ -118,15 +118,19 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         /**
          * @brief This section of the function handles the computation using different methods.
-         * @details The methods include LUP Factorization, Point Jacobi, Gauss-Seidel, SOR, SOR Point Jacobi, and SSOR.
+         * @details The methods include LUP Factorization, the fast sine transform, sparse Cholesky factorization, Point
+         * Jacobi, Gauss-Seidel, SOR, SOR Point Jacobi, and SSOR.
          */
 
         nlohmann::json results;
         inputs.toJSON(results["inputs"]);
+        results["inputs"]["working-precision"] = MyBLAS::PrecisionKey(terminal.getWorkingPrecision());
 
         if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_LUP)) {
             SolverOutputs runResults(inputs);
-            Compute::usingLUP(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingLUP<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_LUP)]);
             Parser::printLine();
             std::cout << "LUP Factorization Results" << std::endl;
@@ -134,9 +138,35 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
             printResults(runResults);
         }
 
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_DST)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSineTransform<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_DST)]);
+            Parser::printLine();
+            std::cout << "Fast Sine Transform Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSparseCholesky<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)]);
+            Parser::printLine();
+            std::cout << "Sparse Cholesky Factorization Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)) {
             SolverOutputs runResults(inputs);
-            Compute::usingPointJacobi(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingPointJacobi<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)]);
             Parser::printLine();
             std::cout << "Point Jacobi Method Results" << std::endl;
@@ -146,7 +176,9 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SORPJ)) {
             SolverOutputs runResults(inputs);
-            Compute::usingJacobiSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingJacobiSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SORPJ)]);
             Parser::printLine();
             std::cout << "SOR Point Jacobi Method Results" << std::endl;
@@ -156,7 +188,9 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)) {
             SolverOutputs runResults(inputs);
-            Compute::usingGaussSeidel(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingGaussSeidel<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(
                 results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)]);
             Parser::printLine();
@@ -167,7 +201,9 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SYMMETRIC_GAUSS_SEIDEL)) {
             SolverOutputs runResults(inputs);
-            Compute::usingSymmetricGaussSeidel(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSymmetricGaussSeidel<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SYMMETRIC_GAUSS_SEIDEL)]);
             Parser::printLine();
             std::cout << "Symmetric Gauss-Seidel Method Results" << std::endl;
@@ -177,7 +213,9 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SOR)) {
             SolverOutputs runResults(inputs);
-            Compute::usingSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SOR)]);
             Parser::printLine();
             std::cout << "SOR Method Results" << std::endl;
@@ -187,7 +225,9 @@ class Project3 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_SSOR)) {
             SolverOutputs runResults(inputs);
-            Compute::usingSymmetricSOR(runResults, inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSymmetricSOR<typename decltype(precision)::type>(runResults, inputs);
+            });
             runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_SSOR)]);
             Parser::printLine();
             std::cout << "Symmetric SOR Method Results" << std::endl;
@@ -104,7 +104,14 @@ typedef struct Output {
         jsonMap["max-residual"] = max_residual();
 
         jsonMap["max-bytes"] = summary.maxBytes;
+        jsonMap["peak-rss-bytes"] = summary.peakResidentBytes;
+        if (!summary.memory.empty()) {
+            summary.memoryToJSON(jsonMap["memory"]);
+        }
         summary.toJSON(jsonMap["wall-time-ns"]);
+        if (!summary.counters.empty()) {
+            summary.countersToJSON(jsonMap["counters"]);
+        }
     }
 } SolverOutputs;
 
@@ -18,7 +18,9 @@
 class Parser : public CommandLine<SolverInputs> {
 
   public:
-    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {}
+    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {
+        dispatchesWorkingPrecision = true;
+    }
 
     explicit Parser() = default;
 
@@ -47,6 +49,8 @@ class Parser : public CommandLine<SolverInputs> {
         boost::program_options::options_description methods("Solver Options");
         methods.add_options()
             ("use-LUP", "= Use LUP factorization")
+            ("use-DST", "= Use the fast sine transform direct solver")
+            ("use-sparse-cholesky", "= Use the supernodal sparse Cholesky factorization")
             ("use-point-jacobi","= Use the Point-Jacobi method")
             ("use-SORJ", "= Use the SOR Jacobi method")
             ("use-gauss-seidel", "= Use the Gauss-Seidel method")
@@ -85,6 +89,8 @@ class Parser : public CommandLine<SolverInputs> {
 //        std::cout << "\tUse LUP factorization                    : " << (vm["use-LUP"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Gauss-Seidel                         : " << (vm["use-gauss-seidel"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Point-Jacobi                         : " << (vm["use-point-jacobi"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse fast sine transform                  : " << (vm["use-DST"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse sparse Cholesky factorization        : " << (vm["use-sparse-cholesky"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse SOR                                  : " << (vm["use-SOR"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse Point-Jacobi with SOR                : " << (vm["use-SORJ"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse symmetric SOR                        : " << (vm["use-SSOR"].as<bool>() ? "Yes" : "No") << "\n";
@@ -265,6 +271,18 @@ class Parser : public CommandLine<SolverInputs> {
         } else {
             promptAndSetFlags("use-gauss-seidel", "Gauss-Seidel method", map);
         }
+
+        if(contains(methods, "DST")) {
+            replace(map, "use-DST", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-DST", "fast sine transform direct solver", map);
+        }
+
+        if(contains(methods, "sparse-cholesky")) {
+            replace(map, "use-sparse-cholesky", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-sparse-cholesky", "supernodal sparse Cholesky factorization", map);
+        }
 //
 //        if(contains(methods, "SOR")) {
 //            replace(map, "use-SOR", asYesOrNo("yes"));
@@ -343,6 +361,14 @@ class Parser : public CommandLine<SolverInputs> {
         if (map["use-gauss-seidel"].as<bool>()) {
             input.methods.insert(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL);
         }
+
+        if (map["use-DST"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_DST);
+        }
+
+        if (map["use-sparse-cholesky"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY);
+        }
 //
 //        if (map["use-SOR"].as<bool>()) {
 //            input.methods.insert(MyRelaxationMethod::Type::METHOD_SOR);
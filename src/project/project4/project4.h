@@ -123,12 +123,39 @@ class Project4 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         nlohmann::json results;
         inputs.toJSON(results["inputs"]);
+        results["inputs"]["working-precision"] = MyBLAS::PrecisionKey(terminal.getWorkingPrecision());
+
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_DST)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSineTransform<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_DST)]);
+            Parser::printLine();
+            std::cout << "Fast Sine Transform Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSparseCholesky<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)]);
+            Parser::printLine();
+            std::cout << "Sparse Cholesky Factorization Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
 
         const std::vector<size_t> MAX_THREADS = {16, 8, 5, 1};
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)) {
             for(auto threads : MAX_THREADS) {
                 SolverOutputs runResults(inputs);
-                Compute::usingPointJacobi(runResults, inputs, threads);
+                dispatchWorkingPrecision([&](auto precision) {
+                    Compute::usingPointJacobi<typename decltype(precision)::type>(runResults, inputs, threads);
+                });
                 runResults.toJSON(results["outputs"][std::to_string(threads)]);
                 Parser::printLine();
                 std::cout << "[N = "<<threads<<"]: Point Jacobi Method Results" << std::endl;
@@ -140,7 +167,9 @@ class Project4 : public Project<SolverInputs, Parser, SolverOutputs> {
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)) {
             for(auto threads : MAX_THREADS) {
                 SolverOutputs runResults(inputs);
-                Compute::usingGaussSeidel(runResults, inputs, threads);
+                dispatchWorkingPrecision([&](auto precision) {
+                    Compute::usingGaussSeidel<typename decltype(precision)::type>(runResults, inputs, threads);
+                });
                 runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)][std::to_string(threads)]);
                 Parser::printLine();
                 std::cout << "[N = "<<threads<<"]: Gauss Seidel Method Results" << std::endl;
@@ -13,11 +13,19 @@
 
 #include "FileParser.h"
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/solver/IterativeRefinement.h"
 #include "math/blas/vector/MatrixVectorExpression.h"
+#include "math/factorization/BandedFactorization.h"
+#include "math/factorization/IncompleteFactorization.h"
 #include "math/factorization/LU.h"
 #include "math/factorization/LUP.h"
+#include "math/factorization/SparseCholesky.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/RedBlackSOR.h"
 #include "math/relaxation/SORPJ.h"
 #include "math/relaxation/SSOR.h"
+#include "physics/diffusion/Multigrid.h"
+#include "physics/diffusion/SineTransformSolver.h"
 #include "relaxation/SOR.h"
 
 /**
@@ -77,11 +85,26 @@ static MatrixType &fill_fluxes(SolverOutputs &outputs) {
     return outputs.fluxes;
 }
 
+/**
+ * @brief Builds the diffusion operator in the working precision T.
+ * @tparam T The working precision of the solve.
+ * @param inputs The solver inputs containing the diffusion parameters.
+ * @return The matrix-free diffusion stencil in T.
+ */
+template <typename T>
+MyPhysics::Diffusion::Matrix<T> diffusion_matrix(const SolverInputs &inputs) {
+    return MyPhysics::Diffusion::Matrix<T>(MyPhysics::Diffusion::Params<T>(inputs.diffusionParams));
+}
+
 /**
  * @brief Solves a linear system using LUP decomposition.
+ * @details With a mixed precision type in the inputs, the factors are computed in that type, and the solution is
+ * refined to the working precision with at most max-iterations refinement steps.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
     auto A = inputs.diffusionCoefficients;
@@ -92,20 +115,34 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
         return;
     }
 
-    auto inMemoryA = MyBLAS::Matrix<MyBLAS::NumericType>(inputs.diffusionCoefficients);
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
 
+    const size_t max_refinements = inputs.solverParams.getMaxIterations();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyBLAS::LUP::applyLUP(inMemoryA, b);
-    }, inputs.numRuns, inputs.timeout, "LUP");
+        if (inputs.mixedPrecision == "float") {
+            solution = MyBLAS::Solver::applyMixedPrecisionLUP<float>(AT, bT, max_refinements, threshold);
+        } else if (inputs.mixedPrecision == "double") {
+            solution = MyBLAS::Solver::applyMixedPrecisionLUP<double>(AT, bT, max_refinements, threshold);
+        } else {
+            solution = MyFactorizationMethod::applyBandedLUP(AT, bT);
+        }
+    }, inputs.numRuns, inputs.timeout, inputs.mixedPrecision.empty() ? "LUP" : "Mixed Precision LUP");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
 
     std::cout<<std::endl<<profiler;
 
     // post-process
     {
-        outputs.solution.converged = true;
+        if (inputs.mixedPrecision.empty()) {
+            outputs.solution.converged = true;
+        }
         outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
         auto b_prime = A * outputs.solution.x;
         outputs.residual = b - b_prime;
@@ -115,29 +152,105 @@ void usingLUP(SolverOutputs &outputs, SolverInputs &inputs) {
     }
 }
 
+/**
+ * @brief Solves a linear system directly, by diagonalizing the diffusion operator with discrete sine transforms.
+ * @details The transforms are planned in every profiled run, so their setup cost is part of the reported time.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingSineTransform(SolverOutputs &outputs, SolverInputs &inputs) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const MyPhysics::Diffusion::Params<T> params(inputs.diffusionParams);
+    const MyBLAS::Vector<T> bT(b);
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        solution = MyPhysics::Diffusion::applySineTransform(params, bT);
+    }, inputs.numRuns, inputs.timeout, "Fast Sine Transform");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "DST.csv", outputs.fluxes);
+        }
+    }
+}
+
+/**
+ * @brief Solves a linear system using the supernodal sparse Cholesky factorization, in geometric nested dissection
+ * order of the mesh.
+ * @details The ordering, symbolic analysis and numeric factorization are all repeated in every profiled run, so the
+ * reported time is that of a full direct solve.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingSparseCholesky(SolverOutputs &outputs, SolverInputs &inputs) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+    const size_t m = inputs.diffusionParams.getM();
+    const size_t n = inputs.diffusionParams.getN();
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        solution = MyFactorizationMethod::applySparseCholesky(AT, bT, m, n);
+    }, inputs.numRuns, inputs.timeout, "Sparse Cholesky");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "SparseCholesky.csv", outputs.fluxes);
+        }
+    }
+}
+
 /**
  * @brief Solves a linear system using the Point Jacobi method.
+ * @tparam T The working precision of the solve.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs, size_t threads = 1) {
     inputs.diffusionCoefficients = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
-    auto A = inputs.diffusionCoefficients;
-    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const auto A = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> b(naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs));
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
-    const MyBLAS::NumericType omega = 1.0;
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const T omega = 1;
 //    if (!MyRelaxationMethod::passesPreChecks(A, b)) {
 //        std::cerr << "Aborting Point jacobi calculation\n";
 //        return;
 //    }
 
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold, omega, threads);
+        solution = MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold, omega, threads);
     }, 1, inputs.timeout, "Point Jacobi");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
 
     // post-process
@@ -152,28 +265,37 @@ void usingPointJacobi(SolverOutputs &outputs, SolverInputs &inputs, size_t threa
 }
 
 /**
- * @brief Solves a linear system using the Gauss-Seidel method.
+ * @brief Solves a linear system using red-black Gauss-Seidel on the mesh coloring.
+ * @details The nodes are colored by the parity of (i + j) on the m x n mesh, so each color is relaxed in parallel.
+ * The rows are split into one tile per thread, and each tile sweeps both colors as a wavefront for cache reuse.
+ * @tparam T The working precision of the solve.
  * @param outputs The output data structure to store the solution and execution time.
  * @param inputs The input data structure containing the system to solve.
  */
+template <typename T = MyBLAS::NumericType>
 void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs, size_t threads = 1) {
-    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
-    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const auto A = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> b(naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs));
     const size_t max_iterations = inputs.solverParams.getMaxIterations();
-    const MyBLAS::NumericType threshold = inputs.solverParams.getThreshold();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const size_t m = inputs.diffusionParams.getM();
+    const size_t n = inputs.diffusionParams.getN();
+    const size_t tileRows = (m + threads - 1) / threads;
 
-    const MyBLAS::NumericType omega = 1.0;
+    const T omega = 1;
 //    if (!MyRelaxationMethod::passesPreChecks(A, b)) {
 //        std::cerr << "Aborting Gauss Seidel calculation\n";
 //        return;
 //    }
 
+    MyBLAS::Solver::Solution<T> solution;
     auto profiler = Profiler([&]() {
-        outputs.solution = MyRelaxationMethod::applySORBlockParallel(A, b, max_iterations, threshold, omega, threads);
-    }, 1, inputs.timeout, "Gauss Seidel");
+        solution = MyRelaxationMethod::applyRedBlackSOR(A, b, m, n, max_iterations, threshold, omega, threads, tileRows);
+    }, 1, inputs.timeout, "Red-Black Gauss Seidel");
 
     outputs.summary = profiler.run().getSummary();
     outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
     std::cout<<std::endl<<profiler;
     // post-process
 //    {
@@ -186,6 +308,142 @@ void usingGaussSeidel(SolverOutputs &outputs, SolverInputs &inputs, size_t threa
 //    }
 }
 
+/**
+ * @brief Solves a linear system using the conjugate gradient method on the matrix-free diffusion stencil.
+ * @details With a mixed precision type in the inputs, the iterations run on a copy of the stencil in that type, and the
+ * solution is refined to the working precision. Double is the better choice here, since every refinement step restarts
+ * CG, and float needs several of them.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingConjugateGradient(SolverOutputs &outputs, SolverInputs &inputs) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+    const size_t max_iterations = inputs.solverParams.getMaxIterations();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        if (inputs.mixedPrecision == "float") {
+            const auto ALow = diffusion_matrix<float>(inputs);
+            solution = MyBLAS::Solver::applyMixedPrecisionConjugateGradient<float>(AT, ALow, bT, max_iterations, threshold);
+        } else if (inputs.mixedPrecision == "double") {
+            const auto ALow = diffusion_matrix<double>(inputs);
+            solution = MyBLAS::Solver::applyMixedPrecisionConjugateGradient<double>(AT, ALow, bT, max_iterations, threshold);
+        } else {
+            solution = MyRelaxationMethod::applyConjugateGradient(AT, bT, max_iterations, threshold);
+        }
+    }, inputs.numRuns, inputs.timeout, inputs.mixedPrecision.empty() ? "Conjugate Gradient" : "Mixed Precision Conjugate Gradient");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "conjugate-gradient.csv", outputs.fluxes);
+        }
+    }
+}
+
+/**
+ * @brief Solves a linear system using geometric multigrid, either on its own or as the preconditioner of conjugate
+ * gradient.
+ * @details The mesh hierarchy is rebuilt in every profiled run, so its setup cost is part of the reported time.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ * @param method METHOD_MULTIGRID for repeated V-cycles, or METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingMultigrid(SolverOutputs &outputs, SolverInputs &inputs, const MyRelaxationMethod::Type method) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const MyPhysics::Diffusion::Params<T> params(inputs.diffusionParams);
+    const MyBLAS::Vector<T> bT(b);
+    const size_t max_iterations = inputs.solverParams.getMaxIterations();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const bool preconditioned = (method == MyRelaxationMethod::Type::METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT);
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        if (preconditioned) {
+            solution = MyPhysics::Diffusion::applyMultigridPreconditionedConjugateGradient(params, bT, max_iterations, threshold);
+        } else {
+            solution = MyPhysics::Diffusion::applyMultigrid(params, bT, max_iterations, threshold);
+        }
+    }, inputs.numRuns, inputs.timeout, preconditioned ? "Multigrid Preconditioned CG" : "Multigrid");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, std::string(MyRelaxationMethod::TypeKey(method)) + ".csv", outputs.fluxes);
+        }
+    }
+}
+
+/**
+ * @brief Solves a linear system using conjugate gradient, preconditioned with a zero fill-in incomplete factorization.
+ * @details The iterations use the matrix-free stencil, and the factorization uses its CSR copy. Both are rebuilt in
+ * every profiled run, so the setup cost is part of the reported time. The diffusion operator is symmetric, so the
+ * ILU(0) factors are a scaled IC(0) factorization, and give a symmetric preconditioner as well.
+ * @tparam T The working precision of the solve. The residual is always computed in MyBLAS::NumericType.
+ * @param outputs The output data structure to store the solution and execution time.
+ * @param inputs The input data structure containing the system to solve.
+ * @param method METHOD_INCOMPLETE_CHOLESKY_CONJUGATE_GRADIENT or METHOD_INCOMPLETE_LU_CONJUGATE_GRADIENT.
+ */
+template <typename T = MyBLAS::NumericType>
+void usingIncompleteFactorization(SolverOutputs &outputs, SolverInputs &inputs, const MyRelaxationMethod::Type method) {
+    auto A = MyPhysics::Diffusion::Matrix(inputs.diffusionParams);
+    auto b = naive_fill_diffusion_vector<MyBLAS::NumericType>(inputs);
+    const auto AT = diffusion_matrix<T>(inputs);
+    const MyBLAS::Vector<T> bT(b);
+    const size_t max_iterations = inputs.solverParams.getMaxIterations();
+    const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+    const bool cholesky = (method == MyRelaxationMethod::Type::METHOD_INCOMPLETE_CHOLESKY_CONJUGATE_GRADIENT);
+
+    MyBLAS::Solver::Solution<T> solution;
+    auto profiler = Profiler([&]() {
+        const MyBLAS::SparseMatrix<T> sparse(AT);
+        if (cholesky) {
+            const MyFactorizationMethod::IncompleteCholesky<T> M(sparse);
+            solution = MyRelaxationMethod::applyPreconditionedConjugateGradient(AT, bT, M, max_iterations, threshold);
+        } else {
+            const MyFactorizationMethod::IncompleteLU<T> M(sparse);
+            solution = MyRelaxationMethod::applyPreconditionedConjugateGradient(AT, bT, M, max_iterations, threshold);
+        }
+    }, inputs.numRuns, inputs.timeout, cholesky ? "IC(0) Preconditioned CG" : "ILU(0) Preconditioned CG");
+
+    outputs.summary = profiler.run().getSummary();
+    outputs.summary.runs = profiler.getTotalRuns();
+    outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+    std::cout<<std::endl<<profiler;
+
+    // post-process
+    {
+        outputs.fluxes = fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        outputs.residual = b - A * outputs.solution.x;
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, std::string(MyRelaxationMethod::TypeKey(method)) + ".csv", outputs.fluxes);
+        }
+    }
+}
+
 /**
  * @brief Solves a linear system using the Successive Over-Relaxation (SOR) method.
  * @param outputs The output data structure to store the solution and execution time.
@@ -8,8 +8,13 @@
 #ifndef NE591_008_PROJECT5_INPUTOUTPUTS_H
 #define NE591_008_PROJECT5_INPUTOUTPUTS_H
 
+#include <cmath>
 #include <utility>
 #include <memory>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
 
 #include "Project.h"
 #include "json.hpp"
@@ -39,6 +44,8 @@ typedef struct Input {
     MyBLAS::Vector<MyBLAS::NumericType> diffusionConstants;
 
     std::string fluxOutputDirectory;
+    std::string mixedPrecision; ///< "float" or "double" to solve in that precision with iterative refinement, or empty.
+    std::string outputJSON;
 
     size_t numRuns;
     long double timeout;
@@ -62,7 +69,92 @@ typedef struct Input {
                            [](MyBLAS::Solver::Type method) { return MyBLAS::Solver::TypeKey(method); });
             return result;
         }();
+        if (!mixedPrecision.empty()) {
+            jsonMap["mixed-precision"] = mixedPrecision;
+        }
     }
+
+    /**
+     * @brief Writes the inputs to a Boost archive, so that MPIProject can send them to the other ranks.
+     * @details The diffusion matrix and the constants vector are derived from the rest, and are not sent.
+     */
+    template <class Archive>
+    void save(Archive &ar, const unsigned int version) const {
+        const size_t rows = sources.getRows(), cols = sources.getCols();
+        ar << rows << cols;
+        for (size_t i = 0; i < rows; i++) {
+            for (size_t j = 0; j < cols; j++) {
+                ar << sources[i][j];
+            }
+        }
+
+        const MyBLAS::NumericType a = diffusionParams.getA(), b = diffusionParams.getB();
+        const size_t m = diffusionParams.getM(), n = diffusionParams.getN();
+        const MyBLAS::NumericType D = diffusionParams.getDiffusionCoefficient();
+        const MyBLAS::NumericType crossSection = diffusionParams.getMacroscopicRemovalCrossSection();
+        ar << a << b << m << n << D << crossSection;
+
+        // text archives cannot read back a NaN, which marks a relaxation factor that was not given
+        const bool hasRelaxationFactor = !std::isnan(solverParams.relaxation_factor);
+        ar << solverParams.n << solverParams.convergence_threshold << solverParams.max_iterations << hasRelaxationFactor;
+        if (hasRelaxationFactor) {
+            ar << solverParams.relaxation_factor;
+        }
+
+        const size_t count = methods.size();
+        ar << count;
+        for (const auto &method : methods) {
+            const size_t index = method.index();
+            const int value = std::visit([](auto arg) { return static_cast<int>(arg); }, method);
+            ar << index << value;
+        }
+
+        ar << fluxOutputDirectory << mixedPrecision << outputJSON << numRuns << timeout;
+    }
+
+    /**
+     * @brief Reads the inputs written by save().
+     */
+    template <class Archive>
+    void load(Archive &ar, const unsigned int version) {
+        size_t rows, cols;
+        ar >> rows >> cols;
+        sources = MyBLAS::Matrix<MyBLAS::NumericType>(rows, cols, 0);
+        for (size_t i = 0; i < rows; i++) {
+            for (size_t j = 0; j < cols; j++) {
+                ar >> sources[i][j];
+            }
+        }
+
+        MyBLAS::NumericType a, b, D, crossSection;
+        size_t m, n;
+        ar >> a >> b >> m >> n >> D >> crossSection;
+        diffusionParams.setA(a).setB(b).setM(m).setN(n).setDiffusionCoefficient(D).setMacroscopicRemovalCrossSection(crossSection);
+
+        bool hasRelaxationFactor;
+        ar >> solverParams.n >> solverParams.convergence_threshold >> solverParams.max_iterations >> hasRelaxationFactor;
+        if (hasRelaxationFactor) {
+            ar >> solverParams.relaxation_factor;
+        }
+
+        size_t count;
+        ar >> count;
+        methods.clear();
+        for (size_t k = 0; k < count; k++) {
+            size_t index;
+            int value;
+            ar >> index >> value;
+            if (index == 0) {
+                methods.insert(static_cast<MyFactorizationMethod::Type>(value));
+            } else {
+                methods.insert(static_cast<MyRelaxationMethod::Type>(value));
+            }
+        }
+
+        ar >> fluxOutputDirectory >> mixedPrecision >> outputJSON >> numRuns >> timeout;
+    }
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 } SolverInputs;
 
 /**
@@ -99,12 +191,23 @@ typedef struct Output {
         jsonMap["iterative-error"]["maximum"] = inputs.solverParams.getThreshold();
         jsonMap["iterative-error"]["actual"] = solution.iterative_error;
 
+        if (solution.refinements > 0) {
+            jsonMap["refinement-steps"] = solution.refinements;
+        }
+
         //jsonMap["solution"] = solution.x.getData();
         //jsonMap["residual"] = residual.getData();
         jsonMap["max-residual"] = max_residual();
 
         jsonMap["max-bytes"] = summary.maxBytes;
+        jsonMap["peak-rss-bytes"] = summary.peakResidentBytes;
+        if (!summary.memory.empty()) {
+            summary.memoryToJSON(jsonMap["memory"]);
+        }
         summary.toJSON(jsonMap["wall-time-ns"]);
+        if (!summary.counters.empty()) {
+            summary.countersToJSON(jsonMap["counters"]);
+        }
     }
 } SolverOutputs;
 
@@ -18,7 +18,9 @@
 class Parser : public CommandLine<SolverInputs> {
 
   public:
-    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {}
+    explicit Parser(const HeaderInfo &headerInfo, const CommandLineArgs &args) : CommandLine(headerInfo, args) {
+        dispatchesWorkingPrecision = true;
+    }
 
     explicit Parser() = default;
 
@@ -47,14 +49,22 @@ class Parser : public CommandLine<SolverInputs> {
         boost::program_options::options_description methods("Solver Options");
         methods.add_options()
             ("use-LUP", "= Use LUP factorization")
+            ("use-DST", "= Use the fast sine transform direct solver")
+            ("use-sparse-cholesky", "= Use the supernodal sparse Cholesky factorization")
             ("use-point-jacobi","= Use the Point-Jacobi method")
             ("use-SORJ", "= Use the SOR Jacobi method")
             ("use-gauss-seidel", "= Use the Gauss-Seidel method")
             ("use-SOR", "= Use the SOR method")
-            ("use-SSOR", "= Use the symmetric SOR method")(
+            ("use-SSOR", "= Use the symmetric SOR method")
+            ("use-CG", "= Use the conjugate gradient method")
+            ("use-multigrid", "= Use the geometric multigrid V-cycle")
+            ("use-MGCG", "= Use the multigrid preconditioned conjugate gradient method")
+            ("use-ICCG", "= Use the IC(0) preconditioned conjugate gradient method")
+            ("use-ILUCG", "= Use the ILU(0) preconditioned conjugate gradient method")(
             "threshold,t", boost::program_options::value<MyBLAS::NumericType>(),"= convergence threshold [𝜀 > 0]")(
             "max-iterations,k", boost::program_options::value<MyBLAS::NumericType>(), "= maximum iterations [n ∈ ℕ]")(
-            "relaxation-factor,w", boost::program_options::value<MyBLAS::NumericType>(), "= SOR weight, typical ω ∈ [0,2]");
+            "relaxation-factor,w", boost::program_options::value<MyBLAS::NumericType>(), "= SOR weight, typical ω ∈ [0,2]")(
+            "mixed-precision", boost::program_options::value<std::string>()->implicit_value("double"), "= Solve in {float, double}, refined to the working precision");
         values.add(methods);
         values.add(files);
     }
@@ -82,9 +92,17 @@ class Parser : public CommandLine<SolverInputs> {
         std::cout << "\tConvergence Threshold,                  𝜀: " << vm["threshold"].as<MyBLAS::NumericType>() << "\n";
         std::cout << "\tMax iterations,                         k: " << static_cast<size_t>(vm["max-iterations"].as<MyBLAS::NumericType>())<< "\n";
         std::cout << "\tSOR weight,                             ω: "<< (vm.count("relaxation-factor") ? std::to_string(vm["relaxation-factor"].as<MyBLAS::NumericType>()) : "N/A") << "\n";
+        std::cout << "\tMixed precision,                         : " << (vm.count("mixed-precision") ? vm["mixed-precision"].as<std::string>() : "No") << "\n";
 //        std::cout << "\tUse LUP factorization                    : " << (vm["use-LUP"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Gauss-Seidel                         : " << (vm["use-gauss-seidel"].as<bool>() ? "Yes" : "No") << "\n";
         std::cout << "\tUse Point-Jacobi                         : " << (vm["use-point-jacobi"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse Conjugate Gradient                   : " << (vm["use-CG"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse Multigrid                            : " << (vm["use-multigrid"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse Multigrid Preconditioned CG          : " << (vm["use-MGCG"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse IC(0) Preconditioned CG              : " << (vm["use-ICCG"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse ILU(0) Preconditioned CG             : " << (vm["use-ILUCG"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse fast sine transform                  : " << (vm["use-DST"].as<bool>() ? "Yes" : "No") << "\n";
+        std::cout << "\tUse sparse Cholesky factorization        : " << (vm["use-sparse-cholesky"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse SOR                                  : " << (vm["use-SOR"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse Point-Jacobi with SOR                : " << (vm["use-SORJ"].as<bool>() ? "Yes" : "No") << "\n";
 //        std::cout << "\tUse symmetric SOR                        : " << (vm["use-SSOR"].as<bool>() ? "Yes" : "No") << "\n";
@@ -203,6 +221,17 @@ class Parser : public CommandLine<SolverInputs> {
             }
         }
 
+        // OPTIONAL
+        // the corrections of a mixed precision solve are computed in float or double
+        if (map.count("mixed-precision")) {
+            while (map["mixed-precision"].as<std::string>() != "float" && map["mixed-precision"].as<std::string>() != "double") {
+                std::cerr << "ERROR: Mixed precision type must be float or double.\n" << std::endl;
+                std::cout << "Enter the mixed precision type (float or double): ";
+                std::cin >> input;
+                replace(map, "mixed-precision", input);
+            }
+        }
+
         // read the input json and populate the variables_map
         nlohmann::json inputMap;
         try {
@@ -265,6 +294,48 @@ class Parser : public CommandLine<SolverInputs> {
         } else {
             promptAndSetFlags("use-gauss-seidel", "Gauss-Seidel method", map);
         }
+
+        if(contains(methods, "conjugate-gradient")) {
+            replace(map, "use-CG", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-CG", "conjugate gradient method", map);
+        }
+
+        if(contains(methods, "multigrid")) {
+            replace(map, "use-multigrid", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-multigrid", "geometric multigrid method", map);
+        }
+
+        if(contains(methods, "multigrid-preconditioned-conjugate-gradient")) {
+            replace(map, "use-MGCG", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-MGCG", "multigrid preconditioned conjugate gradient method", map);
+        }
+
+        if(contains(methods, "incomplete-cholesky-conjugate-gradient")) {
+            replace(map, "use-ICCG", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-ICCG", "IC(0) preconditioned conjugate gradient method", map);
+        }
+
+        if(contains(methods, "incomplete-LU-conjugate-gradient")) {
+            replace(map, "use-ILUCG", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-ILUCG", "ILU(0) preconditioned conjugate gradient method", map);
+        }
+
+        if(contains(methods, "DST")) {
+            replace(map, "use-DST", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-DST", "fast sine transform direct solver", map);
+        }
+
+        if(contains(methods, "sparse-cholesky")) {
+            replace(map, "use-sparse-cholesky", asYesOrNo("yes"));
+        } else {
+            promptAndSetFlags("use-sparse-cholesky", "supernodal sparse Cholesky factorization", map);
+        }
 //
 //        if(contains(methods, "SOR")) {
 //            replace(map, "use-SOR", asYesOrNo("yes"));
@@ -308,6 +379,7 @@ class Parser : public CommandLine<SolverInputs> {
         readCSVRowWiseNoHeaders<MyBLAS::NumericType>(sourceTermsFilepath, input.sources);
 
         input.fluxOutputDirectory = map["flux-output-dir"].as<std::string>();
+        input.outputJSON = map["output-results-json"].as<std::string>();
 
         if (input.sources.getRows() < 1 || input.sources.getCols() < 1) {
             std::cerr << "ERROR: No Source terms matrix dimension (rows=" << input.sources.getRows()
@@ -343,6 +415,34 @@ class Parser : public CommandLine<SolverInputs> {
         if (map["use-gauss-seidel"].as<bool>()) {
             input.methods.insert(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL);
         }
+
+        if (map["use-CG"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_CONJUGATE_GRADIENT);
+        }
+
+        if (map["use-multigrid"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_MULTIGRID);
+        }
+
+        if (map["use-MGCG"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT);
+        }
+
+        if (map["use-ICCG"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_INCOMPLETE_CHOLESKY_CONJUGATE_GRADIENT);
+        }
+
+        if (map["use-ILUCG"].as<bool>()) {
+            input.methods.insert(MyRelaxationMethod::Type::METHOD_INCOMPLETE_LU_CONJUGATE_GRADIENT);
+        }
+
+        if (map["use-DST"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_DST);
+        }
+
+        if (map["use-sparse-cholesky"].as<bool>()) {
+            input.methods.insert(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY);
+        }
 //
 //        if (map["use-SOR"].as<bool>()) {
 //            input.methods.insert(MyRelaxationMethod::Type::METHOD_SOR);
@@ -360,6 +460,10 @@ class Parser : public CommandLine<SolverInputs> {
             input.solverParams.relaxation_factor = map["relaxation-factor"].as<MyBLAS::NumericType>();
         }
 
+        if (map.count("mixed-precision")) {
+            input.mixedPrecision = map["mixed-precision"].as<std::string>();
+        }
+
         if (map.count("bench")) {
             input.numRuns = map.count("bench-runs") ? static_cast<size_t>(map["bench-runs"].as<long double>()) : 1;
             input.timeout = map.count("bench-timeout") ? map["bench-timeout"].as<long double>() : 0;
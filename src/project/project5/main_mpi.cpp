@@ -0,0 +1,20 @@
+
+#include "CommandLine.h"
+#include "project5_mpi.h"
+
+/**
+ * @brief The main function of the distributed program.
+ *
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ *
+ * @return The exit status of the program.
+ */
+int main(int argc, char **argv) {
+    CommandLineArgs args = {
+        .argc = argc,
+        .argv = argv,
+    };
+    auto &labProject = Project5MPI::getInstance(args);
+    labProject.execute();
+}
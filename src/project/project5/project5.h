@@ -123,12 +123,39 @@ class Project5 : public Project<SolverInputs, Parser, SolverOutputs> {
 
         nlohmann::json results;
         inputs.toJSON(results["inputs"]);
+        results["inputs"]["working-precision"] = MyBLAS::PrecisionKey(terminal.getWorkingPrecision());
+
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_DST)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSineTransform<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_DST)]);
+            Parser::printLine();
+            std::cout << "Fast Sine Transform Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
+        if (inputs.methods.count(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingSparseCholesky<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyFactorizationMethod::TypeKey(MyFactorizationMethod::Type::METHOD_SPARSE_CHOLESKY)]);
+            Parser::printLine();
+            std::cout << "Sparse Cholesky Factorization Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
 
         const std::vector<size_t> MAX_THREADS = {16, 8, 5, 1};
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_POINT_JACOBI)) {
             for(auto threads : MAX_THREADS) {
                 SolverOutputs runResults(inputs);
-                Compute::usingPointJacobi(runResults, inputs, threads);
+                dispatchWorkingPrecision([&](auto precision) {
+                    Compute::usingPointJacobi<typename decltype(precision)::type>(runResults, inputs, threads);
+                });
                 runResults.toJSON(results["outputs"][std::to_string(threads)]);
                 Parser::printLine();
                 std::cout << "[N = "<<threads<<"]: Point Jacobi Method Results" << std::endl;
@@ -140,7 +167,9 @@ class Project5 : public Project<SolverInputs, Parser, SolverOutputs> {
         if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)) {
             for(auto threads : MAX_THREADS) {
                 SolverOutputs runResults(inputs);
-                Compute::usingGaussSeidel(runResults, inputs, threads);
+                dispatchWorkingPrecision([&](auto precision) {
+                    Compute::usingGaussSeidel<typename decltype(precision)::type>(runResults, inputs, threads);
+                });
                 runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL)][std::to_string(threads)]);
                 Parser::printLine();
                 std::cout << "[N = "<<threads<<"]: Gauss Seidel Method Results" << std::endl;
@@ -149,6 +178,56 @@ class Project5 : public Project<SolverInputs, Parser, SolverOutputs> {
             }
         }
 
+        if (inputs.methods.count(MyRelaxationMethod::Type::METHOD_CONJUGATE_GRADIENT)) {
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&](auto precision) {
+                Compute::usingConjugateGradient<typename decltype(precision)::type>(runResults, inputs);
+            });
+            runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(MyRelaxationMethod::Type::METHOD_CONJUGATE_GRADIENT)]);
+            Parser::printLine();
+            std::cout << "Conjugate Gradient Method Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
+        const std::vector<std::pair<MyRelaxationMethod::Type, std::string>> multigridMethods = {
+            {MyRelaxationMethod::Type::METHOD_MULTIGRID, "Multigrid"},
+            {MyRelaxationMethod::Type::METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT, "Multigrid Preconditioned CG"},
+        };
+        for (const auto &[method, description] : multigridMethods) {
+            if (!inputs.methods.count(method)) {
+                continue;
+            }
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&, method = method](auto precision) {
+                Compute::usingMultigrid<typename decltype(precision)::type>(runResults, inputs, method);
+            });
+            runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(method)]);
+            Parser::printLine();
+            std::cout << description << " Method Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
+        const std::vector<std::pair<MyRelaxationMethod::Type, std::string>> incompleteFactorizationMethods = {
+            {MyRelaxationMethod::Type::METHOD_INCOMPLETE_CHOLESKY_CONJUGATE_GRADIENT, "IC(0) Preconditioned CG"},
+            {MyRelaxationMethod::Type::METHOD_INCOMPLETE_LU_CONJUGATE_GRADIENT, "ILU(0) Preconditioned CG"},
+        };
+        for (const auto &[method, description] : incompleteFactorizationMethods) {
+            if (!inputs.methods.count(method)) {
+                continue;
+            }
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&, method = method](auto precision) {
+                Compute::usingIncompleteFactorization<typename decltype(precision)::type>(runResults, inputs, method);
+            });
+            runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(method)]);
+            Parser::printLine();
+            std::cout << description << " Method Results" << std::endl;
+            Parser::printLine();
+            printResults(runResults);
+        }
+
         Parser::printLine();
 
         // write output data
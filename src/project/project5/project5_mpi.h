@@ -0,0 +1,192 @@
+/**
+ * @file project5_mpi.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains the declaration for the Project5MPI class, which solves the project 5 diffusion problem on
+ * a mesh that is split into 2D blocks over MPI ranks.
+ *
+ */
+
+#ifndef NE591_008_PROJECT5_PROJECT5_MPI_H
+#define NE591_008_PROJECT5_PROJECT5_MPI_H
+
+#include <boost/program_options.hpp>
+#include <iomanip>
+#include <iostream>
+#include <mpi.h>
+
+#include "InputsOutputs.h"
+#include "Parser.h"
+
+#include "CommandLine.h"
+#include "utils/mpi/CartesianDecomposition.h"
+#include "utils/mpi/DistributedDiffusion.h"
+#include "utils/mpi/MPIProject.h"
+
+#include "Compute.h"
+#include "json.hpp"
+
+/**
+ * @class Project5MPI
+ * @brief This class is a child of the MPI Project class, and solves the diffusion equation with one block of the mesh
+ * per rank.
+ * @details The inputs are parsed on rank 0 and sent to every rank by MPIProject. The m x n mesh is split over a 2D grid
+ * of ranks by MyMPI::CartesianDecomposition, and each rank only stores its own block of the right hand side and the
+ * iterates, plus a one-cell ghost layer. Point Jacobi, Gauss-Seidel (in the red-black ordering) and conjugate gradient
+ * are selected with the same options as project5. The fluxes and residuals are gathered onto rank 0, which prints the
+ * results and writes the JSON and CSV outputs.
+ */
+class Project5MPI : public MPIProject<SolverInputs, Parser, SolverOutputs> {
+
+  public:
+    /**
+     * @brief This function is used to get the instance of the Project5MPI class.
+     * @details This function follows the Singleton design pattern, since MPI can only be initialized once per process.
+     * @param args Command line arguments
+     * @return Returns the instance of the Project5MPI class.
+     */
+    [[maybe_unused]] static Project5MPI &getInstance(CommandLineArgs args) {
+        static Project5MPI instance(args);
+        return instance;
+    }
+
+    Project5MPI(Project5MPI const &) = delete;
+    void operator=(Project5MPI const &) = delete;
+
+  protected:
+    /**
+     * @brief Constructor for the Project5MPI class
+     * @param args Command line arguments
+     */
+    explicit Project5MPI(CommandLineArgs args) : MPIProject<SolverInputs, Parser, SolverOutputs>(buildHeaderInfo(), args) {}
+
+    /**
+     * @brief This function builds the header information for the project.
+     * @return HeaderInfo object containing project information
+     */
+    static HeaderInfo buildHeaderInfo() {
+        return {
+            .ProjectName = "NE591: Project Milestone 5",
+            .ProjectDescription = "Domain Decomposed Diffusion Solver using MPI",
+            .SubmissionDate = "10/20/2023",
+            .StudentName = "Arjun Earthperson",
+            .HeaderArt = " ",
+        };
+    }
+
+    /**
+     * @brief Solves the distributed system with one method, and gathers the results onto rank 0.
+     * @details Every run starts from a zero guess. Every run is a collective, so the profiler follows rank 0 on when to
+     * stop, which keeps the ranks in step under the timeout and the adaptive stopping rule.
+     * @tparam T The working precision of the solve and of the residual.
+     * @param outputs The outputs of the run, filled in on rank 0.
+     * @param inputs The inputs to the computation.
+     * @param decomposition The process grid and this rank's block.
+     * @param method The solver to use.
+     * @param description The name of the method, for the profiler.
+     */
+    template <typename T>
+    void solve(SolverOutputs &outputs, const SolverInputs &inputs, const MyMPI::CartesianDecomposition &decomposition,
+               const MyRelaxationMethod::Type method, const std::string &description) {
+        const MyMPI::Diffusion::Operator<T> A{MyPhysics::Diffusion::Params<T>(inputs.diffusionParams)};
+        const auto b = MyMPI::Diffusion::localBlock(decomposition, MyBLAS::Matrix<T>(inputs.sources));
+        const size_t max_iterations = inputs.solverParams.getMaxIterations();
+        const T threshold = static_cast<T>(inputs.solverParams.getThreshold());
+        const T omega = 1.0;
+
+        MyMPI::HaloField<T> x(decomposition);
+        MyBLAS::Solver::Solution<T> solution;
+        auto profiler = getProfiler([&]() {
+            x = MyMPI::HaloField<T>(decomposition);
+            switch (method) {
+            case MyRelaxationMethod::Type::METHOD_POINT_JACOBI:
+                solution = MyMPI::Diffusion::applyPointJacobi(A, b, x, max_iterations, threshold, omega);
+                break;
+            case MyRelaxationMethod::Type::METHOD_CONJUGATE_GRADIENT:
+                solution = MyMPI::Diffusion::applyConjugateGradient(A, b, x, max_iterations, threshold);
+                break;
+            default:
+                solution = MyMPI::Diffusion::applyRedBlackSOR(A, b, x, max_iterations, threshold, omega);
+                break;
+            }
+        }, inputs.numRuns, inputs.timeout, description);
+
+        outputs.summary = profiler.run().getSummary();
+        outputs.summary.runs = profiler.getTotalRuns();
+        outputs.solution = MyBLAS::Solver::Solution<MyBLAS::NumericType>(solution);
+        outputs.residual = MyBLAS::Vector<MyBLAS::NumericType>(MyMPI::Diffusion::residual(A, b, x).gather());
+
+        if (decomposition.getRank() != 0) {
+            return;
+        }
+
+        std::cout << std::endl << profiler;
+        outputs.fluxes = Compute::fill_fluxes<MyBLAS::Matrix<MyBLAS::NumericType>>(outputs);
+        if (!inputs.fluxOutputDirectory.empty()) {
+            writeCSVMatrixNoHeaders(inputs.fluxOutputDirectory, "distributed-" + std::string(MyRelaxationMethod::TypeKey(method)) + ".csv", outputs.fluxes);
+        }
+    }
+
+    /**
+     * @brief Runs each of the selected methods on the distributed mesh.
+     * @param outputs The outputs of the computation.
+     * @param inputs The inputs to the computation.
+     * @param rank The rank of the current process.
+     * @param size The total number of processes.
+     * @return Returns false to indicate that the computation was successful.
+     */
+    bool run(SolverOutputs &outputs, SolverInputs &inputs, const int rank, const int size) override {
+        const MyMPI::CartesianDecomposition decomposition(inputs.diffusionParams.getM(), inputs.diffusionParams.getN());
+
+        nlohmann::json results;
+        if (rank == 0) {
+            inputs.toJSON(results["inputs"]);
+            results["ranks"] = size;
+            results["process-grid"] = decomposition.getDims();
+            results["inputs"]["working-precision"] = MyBLAS::PrecisionKey(_workingPrecision);
+        }
+
+        const std::vector<std::pair<MyRelaxationMethod::Type, std::string>> methods = {
+            {MyRelaxationMethod::Type::METHOD_POINT_JACOBI, "Point Jacobi"},
+            {MyRelaxationMethod::Type::METHOD_GAUSS_SEIDEL, "Red-Black Gauss Seidel"},
+            {MyRelaxationMethod::Type::METHOD_CONJUGATE_GRADIENT, "Conjugate Gradient"},
+        };
+
+        for (const auto &[method, description] : methods) {
+            if (!inputs.methods.count(method)) {
+                continue;
+            }
+            SolverOutputs runResults(inputs);
+            dispatchWorkingPrecision([&, method = method, description = description](auto precision) {
+                solve<typename decltype(precision)::type>(runResults, inputs, decomposition, method, description);
+            });
+            if (rank == 0) {
+                runResults.toJSON(results["outputs"][MyRelaxationMethod::TypeKey(method)]);
+                Parser::printLine();
+                std::cout << "[ranks = " << size << "]: " << description << " Method Results" << std::endl;
+                Parser::printLine();
+                printResults(runResults);
+            }
+        }
+
+        if (rank == 0) {
+            Parser::printLine();
+            writeJSON(inputs.outputJSON, results);
+        }
+        return false;
+    }
+
+    /**
+     * @brief This function prints the results of the computation.
+     * @param results The results of the computation.
+     */
+    static void printResults(SolverOutputs &results) {
+        std::cout << "\torder                     : " << (results.inputs.solverParams.n) << std::endl;
+        std::cout << "\ttotal iterations          : " << (results.solution.iterations) << std::endl;
+        std::cout << "\tconverged                 : " << (results.solution.converged ? "Yes" : "No") << std::endl;
+        std::cout << "\titerative error           : " << (results.solution.iterative_error) << std::endl;
+        std::cout << "\tabsolute maximum residual : " << (results.max_residual()) << std::endl;
+    }
+};
+
+#endif // NE591_008_PROJECT5_PROJECT5_MPI_H
@@ -12,6 +12,7 @@
 #define NE591_008_COMMANDLINE_H
 
 #include "Helpers.h"
+#include "math/blas/Precision.h"
 #include "project-config.h"
 #include "utils/profiler/Profiler.h"
 #include "utils/profiler/ProfilerHelper.h"
@@ -156,6 +157,17 @@ template <typename InputType> class CommandLine {
         replace(variablesMap, "precision", std::setprecision(precisionToSet)._M_n);
     }
 
+    /**
+     * @brief Method to get the floating point type selected with --working-precision.
+     * @return The working precision, which is always long double for binaries that do not dispatch on it.
+     */
+    MyBLAS::Precision getWorkingPrecision() {
+        if (!initialized) {
+            initialize();
+        }
+        return workingPrecision;
+    }
+
     /**
      * @brief Method to get the inputs.
      * @return A reference to the inputs.
@@ -255,13 +267,27 @@ template <typename InputType> class CommandLine {
      */
     HeaderInfo header;
 
+    /**
+     * @var workingPrecision
+     * @brief The floating point type that the compute path is instantiated with, parsed from --working-precision.
+     */
+    MyBLAS::Precision workingPrecision = MyBLAS::PRECISION_LONG_DOUBLE;
+
+    /**
+     * @var dispatchesWorkingPrecision
+     * @brief Set by derived parsers whose project dispatches on the working precision. Only these binaries accept
+     * --working-precision, and the others compute in long double.
+     */
+    bool dispatchesWorkingPrecision = false;
+
     /**
      * @brief Method to build a set of generic command line options.
+     * @param workingPrecisionOption Whether to add --working-precision, for binaries that dispatch on it.
      * @return An options description containing the generic command line options.
      * This method builds a set of generic command line options, such as "help", "quiet", and "precision",
      * and returns them as an options description.
      */
-    static boost::program_options::options_description buildGenerics() {
+    static boost::program_options::options_description buildGenerics(const bool workingPrecisionOption) {
         auto benchmarkOptions = ProfilerHelper::buildCommandlineOptions();
         benchmarkOptions.add_options()("bench,B", "= Run performance benchmarks");
 
@@ -269,6 +295,10 @@ template <typename InputType> class CommandLine {
         generics.add_options()
             ("help,h", "= Show this help message")("quiet,q", "= Reduce verbosity")
             ("precision,p", boost::program_options::value<int>()->default_value(15), "= Number of digits to represent long double");
+        if (workingPrecisionOption) {
+            generics.add_options()
+                ("working-precision", boost::program_options::value<std::string>()->default_value("long-double"), "= Solver precision {float, double, long-double}");
+        }
         benchmarkOptions.add(generics);
         return benchmarkOptions;
     }
@@ -308,6 +338,9 @@ template <typename InputType> class CommandLine {
         std::cout << "default: " << default_precision << ", ";
         std::cout << "maximum: " << max_precision << ", ";
         std::cout << "current: " << precision << "\n";
+        if (dispatchesWorkingPrecision) {
+            std::cout << "\t\t\tWorking precision:    " << MyBLAS::PrecisionKey(workingPrecision) << "\n";
+        }
         printLine();
     }
 
@@ -328,7 +361,7 @@ template <typename InputType> class CommandLine {
         initialized = true;
         boost::program_options::options_description options("Parameters");
         buildInputArguments(options);
-        options.add(buildGenerics());
+        options.add(buildGenerics(dispatchesWorkingPrecision));
         boost::program_options::store(boost::program_options::parse_command_line(cmdArgs.argc, cmdArgs.argv, options),
                                       variablesMap);
         boost::program_options::notify(variablesMap);
@@ -339,6 +372,8 @@ template <typename InputType> class CommandLine {
             exit(0);
         }
 
+        checkWorkingPrecision();
+
         // print compiler information
         if (!variablesMap.count("quiet")) {
             printCompileConfigs();
@@ -355,6 +390,10 @@ template <typename InputType> class CommandLine {
             // build the profiler now
             ProfilerHelper::validateOptions(variablesMap);
         }
+        ProfilerHelper::configureCounters(variablesMap);
+        ProfilerHelper::configureTrace(variablesMap);
+        ProfilerHelper::configureMemorySampler(variablesMap);
+        ProfilerHelper::configureSampling(variablesMap);
 
         if (!variablesMap.count("quiet")) {
             // print the input arguments
@@ -365,6 +404,23 @@ template <typename InputType> class CommandLine {
         buildInputs(_inputs, variablesMap);
     }
 
+    /**
+     * @brief Method to parse --working-precision, prompting until it names a known precision.
+     * Binaries that do not dispatch on the working precision do not have the option, and stay in long double.
+     */
+    void checkWorkingPrecision() {
+        if (!dispatchesWorkingPrecision) {
+            return;
+        }
+        std::string input;
+        while (!MyBLAS::parsePrecision(variablesMap["working-precision"].as<std::string>(), workingPrecision)) {
+            std::cerr << "ERROR: Working precision must be one of float, double, or long-double.\n" << std::endl;
+            std::cout << "Enter the working precision: ";
+            std::cin >> input;
+            replace(variablesMap, "working-precision", input);
+        }
+    }
+
     /**
      * @brief Method to print the compile configurations to the console.
      * This method prints the compiler ID, compiler version, compiler flags, and Boost version and libraries to the
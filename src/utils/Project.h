@@ -178,6 +178,19 @@ template <typename InputType, typename CommandLineParserType, typename OutputTyp
     auto getProfiler(Func func, std::string description = "") {
         return ProfilerHelper::InitProfiler(func, getTerminal().getArguments(), description);
     }
+
+    /**
+     * @brief Calls func with the PrecisionTag of the working precision selected on the command line.
+     * @details Only binaries whose parser sets dispatchesWorkingPrecision accept --working-precision. For the others,
+     * this is always long double.
+     * @tparam Func A generic callable, invoked as func(MyBLAS::PrecisionTag<T>{}).
+     * @param func The compute path to instantiate.
+     * @return Whatever func returns.
+     */
+    template <typename Func>
+    decltype(auto) dispatchWorkingPrecision(Func &&func) {
+        return MyBLAS::dispatchPrecision(terminal.getWorkingPrecision(), std::forward<Func>(func));
+    }
 };
 
 #endif // NE591_008_PROJECT_H
@@ -0,0 +1,419 @@
+/**
+ * @file FFT.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains an in-house fast Fourier transform, and the type-I discrete sine transform built on it.
+ *
+ * Lengths made of small prime factors use a recursive mixed-radix Cooley-Tukey transform with precomputed twiddle
+ * factors. Lengths with a large prime factor are rewritten as a convolution with a chirp (Bluestein's algorithm), which
+ * is evaluated with mixed-radix transforms of at least twice the length, so that any length costs O(N log N).
+ */
+
+#ifndef NE591_008_FFT_H
+#define NE591_008_FFT_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @namespace FFT
+ * @brief A namespace containing fast Fourier and sine transforms.
+ */
+namespace FFT {
+
+/**
+ * @brief The complex product a * b, without the special handling of infinities and NaNs that std::complex performs.
+ */
+template <typename T>
+inline std::complex<T> multiply(const std::complex<T> &a, const std::complex<T> &b) {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+/**
+ * @brief exp(-2 * pi * i * k / n), evaluated in long double and rounded once to T.
+ */
+template <typename T>
+inline std::complex<T> twiddle(const size_t k, const size_t n) {
+    const long double angle = -2.0L * M_PIl * static_cast<long double>(k) / static_cast<long double>(n);
+    return {static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+}
+
+/**
+ * @class Plan
+ * @brief The precomputed tables for complex transforms of one length.
+ *
+ * A length with no prime factor above MaxRadix is split into radix-4, radix-2 and odd prime stages of a mixed-radix
+ * Cooley-Tukey transform. Any other length is rewritten as a convolution with a chirp (Bluestein's algorithm), which
+ * is evaluated with transforms of the smallest length of at least 2n - 1 whose prime factors are 2, 3 and 5.
+ *
+ * A plan is immutable once built, so one plan can be shared by all threads. Each thread passes in its own workspace.
+ *
+ * @tparam T The type of the real and imaginary parts.
+ */
+template <typename T>
+class Plan {
+
+  public:
+    /**
+     * @brief The largest prime factor handled by a Cooley-Tukey stage. A radix-p stage costs p operations per value.
+     */
+    static constexpr size_t MaxRadix = 61;
+
+    /**
+     * @param _size The length of the transform. It may be any positive integer.
+     */
+    explicit Plan(const size_t _size) : length(_size) {
+        if (factorize()) {
+            roots.resize(length);
+            for (size_t k = 0; k < length; k++) {
+                roots[k] = twiddle<T>(k, length);
+            }
+        } else {
+            buildBluestein();
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return length; }
+
+    /**
+     * @brief The number of complex values the workspace passed to forward() must hold.
+     */
+    [[nodiscard]] size_t workspaceSize() const {
+        return inner ? inner->size() + inner->workspaceSize() : length + 2 * largestRadix;
+    }
+
+    /**
+     * @brief The forward transform X_k = sum_j x_j * exp(-2 * pi * i * j * k / n), in place.
+     * @param data The n values to transform.
+     * @param workspace At least workspaceSize() values, overwritten.
+     */
+    void forward(std::complex<T> *data, std::complex<T> *workspace) const {
+        if (inner) {
+            bluestein(data, workspace);
+        } else if (!radices.empty()) {
+            stockham(data, workspace, workspace + length);
+        }
+    }
+
+    /**
+     * @brief The inverse transform x_j = (1 / n) * sum_k X_k * exp(2 * pi * i * j * k / n), in place.
+     * @details Computed as the conjugate of the forward transform of the conjugate.
+     */
+    void inverse(std::complex<T> *data, std::complex<T> *workspace) const {
+        const T scale = static_cast<T>(1) / static_cast<T>(length);
+        for (size_t j = 0; j < length; j++) {
+            data[j] = std::conj(data[j]);
+        }
+        forward(data, workspace);
+        for (size_t j = 0; j < length; j++) {
+            data[j] = std::conj(data[j]) * scale;
+        }
+    }
+
+  private:
+    size_t length;
+    std::vector<size_t> radices;          ///< the radix of each Cooley-Tukey stage, outermost first
+    std::vector<std::vector<std::complex<T>>> kernels; ///< the DFT cosines and sines of each odd prime stage
+    size_t largestRadix = 0;
+    std::vector<std::complex<T>> roots;   ///< exp(-2 * pi * i * k / n) for k < n
+    std::vector<std::complex<T>> chirp;   ///< exp(-pi * i * k^2 / n) for k < n, for Bluestein's algorithm
+    std::vector<std::complex<T>> filter;  ///< the transform of the conjugate chirp, wrapped around the inner length
+    std::unique_ptr<Plan<T>> inner;       ///< the plan for the convolution in Bluestein's algorithm
+
+    /**
+     * @brief Splits the length into radices, preferring 4, and then 2 and the odd primes in increasing order.
+     * @return False if the length has a prime factor above MaxRadix.
+     */
+    bool factorize() {
+        size_t remaining = length;
+        for (; remaining % 4 == 0; remaining /= 4) {
+            radices.push_back(4);
+        }
+        for (; remaining % 2 == 0; remaining /= 2) {
+            radices.push_back(2);
+        }
+        for (size_t p = 3; remaining > 1; p += 2) {
+            if (p > MaxRadix) {
+                return false;
+            }
+            for (; remaining % p == 0; remaining /= p) {
+                radices.push_back(p);
+            }
+        }
+        largestRadix = radices.empty() ? 0 : *std::max_element(radices.begin(), radices.end());
+        kernels.resize(radices.size());
+        for (size_t stage = 0; stage < radices.size(); stage++) {
+            const size_t p = radices[stage];
+            if (p == 2 || p == 4) {
+                continue;
+            }
+            // cos and sin of 2 * pi * t * u / p, for 1 <= t, u <= (p - 1) / 2
+            const size_t h = p / 2;
+            kernels[stage].resize(h * h);
+            for (size_t t = 0; t < h; t++) {
+                for (size_t u = 0; u < h; u++) {
+                    const long double angle = 2.0L * M_PIl * static_cast<long double>((t + 1) * (u + 1) % p) / static_cast<long double>(p);
+                    kernels[stage][t * h + u] = {static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief The smallest integer of at least n whose only prime factors are 2, 3 and 5.
+     */
+    static size_t smoothLength(const size_t n) {
+        size_t best = 1;
+        while (best < n) {
+            best <<= 1;
+        }
+        for (size_t five = 1; five < 2 * n; five *= 5) {
+            for (size_t three = five; three < 2 * n; three *= 3) {
+                size_t candidate = three;
+                while (candidate < n) {
+                    candidate <<= 1;
+                }
+                best = std::min(best, candidate);
+            }
+        }
+        return best;
+    }
+
+    void buildBluestein() {
+        inner = std::make_unique<Plan<T>>(smoothLength(2 * length - 1));
+        const size_t padded = inner->size();
+
+        // k^2 is reduced modulo 2n before it is turned into an angle, which keeps the chirp accurate for large k
+        chirp.resize(length);
+        for (size_t k = 0; k < length; k++) {
+            chirp[k] = twiddle<T>((k * k) % (2 * length), 2 * length);
+        }
+
+        filter.assign(padded, std::complex<T>(0, 0));
+        filter[0] = std::conj(chirp[0]);
+        for (size_t k = 1; k < length; k++) {
+            filter[k] = filter[padded - k] = std::conj(chirp[k]);
+        }
+        std::vector<std::complex<T>> workspace(inner->workspaceSize());
+        inner->forward(filter.data(), workspace.data());
+    }
+
+    /**
+     * @brief The Stockham form of the Cooley-Tukey transform, which swaps between two buffers at each stage instead
+     * of permuting the values in place, and keeps the innermost loop at unit stride.
+     * @details A stage of radix p splits the current transform length l into p interleaved sequences of length
+     * l / p, stride s apart, each of which is transformed by the later stages, with s * l = n throughout.
+     */
+    void stockham(std::complex<T> *data, std::complex<T> *buffer, std::complex<T> *scratch) const {
+        std::complex<T> *x = data;
+        std::complex<T> *y = buffer;
+        size_t s = 1;
+        size_t stage = 0;
+        for (const size_t p : radices) {
+            const size_t m = length / (s * p);
+            switch (p) {
+            case 2:
+                butterfly2(x, y, s, m);
+                break;
+            case 4:
+                butterfly4(x, y, s, m);
+                break;
+            default:
+                butterfly(x, y, s, m, p, kernels[stage].data(), scratch);
+            }
+            std::swap(x, y);
+            stage++;
+            s *= p;
+        }
+        if (x != data) {
+            std::copy(x, x + length, data);
+        }
+    }
+
+    void butterfly2(const std::complex<T> *x, std::complex<T> *y, const size_t s, const size_t m) const {
+        for (size_t j = 0; j < m; j++) {
+            const std::complex<T> w = roots[j * s];
+            const std::complex<T> *x0 = x + s * j, *x1 = x + s * (j + m);
+            std::complex<T> *y0 = y + s * 2 * j, *y1 = y0 + s;
+            for (size_t q = 0; q < s; q++) {
+                const std::complex<T> a = x0[q], b = x1[q];
+                y0[q] = a + b;
+                y1[q] = multiply(a - b, w);
+            }
+        }
+    }
+
+    void butterfly4(const std::complex<T> *x, std::complex<T> *y, const size_t s, const size_t m) const {
+        if (s == 1) {
+            for (size_t j = 0; j < m; j++) {
+                const std::complex<T> s0 = x[j] + x[j + 2 * m], s1 = x[j] - x[j + 2 * m];
+                const std::complex<T> s2 = x[j + m] + x[j + 3 * m], s3 = x[j + m] - x[j + 3 * m];
+                const std::complex<T> s3i(s3.imag(), -s3.real());
+                y[4 * j] = s0 + s2;
+                y[4 * j + 1] = multiply(s1 + s3i, roots[j]);
+                y[4 * j + 2] = multiply(s0 - s2, roots[2 * j]);
+                y[4 * j + 3] = multiply(s1 - s3i, roots[3 * j]);
+            }
+            return;
+        }
+        for (size_t j = 0; j < m; j++) {
+            const std::complex<T> w1 = roots[j * s], w2 = roots[2 * j * s], w3 = roots[3 * j * s];
+            const std::complex<T> *x0 = x + s * j, *x1 = x0 + s * m, *x2 = x1 + s * m, *x3 = x2 + s * m;
+            std::complex<T> *y0 = y + s * 4 * j, *y1 = y0 + s, *y2 = y1 + s, *y3 = y2 + s;
+            for (size_t q = 0; q < s; q++) {
+                const std::complex<T> s0 = x0[q] + x2[q], s1 = x0[q] - x2[q];
+                const std::complex<T> s2 = x1[q] + x3[q], s3 = x1[q] - x3[q];
+                // -i * s3
+                const std::complex<T> s3i(s3.imag(), -s3.real());
+                y0[q] = s0 + s2;
+                y1[q] = multiply(s1 + s3i, w1);
+                y2[q] = multiply(s0 - s2, w2);
+                y3[q] = multiply(s1 - s3i, w3);
+            }
+        }
+    }
+
+    /**
+     * @brief A radix-p stage for an odd prime p, with a direct DFT of length p.
+     * @details Pairing the inputs t and p - t, and the outputs u and p - u, which share cos(2 * pi * t * u / p) and
+     * differ in the sign of the sine, takes a quarter of the multiplications of the plain DFT. All outputs are
+     * accumulated at once, one pair of inputs at a time, so that the sums are independent.
+     */
+    void butterfly(const std::complex<T> *x, std::complex<T> *y, const size_t s, const size_t m, const size_t p,
+                   const std::complex<T> *kernel, std::complex<T> *scratch) const {
+        const size_t h = p / 2;
+        std::complex<T> *even = scratch, *odd = scratch + h;       // a_t + a_(p-t) and a_t - a_(p-t)
+        std::complex<T> *cosines = scratch + p, *sines = cosines + h; // the sums for the outputs u and p - u
+        for (size_t j = 0; j < m; j++) {
+            for (size_t q = 0; q < s; q++) {
+                const std::complex<T> *in = x + q + s * j;
+                const std::complex<T> a0 = in[0];
+                std::complex<T> total = a0;
+                for (size_t t = 1; t <= h; t++) {
+                    const std::complex<T> a = in[s * m * t], b = in[s * m * (p - t)];
+                    even[t - 1] = a + b;
+                    odd[t - 1] = a - b;
+                    total += even[t - 1];
+                }
+                for (size_t u = 0; u < h; u++) {
+                    cosines[u] = a0;
+                    sines[u] = std::complex<T>(0, 0);
+                }
+                for (size_t t = 0; t < h; t++) {
+                    const std::complex<T> e = even[t], o = odd[t];
+                    const std::complex<T> *row = kernel + t * h;
+                    for (size_t u = 0; u < h; u++) {
+                        cosines[u] += e * row[u].real();
+                        sines[u] += o * row[u].imag();
+                    }
+                }
+
+                std::complex<T> *out = y + q + s * p * j;
+                out[0] = total;
+                for (size_t u = 1; u <= h; u++) {
+                    // -i * sines and +i * sines
+                    const std::complex<T> c = cosines[u - 1], si(sines[u - 1].imag(), -sines[u - 1].real());
+                    out[s * u] = multiply(c + si, roots[j * u * s]);
+                    out[s * (p - u)] = multiply(c - si, roots[j * (p - u) * s]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @details With jk = (j^2 + k^2 - (k - j)^2) / 2, the transform becomes X_k = c_k * sum_j (x_j * c_j) * conj(c_(k-j)),
+     * where c is the chirp. The sum is a convolution, evaluated as a product of transforms of the inner length.
+     */
+    void bluestein(std::complex<T> *data, std::complex<T> *workspace) const {
+        const size_t padded = inner->size();
+        std::complex<T> *innerWorkspace = workspace + padded;
+        for (size_t j = 0; j < length; j++) {
+            workspace[j] = multiply(data[j], chirp[j]);
+        }
+        for (size_t j = length; j < padded; j++) {
+            workspace[j] = std::complex<T>(0, 0);
+        }
+        inner->forward(workspace, innerWorkspace);
+        for (size_t j = 0; j < padded; j++) {
+            workspace[j] = std::conj(multiply(workspace[j], filter[j]));
+        }
+        // the inverse transform, as the conjugate of the forward transform of the conjugate
+        inner->forward(workspace, innerWorkspace);
+        const T scale = static_cast<T>(1) / static_cast<T>(padded);
+        for (size_t k = 0; k < length; k++) {
+            data[k] = multiply(std::conj(workspace[k]), chirp[k]) * scale;
+        }
+    }
+};
+
+/**
+ * @class SinePlan
+ * @brief The type-I discrete sine transform X_k = sum_{j=1}^{N} x_j * sin(pi * j * k / (N + 1)), for k = 1, ..., N.
+ *
+ * The transform is read off the complex transform of the odd extension (0, x_1, ..., x_N, 0, -x_N, ..., -x_1), of
+ * length 2 * (N + 1). That transform is purely imaginary, -2i * X_k, so two real sequences are packed into the real and
+ * imaginary parts of one complex transform, and separated again from its real and imaginary parts. Applying the
+ * transform twice gives back the input scaled by (N + 1) / 2.
+ *
+ * @tparam T The type of the values.
+ */
+template <typename T>
+class SinePlan {
+
+  public:
+    /**
+     * @brief The per-thread buffers of a transform.
+     */
+    struct Workspace {
+        std::vector<std::complex<T>> extension;
+        std::vector<std::complex<T>> scratch;
+    };
+
+    /**
+     * @param _size The length N of the sequences.
+     */
+    explicit SinePlan(const size_t _size) : length(_size), fft(2 * (_size + 1)) {}
+
+    [[nodiscard]] size_t size() const { return length; }
+
+    [[nodiscard]] Workspace workspace() const {
+        return {std::vector<std::complex<T>>(fft.size()), std::vector<std::complex<T>>(fft.workspaceSize())};
+    }
+
+    /**
+     * @brief Transforms one or two sequences in place.
+     * @param a The first sequence of N values.
+     * @param b The second sequence of N values, or nullptr.
+     * @param work The buffers from workspace().
+     */
+    void transform(T *a, T *b, Workspace &work) const {
+        std::complex<T> *z = work.extension.data();
+        const size_t extended = fft.size();
+        z[0] = z[length + 1] = std::complex<T>(0, 0);
+        for (size_t j = 0; j < length; j++) {
+            const std::complex<T> value(a[j], b ? b[j] : static_cast<T>(0));
+            z[j + 1] = value;
+            z[extended - 1 - j] = -value;
+        }
+        fft.forward(z, work.scratch.data());
+        for (size_t k = 0; k < length; k++) {
+            a[k] = static_cast<T>(-0.5) * z[k + 1].imag();
+            if (b) {
+                b[k] = static_cast<T>(0.5) * z[k + 1].real();
+            }
+        }
+    }
+
+  private:
+    size_t length;
+    Plan<T> fft;
+};
+
+} // namespace FFT
+
+#endif // NE591_008_FFT_H
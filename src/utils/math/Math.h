@@ -45,7 +45,7 @@ bool isfinite(T value) {
  * @return true if the value is finite, false otherwise.
  */
 template <>
-bool isfinite(__float128 value) {
+inline bool isfinite(__float128 value) {
     // Check if value is within the range of finite values for __float128
     return (value > -__float128(INFINITY) && value < __float128(INFINITY));
 }
@@ -71,7 +71,7 @@ T pow(T base, int exponent) {
  * @return The result of the base number raised to the exponent.
  */
 template <>
-__float128 pow(__float128 base, int exponent) {
+inline __float128 pow(__float128 base, int exponent) {
     if (exponent == 0)
         return 1.0;
     if (exponent == 1)
@@ -9,9 +9,14 @@
 #define NE591_008_STATS_H
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <map>
 #include <numeric>
 #include <ostream>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "utils/json.hpp"
@@ -41,7 +46,43 @@ struct Summary {
     T p5th = std::numeric_limits<T>::quiet_NaN(); ///< The 5th percentile.
     T p95th = std::numeric_limits<T>::quiet_NaN(); ///< The 95th percentile.
     size_t runs{};
-    size_t maxBytes = std::numeric_limits<size_t>::quiet_NaN();
+    size_t warmup = 0; ///< The untimed runs before the timed ones.
+    size_t outliers = 0; ///< The runs whose modified z-score, from the median and MAD, is above 3.5.
+    T confidence = std::numeric_limits<T>::quiet_NaN(); ///< The confidence level of the intervals.
+    std::pair<T, T> ciMedian{std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()}; ///< The bootstrap interval of the median.
+    std::pair<T, T> ciMean{std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()}; ///< The bootstrap interval of the mean.
+    size_t maxBytes = std::numeric_limits<size_t>::quiet_NaN(); ///< The peak heap bytes held by the monitored containers.
+    size_t peakResidentBytes = 0; ///< The peak resident set size of the process, or 0 where it is unavailable.
+    std::vector<std::array<T, 3>> memory{}; ///< The memory over the runs: time [ns], container bytes, resident bytes.
+    std::map<std::string, T> counters{}; ///< The mean count per run of each available performance counter, by event key.
+
+    /**
+     * @brief The ratios the analysis needs, derived from the counters that are available.
+     * @details Instructions per cycle, cache and branch misses per thousand instructions, and the CPU utilization,
+     * i.e. the task clock over the wall time, which is the average number of busy threads.
+     * @return The ratios, by key.
+     */
+    [[nodiscard]] std::map<std::string, T> counterRatios() const {
+        std::map<std::string, T> ratios;
+        const auto available = [this](const char *key) { return counters.count(key) && counters.at(key) > 0; };
+        if (available("instructions")) {
+            const T instructions = counters.at("instructions");
+            if (available("cycles")) {
+                ratios["ipc"] = instructions / counters.at("cycles");
+            }
+            const std::pair<const char *, const char *> rates[] = {
+                {"l1d-misses", "l1d-mpki"}, {"llc-misses", "llc-mpki"}, {"branch-misses", "branch-mpki"}};
+            for (const auto &[misses, rate] : rates) {
+                if (counters.count(misses)) {
+                    ratios[rate] = 1000 * counters.at(misses) / instructions;
+                }
+            }
+        }
+        if (available("task-clock-ns") && mean > 0) {
+            ratios["cpu-utilization"] = counters.at("task-clock-ns") / mean;
+        }
+        return ratios;
+    }
 
     /**
      * @brief Overloaded stream insertion operator to print the summary statistics.
@@ -58,16 +99,266 @@ struct Summary {
         os << ":::::: {" << summary.min << ", " << summary.max << "} ";
         os << ": (" << summary.mean << " ± " << summary.stddev << ") : [";
         os << summary.p5th << ", "<< summary.p95th << "] :::::";
-        os << "\n:::::: Estimated maximum allocated memory [bytes]: "<<summary.maxBytes<<" ::::::::::::::::::::::::";
+        if (!std::isnan(summary.confidence)) {
+            os << "\n:::::: " << std::fixed << std::setprecision(0) << 100 * summary.confidence << "% CI" << std::scientific << std::setprecision(2);
+            os << " MEDIAN: [" << summary.ciMedian.first << ", " << summary.ciMedian.second << "] :::::::: MEAN: [";
+            os << summary.ciMean.first << ", " << summary.ciMean.second << "] :::::::: OUTLIERS: " << summary.outliers;
+            os << " :::::::: WARMUP: " << summary.warmup;
+        }
+        os << "\n:::::: Peak container memory [bytes]: "<<summary.maxBytes<<" :::::::: Peak resident memory [bytes]: "<<summary.peakResidentBytes;
+        if (!summary.memory.empty()) {
+            os << "\n:::::: Memory samples: " << summary.memory.size() << " over " << summary.memory.back()[0] << " ns";
+        }
+        if (!summary.counters.empty()) {
+            os << "\n:::::: Performance counters [per run]:";
+            for (const auto &[key, value] : summary.counters) {
+                os << " " << key << ": " << value;
+            }
+            os << "\n:::::: Derived:";
+            for (const auto &[key, value] : summary.counterRatios()) {
+                os << " " << key << ": " << value;
+            }
+        }
         os << std::setprecision(static_cast<int>(precision));
         return os;
     }
 
     void toJSON(nlohmann::json &jsonMap) const {
         jsonMap["mean"] = mean;
+        jsonMap["median"] = median;
         jsonMap["p5th"] = p5th;
         jsonMap["p95th"] = p95th;
         jsonMap["samples"] = runs;
+        if (!std::isnan(confidence)) {
+            jsonMap["confidence"] = confidence;
+            jsonMap["ci-median"] = {ciMedian.first, ciMedian.second};
+            jsonMap["ci-mean"] = {ciMean.first, ciMean.second};
+            jsonMap["outliers"] = outliers;
+            jsonMap["warmup"] = warmup;
+        }
+    }
+
+    /**
+     * @brief Writes the memory samples as three arrays of the same length.
+     */
+    void memoryToJSON(nlohmann::json &jsonMap) const {
+        std::vector<T> times, bytes, residentBytes;
+        for (const auto &[time, held, resident] : memory) {
+            times.push_back(time);
+            bytes.push_back(held);
+            residentBytes.push_back(resident);
+        }
+        jsonMap["time-ns"] = times;
+        jsonMap["bytes"] = bytes;
+        jsonMap["rss-bytes"] = residentBytes;
+    }
+
+    /**
+     * @brief Writes the mean performance counters per run, and the ratios derived from them.
+     */
+    void countersToJSON(nlohmann::json &jsonMap) const {
+        for (const auto &[key, value] : counters) {
+            jsonMap[key] = value;
+        }
+        for (const auto &[key, value] : counterRatios()) {
+            jsonMap[key] = value;
+        }
+    }
+};
+
+/**
+ * @brief The two-sided critical value of Student's t distribution, from its Cornish-Fisher expansion around the normal
+ * one, which at 95% is within 1% of the exact value from 3 degrees of freedom up.
+ * @param confidence The confidence level, e.g. 0.95.
+ * @param degrees The degrees of freedom.
+ */
+template <typename T>
+T studentT(const T confidence, const size_t degrees) {
+    if (degrees == 0) {
+        return std::numeric_limits<T>::infinity();
+    }
+    // the normal quantile, by bisection on its tail probability, which halves the bracket down to machine precision
+    const T tail = (1 - confidence) / 2;
+    T low = 0, high = 40;
+    for (size_t iteration = 0; iteration < 128; iteration++) {
+        const T middle = (low + high) / 2;
+        (std::erfc(middle / std::sqrt(static_cast<T>(2))) / 2 > tail ? low : high) = middle;
+    }
+    const T z = (low + high) / 2;
+    const T v = static_cast<T>(degrees), z3 = z * z * z, z5 = z3 * z * z, z7 = z5 * z * z;
+    return z + (z3 + z) / (4 * v) + (5 * z5 + 16 * z3 + 3 * z) / (96 * v * v) +
+           (3 * z7 + 19 * z5 + 17 * z3 - 15 * z) / (384 * v * v * v);
+}
+
+/**
+ * @class Samples
+ * @brief Accumulates samples one at a time, for benchmark statistics.
+ *
+ * The count, mean, variance, minimum and maximum are updated as each sample is added, with Welford's method, so they
+ * can be read after every sample, e.g. to decide when to stop sampling. The samples themselves are kept in a single
+ * array, which is sorted in place the first time an order statistic is asked for, so that every percentile after that
+ * is a lookup rather than a copy and a selection.
+ *
+ * @tparam T The type of the samples.
+ */
+template <typename T>
+class Samples {
+  public:
+    /**
+     * @brief Adds a sample.
+     */
+    void add(const T value) {
+        _values.push_back(value);
+        _sorted = _values.size() == 1;
+        const T delta = value - _mean;
+        _mean += delta / static_cast<T>(_values.size());
+        _squares += delta * (value - _mean);
+        _sum += value;
+        _min = _values.size() == 1 ? value : std::min(_min, value);
+        _max = _values.size() == 1 ? value : std::max(_max, value);
+    }
+
+    void clear() { *this = Samples(); }
+
+    [[nodiscard]] size_t size() const { return _values.size(); }
+    [[nodiscard]] bool empty() const { return _values.empty(); }
+    [[nodiscard]] T sum() const { return empty() ? NaN() : _sum; }
+    [[nodiscard]] T mean() const { return empty() ? NaN() : _mean; }
+    [[nodiscard]] T min() const { return empty() ? NaN() : _min; }
+    [[nodiscard]] T max() const { return empty() ? NaN() : _max; }
+
+    /**
+     * @brief The population variance, as Stats::variance computes it.
+     */
+    [[nodiscard]] T variance() const { return empty() ? NaN() : _squares / static_cast<T>(size()); }
+
+    /**
+     * @brief The unbiased sample variance, which the confidence intervals use.
+     */
+    [[nodiscard]] T sampleVariance() const { return size() < 2 ? NaN() : _squares / static_cast<T>(size() - 1); }
+
+    /**
+     * @brief The p-th percentile, interpolated between the closest ranks, as Stats::percentile computes it.
+     */
+    T percentile(const long double p) {
+        if (p < 0 || p > 100) {
+            throw std::invalid_argument("Percentile must be between 0 and 100");
+        }
+        if (empty()) {
+            return NaN();
+        }
+        sort();
+        return interpolate(_values, p);
+    }
+
+    T median() { return percentile(50); }
+
+    /**
+     * @brief The median absolute deviation from the median.
+     */
+    T medianAbsoluteDeviation() {
+        if (empty()) {
+            return NaN();
+        }
+        const T center = median();
+        std::vector<T> deviations(_values.size());
+        std::transform(_values.begin(), _values.end(), deviations.begin(), [center](const T value) { return std::abs(value - center); });
+        std::sort(deviations.begin(), deviations.end());
+        return interpolate(deviations, 50);
+    }
+
+    /**
+     * @brief Counts the outliers by their modified z-score, 0.6745 (x - median) / MAD, which Iglewicz and Hoaglin
+     * recommend flagging above 3.5. Unlike the standard deviation, the MAD is not inflated by the outliers themselves.
+     * @param threshold The score above which a sample is an outlier.
+     */
+    size_t outliers(const T threshold = static_cast<T>(3.5)) {
+        const T mad = medianAbsoluteDeviation();
+        if (empty() || !(mad > 0)) {
+            return 0;
+        }
+        const T center = median();
+        return static_cast<size_t>(std::count_if(_values.begin(), _values.end(), [&](const T value) {
+            return static_cast<T>(0.6745) * std::abs(value - center) / mad > threshold;
+        }));
+    }
+
+    /**
+     * @brief The half-width of the Student's t confidence interval of the mean, relative to the mean. This is cheap
+     * enough to check after every sample.
+     * @param confidence The confidence level, e.g. 0.95.
+     */
+    [[nodiscard]] T relativeHalfWidth(const T confidence) const {
+        if (size() < 2 || _mean == 0) {
+            return std::numeric_limits<T>::infinity();
+        }
+        const T standardError = std::sqrt(sampleVariance() / static_cast<T>(size()));
+        return studentT(confidence, size() - 1) * standardError / std::abs(_mean);
+    }
+
+    /**
+     * @brief Percentile bootstrap confidence intervals of the median and the mean.
+     * @details Each resample draws size() samples with replacement, and the intervals are the percentiles of the
+     * resampled medians and means. The generator is seeded with a constant, so the same samples give the same intervals.
+     * @param confidence The confidence level, e.g. 0.95.
+     * @param resamples The number of resamples.
+     * @return The lower and upper bounds of the median, then of the mean.
+     */
+    std::array<T, 4> bootstrap(const T confidence, const size_t resamples = 2000) const {
+        if (empty() || resamples == 0) {
+            return {NaN(), NaN(), NaN(), NaN()};
+        }
+        const size_t n = size();
+        std::mt19937_64 generator(n);
+        std::uniform_int_distribution<size_t> pick(0, n - 1);
+        std::vector<T> resample(n), medians(resamples), means(resamples);
+        for (size_t b = 0; b < resamples; b++) {
+            T total = 0;
+            for (size_t i = 0; i < n; i++) {
+                resample[i] = _values[pick(generator)];
+                total += resample[i];
+            }
+            means[b] = total / static_cast<T>(n);
+            // the interpolated median, as percentile(50) computes it
+            const size_t middle = (n - 1) / 2;
+            std::nth_element(resample.begin(), resample.begin() + static_cast<std::ptrdiff_t>(middle), resample.end());
+            medians[b] = resample[middle];
+            if (n % 2 == 0) {
+                medians[b] = (medians[b] + *std::min_element(resample.begin() + static_cast<std::ptrdiff_t>(middle) + 1, resample.end())) / 2;
+            }
+        }
+        std::sort(medians.begin(), medians.end());
+        std::sort(means.begin(), means.end());
+        const long double lower = 50 * (1 - static_cast<long double>(confidence)), upper = 100 - lower;
+        return {interpolate(medians, lower), interpolate(medians, upper), interpolate(means, lower), interpolate(means, upper)};
+    }
+
+  private:
+    std::vector<T> _values;
+    bool _sorted = true;
+    T _sum = 0;
+    T _mean = 0;
+    T _squares = 0; ///< The sum of squared deviations from the running mean.
+    T _min = 0;
+    T _max = 0;
+
+    static T NaN() { return std::numeric_limits<T>::quiet_NaN(); }
+
+    void sort() {
+        if (!_sorted) {
+            std::sort(_values.begin(), _values.end());
+            _sorted = true;
+        }
+    }
+
+    static T interpolate(const std::vector<T> &sorted, const long double p) {
+        const long double rank = (p / 100) * static_cast<long double>(sorted.size() - 1);
+        const auto index = static_cast<size_t>(rank);
+        const T fractional = static_cast<T>(rank - static_cast<long double>(index));
+        if (index + 1 >= sorted.size() || fractional == 0) {
+            return sorted[index];
+        }
+        return sorted[index] + fractional * (sorted[index + 1] - sorted[index]);
     }
 };
 
@@ -0,0 +1,184 @@
+/**
+* @file AlignedBuffer.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief Owning, over-aligned contiguous buffer used as the storage of the dense matrix types.
+*/
+
+#ifndef NE591_008_MYBLAS_ALIGNEDBUFFER_H
+#define NE591_008_MYBLAS_ALIGNEDBUFFER_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MyBLAS {
+
+/**
+ * @brief Alignment, in bytes, of the dense matrix buffers. One cache line, which also covers AVX-512 loads.
+ */
+constexpr size_t CacheLineBytes = 64;
+
+/**
+ * @class AlignedBuffer
+ * @brief A minimal std::vector-like array whose storage starts on an Alignment byte boundary.
+ *
+ * Unlike std::vector<T, Allocator>, this is never bit-packed for bool, so data() and element references are always
+ * available. Growing the buffer keeps the existing elements.
+ *
+ * @tparam T The element type. Must be trivially copyable.
+ * @tparam Alignment The alignment in bytes, a power of two no smaller than alignof(T).
+ * @tparam Monitor If not void, a class with static recordAllocation(bytes) and recordDeallocation(bytes) members,
+ * such as a ResourceMonitor, which is told about every allocation and release of the storage.
+ */
+template <typename T, size_t Alignment = CacheLineBytes, typename Monitor = void>
+class AlignedBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "AlignedBuffer only holds trivially copyable types");
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must be at least the natural alignment of T");
+
+  public:
+    using value_type = T;
+
+    AlignedBuffer() = default;
+
+    /**
+     * @brief Constructs a buffer of count elements, all set to value.
+     */
+    explicit AlignedBuffer(const size_t count, const T value = T()) { assign(count, value); }
+
+    AlignedBuffer(const AlignedBuffer &other) {
+        reserve(other._size);
+        std::copy(other.begin(), other.end(), _data);
+        _size = other._size;
+    }
+
+    AlignedBuffer(AlignedBuffer &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+          _capacity(std::exchange(other._capacity, 0)) {}
+
+    AlignedBuffer &operator=(const AlignedBuffer &other) {
+        if (this != &other) {
+            if (_capacity < other._size) {
+                release();
+                reserve(other._size);
+            }
+            std::copy(other.begin(), other.end(), _data);
+            _size = other._size;
+        }
+        return *this;
+    }
+
+    AlignedBuffer &operator=(AlignedBuffer &&other) noexcept {
+        if (this != &other) {
+            release();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, 0);
+        }
+        return *this;
+    }
+
+    ~AlignedBuffer() { release(); }
+
+    /**
+     * @brief Replaces the contents with count copies of value.
+     */
+    void assign(const size_t count, const T value) {
+        if (_capacity < count) {
+            release();
+            reserve(count);
+        }
+        std::fill(_data, _data + count, value);
+        _size = count;
+    }
+
+    /**
+     * @brief Resizes to count elements, keeping the existing ones and setting any new ones to value.
+     */
+    void resize(const size_t count, const T value = T()) {
+        if (_capacity < count) {
+            reserve(std::max(count, 2 * _capacity));
+        }
+        if (count > _size) {
+            std::fill(_data + _size, _data + count, value);
+        }
+        _size = count;
+    }
+
+    /**
+     * @brief Grows the storage to hold at least count elements, keeping the existing ones.
+     */
+    void reserve(const size_t count) {
+        if (count <= _capacity) {
+            return;
+        }
+        T *grown = static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        if constexpr (!std::is_void_v<Monitor>) {
+            Monitor::recordAllocation(count * sizeof(T));
+        }
+        if (_data != nullptr) {
+            std::copy(_data, _data + _size, grown);
+            deallocate();
+        }
+        _data = grown;
+        _capacity = count;
+    }
+
+    /**
+     * @brief Drops the elements. The storage is released too, so that capacity() reports the memory actually held.
+     */
+    void clear() {
+        release();
+    }
+
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] size_t capacity() const { return _capacity; }
+    [[nodiscard]] bool empty() const { return _size == 0; }
+
+    [[nodiscard]] T *data() { return _data; }
+    [[nodiscard]] const T *data() const { return _data; }
+
+    T *begin() { return _data; }
+    T *end() { return _data + _size; }
+    const T *begin() const { return _data; }
+    const T *end() const { return _data + _size; }
+
+    T &operator[](const size_t index) {
+        assert(index < _size);
+        return _data[index];
+    }
+
+    const T &operator[](const size_t index) const {
+        assert(index < _size);
+        return _data[index];
+    }
+
+  private:
+    T *_data = nullptr;
+    size_t _size = 0;
+    size_t _capacity = 0;
+
+    void deallocate() {
+        ::operator delete(_data, std::align_val_t(Alignment));
+        if constexpr (!std::is_void_v<Monitor>) {
+            Monitor::recordDeallocation(_capacity * sizeof(T));
+        }
+    }
+
+    void release() {
+        if (_data != nullptr) {
+            deallocate();
+        }
+        _data = nullptr;
+        _size = 0;
+        _capacity = 0;
+    }
+};
+
+} // namespace MyBLAS
+
+#endif // NE591_008_MYBLAS_ALIGNEDBUFFER_H
@@ -313,7 +313,7 @@ bool isPositiveDefiniteMatrix(const M<T> &A) {
     M<T> L(n, n, static_cast<T>(0)); // Initialize lower triangular matrix
 
     bool isPositiveDefinite = true;
-    #pragma omp parallel for simd default(none) shared(L, A) reduction(|:isPositiveDefinite)
+    #pragma omp parallel for simd default(none) shared(L, A, n) reduction(|:isPositiveDefinite)
     for (size_t i = 0; i < n; ++i) {
         for (size_t j = 0; j <= i; ++j) {
             T sum = 0;
@@ -0,0 +1,349 @@
+/**
+* @file GEMM.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief Cache-blocked, packed, register-tiled general matrix-matrix multiply, C = alpha * A * B + beta * C.
+* @details All matrices are row-major with an explicit leading dimension, which is how MyBLAS::Matrix stores them.
+*
+* The product is computed the way BLIS-style kernels do it. B is packed one KC x NC block at a time into NR-wide
+* panels, shared by all threads. Each thread then packs an MC x KC block of A into MR-tall panels and sweeps MR x NR
+* micro-tiles over the two packed blocks. The micro-kernel keeps the whole MR x NR tile of C in registers and streams
+* through the packed panels with unit stride, so A and B are each read from memory once per block instead of once per
+* element of C. The MC blocks are distributed over the OpenMP threads.
+*
+* When the compiler targets AVX-512 or AVX2+FMA (e.g. the NON_PORTABLE_CXX_FLAGS -march=native build), the float and
+* double micro-kernels use those instructions. Otherwise they fall back to a portable scalar micro-kernel with the same
+* blocking. All other types, and tiny products, skip the packing and run an unblocked i-k-j loop.
+*/
+
+#ifndef NE591_008_MYBLAS_GEMM_H
+#define NE591_008_MYBLAS_GEMM_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+#include "math/blas/AlignedBuffer.h"
+
+namespace MyBLAS {
+
+namespace GEMM {
+
+/**
+ * @brief Portable SIMD abstraction: one "vector" is a single scalar.
+ */
+template <typename T>
+struct SimdTraits {
+    using Vec = T;
+    static constexpr size_t lanes = 1;
+    static Vec zero() { return static_cast<T>(0); }
+    static Vec load(const T *p) { return *p; }
+    static void store(T *p, const Vec v) { *p = v; }
+    static Vec broadcast(const T value) { return value; }
+    static Vec add(const Vec a, const Vec b) { return a + b; }
+    static Vec fmadd(const Vec a, const Vec b, const Vec c) { return a * b + c; }
+};
+
+#if defined(__AVX512F__)
+template <>
+struct SimdTraits<double> {
+    using Vec = __m512d;
+    static constexpr size_t lanes = 8;
+    static Vec zero() { return _mm512_setzero_pd(); }
+    static Vec load(const double *p) { return _mm512_loadu_pd(p); }
+    static void store(double *p, const Vec v) { _mm512_storeu_pd(p, v); }
+    static Vec broadcast(const double value) { return _mm512_set1_pd(value); }
+    static Vec add(const Vec a, const Vec b) { return _mm512_add_pd(a, b); }
+    static Vec fmadd(const Vec a, const Vec b, const Vec c) { return _mm512_fmadd_pd(a, b, c); }
+};
+
+template <>
+struct SimdTraits<float> {
+    using Vec = __m512;
+    static constexpr size_t lanes = 16;
+    static Vec zero() { return _mm512_setzero_ps(); }
+    static Vec load(const float *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, const Vec v) { _mm512_storeu_ps(p, v); }
+    static Vec broadcast(const float value) { return _mm512_set1_ps(value); }
+    static Vec add(const Vec a, const Vec b) { return _mm512_add_ps(a, b); }
+    static Vec fmadd(const Vec a, const Vec b, const Vec c) { return _mm512_fmadd_ps(a, b, c); }
+};
+#elif defined(__AVX2__) && defined(__FMA__)
+template <>
+struct SimdTraits<double> {
+    using Vec = __m256d;
+    static constexpr size_t lanes = 4;
+    static Vec zero() { return _mm256_setzero_pd(); }
+    static Vec load(const double *p) { return _mm256_loadu_pd(p); }
+    static void store(double *p, const Vec v) { _mm256_storeu_pd(p, v); }
+    static Vec broadcast(const double value) { return _mm256_set1_pd(value); }
+    static Vec add(const Vec a, const Vec b) { return _mm256_add_pd(a, b); }
+    static Vec fmadd(const Vec a, const Vec b, const Vec c) { return _mm256_fmadd_pd(a, b, c); }
+};
+
+template <>
+struct SimdTraits<float> {
+    using Vec = __m256;
+    static constexpr size_t lanes = 8;
+    static Vec zero() { return _mm256_setzero_ps(); }
+    static Vec load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, const Vec v) { _mm256_storeu_ps(p, v); }
+    static Vec broadcast(const float value) { return _mm256_set1_ps(value); }
+    static Vec add(const Vec a, const Vec b) { return _mm256_add_ps(a, b); }
+    static Vec fmadd(const Vec a, const Vec b, const Vec c) { return _mm256_fmadd_ps(a, b, c); }
+};
+#endif
+
+/**
+ * @brief Register and cache blocking parameters for a given element type.
+ * @details The micro-tile is MR rows by NV vectors. With 6 x 2 vector accumulators, plus the two B vectors and the A
+ * broadcast, the tile fits in the 16 registers of AVX2. KC x NR panels of B stay in L1, MC x KC blocks of A in L2.
+ */
+template <typename T>
+struct Blocking {
+    static constexpr bool vectorized = SimdTraits<T>::lanes > 1;
+    static constexpr size_t MR = vectorized ? 6 : 4;
+    static constexpr size_t NV = vectorized ? 2 : 4;
+    static constexpr size_t NR = NV * SimdTraits<T>::lanes;
+    static constexpr size_t KC = 256;
+    static constexpr size_t MC = MR * 16;
+    static constexpr size_t NC = NR * 128;
+};
+
+/**
+ * @brief Products with fewer multiply-adds than this are not worth packing.
+ */
+constexpr size_t SmallProductThreshold = 32 * 32 * 32;
+
+/**
+ * @brief Unblocked i-k-j product, C += alpha * A * B. Used for small products and for types other than float and double.
+ */
+template <typename T>
+void reference(const size_t m, const size_t n, const size_t k, const T alpha, const T *A, const size_t lda,
+               const T *B, const size_t ldb, T *C, const size_t ldc) {
+    #pragma omp parallel for default(none) shared(m, n, k, alpha, A, lda, B, ldb, C, ldc) if (m * n * k > SmallProductThreshold)
+    for (size_t i = 0; i < m; ++i) {
+        T *c_row = C + i * ldc;
+        for (size_t p = 0; p < k; ++p) {
+            const T a_ip = alpha * A[i * lda + p];
+            const T *b_row = B + p * ldb;
+            #pragma omp simd
+            for (size_t j = 0; j < n; ++j) {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Packs an mc x kc block of A, scaled by alpha, into MR-tall column-major panels, zero-padding the last one.
+ */
+template <typename T>
+void packA(const size_t mc, const size_t kc, const T alpha, const T *A, const size_t lda, T *packed) {
+    constexpr size_t MR = Blocking<T>::MR;
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        const size_t mr = std::min(MR, mc - ir);
+        T *panel = packed + ir * kc;
+        for (size_t p = 0; p < kc; ++p) {
+            for (size_t i = 0; i < mr; ++i) {
+                panel[p * MR + i] = alpha * A[(ir + i) * lda + p];
+            }
+            for (size_t i = mr; i < MR; ++i) {
+                panel[p * MR + i] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Packs the NR-wide panel starting at column jr of a kc x nc block of B, zero-padding past column nc.
+ */
+template <typename T>
+void packBPanel(const size_t jr, const size_t nc, const size_t kc, const T *B, const size_t ldb, T *packed) {
+    constexpr size_t NR = Blocking<T>::NR;
+    const size_t nr = std::min(NR, nc - jr);
+    T *panel = packed + jr * kc;
+    for (size_t p = 0; p < kc; ++p) {
+        const T *b_row = B + p * ldb + jr;
+        T *destination = panel + p * NR;
+        std::copy(b_row, b_row + nr, destination);
+        std::fill(destination + nr, destination + NR, static_cast<T>(0));
+    }
+}
+
+/**
+ * @brief Computes the MR x NR tile C += a * b from an MR-tall panel of A and an NR-wide panel of B.
+ * @param kc Depth of the panels.
+ * @param a Packed panel of A.
+ * @param b Packed panel of B.
+ * @param C Top-left element of the tile.
+ * @param ldc Leading dimension of C.
+ * @param mr Number of valid rows in the tile, at most MR.
+ * @param nr Number of valid columns in the tile, at most NR.
+ */
+template <typename T>
+void microKernel(const size_t kc, const T *a, const T *b, T *C, const size_t ldc, const size_t mr, const size_t nr) {
+    using S = SimdTraits<T>;
+    constexpr size_t MR = Blocking<T>::MR, NV = Blocking<T>::NV, NR = Blocking<T>::NR, lanes = S::lanes;
+
+    typename S::Vec accumulator[MR][NV];
+    for (size_t i = 0; i < MR; ++i) {
+        for (size_t v = 0; v < NV; ++v) {
+            accumulator[i][v] = S::zero();
+        }
+    }
+
+    for (size_t p = 0; p < kc; ++p) {
+        typename S::Vec b_vectors[NV];
+        for (size_t v = 0; v < NV; ++v) {
+            b_vectors[v] = S::load(b + p * NR + v * lanes);
+        }
+        for (size_t i = 0; i < MR; ++i) {
+            const typename S::Vec a_broadcast = S::broadcast(a[p * MR + i]);
+            for (size_t v = 0; v < NV; ++v) {
+                accumulator[i][v] = S::fmadd(a_broadcast, b_vectors[v], accumulator[i][v]);
+            }
+        }
+    }
+
+    if (mr == MR && nr == NR) {
+        for (size_t i = 0; i < MR; ++i) {
+            for (size_t v = 0; v < NV; ++v) {
+                T *c = C + i * ldc + v * lanes;
+                S::store(c, S::add(S::load(c), accumulator[i][v]));
+            }
+        }
+        return;
+    }
+
+    // edge tile, spill the accumulators and only add the valid part
+    alignas(CacheLineBytes) T tile[MR * NR];
+    for (size_t i = 0; i < MR; ++i) {
+        for (size_t v = 0; v < NV; ++v) {
+            S::store(tile + i * NR + v * lanes, accumulator[i][v]);
+        }
+    }
+    for (size_t i = 0; i < mr; ++i) {
+        for (size_t j = 0; j < nr; ++j) {
+            C[i * ldc + j] += tile[i * NR + j];
+        }
+    }
+}
+
+/**
+ * @brief Blocked product C += alpha * A * B, with beta already applied to C.
+ */
+template <typename T>
+void blocked(const size_t m, const size_t n, const size_t k, const T alpha, const T *A, const size_t lda, const T *B,
+             const size_t ldb, T *C, const size_t ldc) {
+    using Block = Blocking<T>;
+
+    // the shared B block never needs to be wider than n, rounded up to whole panels
+    const size_t widest = std::min(Block::NC, ((n + Block::NR - 1) / Block::NR) * Block::NR);
+    AlignedBuffer<T> packedB(std::min(Block::KC, k) * widest);
+    T *b_packed = packedB.data();
+
+    #pragma omp parallel default(none) shared(m, n, k, alpha, A, lda, B, ldb, C, ldc, b_packed)
+    {
+        AlignedBuffer<T> packedA(std::min(Block::MC, ((m + Block::MR - 1) / Block::MR) * Block::MR) * std::min(Block::KC, k));
+        T *a_packed = packedA.data();
+
+        for (size_t jc = 0; jc < n; jc += Block::NC) {
+            const size_t nc = std::min(Block::NC, n - jc);
+            for (size_t pc = 0; pc < k; pc += Block::KC) {
+                const size_t kc = std::min(Block::KC, k - pc);
+
+                // every thread helps pack the shared block of B, then waits at the implied barrier
+                #pragma omp for schedule(static)
+                for (size_t jr = 0; jr < nc; jr += Block::NR) {
+                    packBPanel(jr, nc, kc, B + pc * ldb + jc, ldb, b_packed);
+                }
+
+                #pragma omp for schedule(dynamic)
+                for (size_t ic = 0; ic < m; ic += Block::MC) {
+                    const size_t mc = std::min(Block::MC, m - ic);
+                    packA(mc, kc, alpha, A + ic * lda + pc, lda, a_packed);
+                    for (size_t jr = 0; jr < nc; jr += Block::NR) {
+                        const size_t nr = std::min(Block::NR, nc - jr);
+                        for (size_t ir = 0; ir < mc; ir += Block::MR) {
+                            const size_t mr = std::min(Block::MR, mc - ir);
+                            microKernel(kc, a_packed + ir * kc, b_packed + jr * kc, C + (ic + ir) * ldc + jc + jr, ldc, mr, nr);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace GEMM
+
+/**
+ * @brief General matrix-matrix multiply, C = alpha * A * B + beta * C, on row-major buffers.
+ * @tparam T The element type.
+ * @param m Number of rows of A and C.
+ * @param n Number of columns of B and C.
+ * @param k Number of columns of A and rows of B.
+ * @param alpha Scale applied to the product.
+ * @param A Pointer to the m x k matrix A.
+ * @param lda Leading dimension of A.
+ * @param B Pointer to the k x n matrix B.
+ * @param ldb Leading dimension of B.
+ * @param beta Scale applied to C before accumulating. When zero, C is overwritten without being read.
+ * @param C Pointer to the m x n matrix C. Must not overlap A or B.
+ * @param ldc Leading dimension of C.
+ */
+template <typename T>
+void gemm(const size_t m, const size_t n, const size_t k, const T alpha, const T *A, const size_t lda, const T *B,
+          const size_t ldb, const T beta, T *C, const size_t ldc) {
+    if (m == 0 || n == 0) {
+        return;
+    }
+
+    if (beta != static_cast<T>(1)) {
+        #pragma omp parallel for default(none) shared(m, n, beta, C, ldc) if (m * n > GEMM::SmallProductThreshold)
+        for (size_t i = 0; i < m; ++i) {
+            T *c_row = C + i * ldc;
+            for (size_t j = 0; j < n; ++j) {
+                c_row[j] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * c_row[j];
+            }
+        }
+    }
+
+    if (k == 0 || alpha == static_cast<T>(0)) {
+        return;
+    }
+
+    // long double is computed on the x87 stack, which packing cannot speed up, so it stays on the unblocked loop
+    if constexpr (!std::is_same_v<T, float> && !std::is_same_v<T, double>) {
+        GEMM::reference(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+    } else {
+        if (m * n * k <= GEMM::SmallProductThreshold) {
+            GEMM::reference(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+        } else {
+            GEMM::blocked(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+        }
+    }
+}
+
+/**
+ * @brief General matrix-matrix multiply, C = alpha * A * B + beta * C, on dense matrices.
+ * @details C must already have A.getRows() rows and B.getCols() columns, and must not alias A or B.
+ * @tparam MatrixType A dense matrix type exposing getBuffer() and getLeadingDimension(), such as MyBLAS::Matrix.
+ */
+template <template<typename> class MatrixType, typename T>
+void gemm(const T alpha, const MatrixType<T> &A, const MatrixType<T> &B, const T beta, MatrixType<T> &C) {
+    assert(A.getCols() == B.getRows());
+    assert(C.getRows() == A.getRows() && C.getCols() == B.getCols());
+    gemm(A.getRows(), B.getCols(), A.getCols(), alpha, A.getBuffer(), A.getLeadingDimension(), B.getBuffer(),
+         B.getLeadingDimension(), beta, C.getBuffer(), C.getLeadingDimension());
+}
+
+} // namespace MyBLAS
+
+#endif // NE591_008_MYBLAS_GEMM_H
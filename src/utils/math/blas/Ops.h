@@ -15,6 +15,7 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 
+#include <cassert>
 #include <random>
 
 namespace MyBLAS {
@@ -130,6 +131,100 @@ template <typename T> T AbsoluteMaxResidual(const MyBLAS::Vector<T> &a, const My
     return MyBLAS::AbsoluteMaxResidual<MyBLAS::Vector<T>, T>(a, b, n);
 }
 
+/**
+ * @brief In-place AXPY, y = y + alpha * x, without allocating a temporary.
+ *
+ * @param alpha The scale applied to x.
+ * @param x The vector to add.
+ * @param y The vector to update, of the same size as x.
+ */
+template <template<typename> class VectorType, typename T>
+inline void axpy(const T alpha, const VectorType<T> &x, VectorType<T> &y) {
+    assert(x.size() == y.size());
+    const size_t n = y.size();
+    #pragma omp parallel for simd default(none) shared(alpha, x, y, n)
+    for (size_t i = 0; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * @brief In-place XPAY, y = x + beta * y, as used by the CG search direction update.
+ *
+ * @param x The vector to add.
+ * @param beta The scale applied to y.
+ * @param y The vector to update, of the same size as x.
+ */
+template <template<typename> class VectorType, typename T>
+inline void xpay(const VectorType<T> &x, const T beta, VectorType<T> &y) {
+    assert(x.size() == y.size());
+    const size_t n = y.size();
+    #pragma omp parallel for simd default(none) shared(x, beta, y, n)
+    for (size_t i = 0; i < n; i++) {
+        y[i] = x[i] + beta * y[i];
+    }
+}
+
+/**
+ * @brief Fused CG step: x = x + alpha * p and r = r - alpha * Ap, returning the new r * r, in a single pass.
+ *
+ * Written as separate vector expressions this takes three passes over memory and two temporaries.
+ *
+ * @param alpha The step size.
+ * @param p The search direction.
+ * @param Ap The product of the coefficient matrix with the search direction.
+ * @param x The solution estimate to update.
+ * @param r The residual to update.
+ * @return The squared L2 norm of the updated residual.
+ */
+template <template<typename> class VectorType, typename T>
+inline T updateSolutionAndResidual(const T alpha, const VectorType<T> &p, const VectorType<T> &Ap, VectorType<T> &x,
+                                   VectorType<T> &r) {
+    assert(p.size() == x.size() && Ap.size() == r.size() && x.size() == r.size());
+    const size_t n = r.size();
+    T r_dot = 0;
+    #pragma omp parallel for simd reduction(+:r_dot) default(none) shared(alpha, p, Ap, x, r, n)
+    for (size_t i = 0; i < n; i++) {
+        x[i] += alpha * p[i];
+        const T residual = r[i] - alpha * Ap[i];
+        r[i] = residual;
+        r_dot += residual * residual;
+    }
+    return r_dot;
+}
+
+/**
+ * @brief Fused Jacobi-preconditioned CG step: x = x + alpha * p, r = r - alpha * Ap and z = M^-1 * r, returning the
+ * new z * r, in a single pass.
+ *
+ * @param alpha The step size.
+ * @param p The search direction.
+ * @param Ap The product of the coefficient matrix with the search direction.
+ * @param M_inv The inverse of the diagonal of the coefficient matrix.
+ * @param x The solution estimate to update.
+ * @param r The residual to update.
+ * @param z The preconditioned residual, overwritten.
+ * @return The dot product of the updated residual with the updated preconditioned residual.
+ */
+template <template<typename> class VectorType, typename T>
+inline T updateSolutionAndPreconditionedResidual(const T alpha, const VectorType<T> &p, const VectorType<T> &Ap,
+                                                 const VectorType<T> &M_inv, VectorType<T> &x, VectorType<T> &r,
+                                                 VectorType<T> &z) {
+    assert(p.size() == x.size() && Ap.size() == r.size() && M_inv.size() == r.size() && z.size() == r.size());
+    const size_t n = r.size();
+    T z_dot = 0;
+    #pragma omp parallel for simd reduction(+:z_dot) default(none) shared(alpha, p, Ap, M_inv, x, r, z, n)
+    for (size_t i = 0; i < n; i++) {
+        x[i] += alpha * p[i];
+        const T residual = r[i] - alpha * Ap[i];
+        const T preconditioned = M_inv[i] * residual;
+        r[i] = residual;
+        z[i] = preconditioned;
+        z_dot += preconditioned * residual;
+    }
+    return z_dot;
+}
+
 /**
  * @brief Makes the given matrix diagonally dominant.
  *
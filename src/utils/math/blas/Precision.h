@@ -0,0 +1,90 @@
+/**
+ * @file Precision.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Runtime selection of the floating point type that the solvers are instantiated with.
+ *
+ * The vectors, matrices and solvers are all templated on their element type, while MyBLAS::NumericType fixes the type
+ * that the inputs are read and reported in. dispatchPrecision() bridges the two, by calling a generic lambda with a
+ * PrecisionTag for the selected type, so that one binary carries an instantiation of its compute path for each type.
+ */
+
+#ifndef NE591_008_MYBLAS_PRECISION_H
+#define NE591_008_MYBLAS_PRECISION_H
+
+#include <string>
+#include <utility>
+
+namespace MyBLAS {
+
+/**
+ * @enum Precision
+ * @brief The floating point types that a compute path can be instantiated with.
+ */
+enum Precision {
+    PRECISION_FLOAT,       ///< 32-bit IEEE single precision
+    PRECISION_DOUBLE,      ///< 64-bit IEEE double precision
+    PRECISION_LONG_DOUBLE, ///< 80-bit x87 extended precision on x86, the default
+};
+
+/**
+ * @brief Returns the command line and JSON key of a precision.
+ */
+inline const char *PrecisionKey(const Precision precision) {
+    switch (precision) {
+    case PRECISION_FLOAT: return "float";
+    case PRECISION_DOUBLE: return "double";
+    case PRECISION_LONG_DOUBLE: return "long-double";
+    default: return "unknown";
+    }
+}
+
+/**
+ * @brief Parses a precision from its key.
+ * @param key One of float, double, or long-double.
+ * @param precision Set to the parsed precision if the key is valid.
+ * @return false if the key is not a known precision.
+ */
+inline bool parsePrecision(const std::string &key, Precision &precision) {
+    for (const auto candidate : {PRECISION_FLOAT, PRECISION_DOUBLE, PRECISION_LONG_DOUBLE}) {
+        if (key == PrecisionKey(candidate)) {
+            precision = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief An empty tag that carries a floating point type into a generic lambda.
+ */
+template <typename T> struct PrecisionTag {
+    using type = T;
+};
+
+/**
+ * @brief Calls func with the PrecisionTag of the selected precision.
+ *
+ * The solvers use the <cmath> overloads, which libstdc++ only provides for the standard floating point types, so
+ * there is no __float128 precision to select.
+ *
+ * @param precision The selected precision.
+ * @param func A generic callable, invoked as func(PrecisionTag<T>{}).
+ * @return Whatever func returns.
+ */
+template <typename Func>
+decltype(auto) dispatchPrecision(const Precision precision, Func &&func) {
+    switch (precision) {
+    case PRECISION_FLOAT:
+        return std::forward<Func>(func)(PrecisionTag<float>{});
+    case PRECISION_DOUBLE:
+        return std::forward<Func>(func)(PrecisionTag<double>{});
+    case PRECISION_LONG_DOUBLE:
+    default:
+        return std::forward<Func>(func)(PrecisionTag<long double>{});
+    }
+}
+
+} // namespace MyBLAS
+
+#endif // NE591_008_MYBLAS_PRECISION_H
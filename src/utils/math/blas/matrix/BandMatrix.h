@@ -0,0 +1,374 @@
+/**
+* @file BandMatrix.h
+* @brief Header file for the BandMatrix class.
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @details This file contains the definition of the BandMatrix class, which stores the diagonals of a square matrix
+* that lie within a fixed distance of the main diagonal, and nothing outside of them.
+ */
+
+#ifndef NE591_008_BANDMATRIX_H
+#define NE591_008_BANDMATRIX_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "math/blas/Constants.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/vector/Vector.h"
+#include "profiler/ResourceMonitor.h"
+
+namespace MyBLAS {
+
+/**
+ * @brief Calls function(col, value) for the diagonal and every off-diagonal entry in a row of A.
+ * @details Stencil operators only visit their nonzeros. Dense matrices visit the whole row.
+ */
+template <typename T, class MatrixType, typename Function>
+void forEachRowEntry(const MatrixType &A, const size_t row, Function &&function) {
+    if constexpr (is_stencil_operator_v<MatrixType>) {
+        function(row, static_cast<T>(A.getStencilDiagonal(row)));
+        A.forEachNeighbor(row, [&function](const size_t col, const auto value) { function(col, static_cast<T>(value)); });
+    } else {
+        for (size_t col = 0; col < A.getCols(); col++) {
+            function(col, static_cast<T>(A[row][col]));
+        }
+    }
+}
+
+/**
+ * @brief Returns the lower and upper bandwidths of a square matrix, i.e. the largest i - j and j - i over its nonzeros.
+ * @details For the five-point diffusion stencil on an m x n mesh, both are n.
+ */
+template <class MatrixType>
+std::pair<size_t, size_t> bandwidths(const MatrixType &A) {
+    size_t lower = 0, upper = 0;
+    for (size_t row = 0; row < A.getRows(); row++) {
+        forEachRowEntry<long double>(A, row, [row, &lower, &upper](const size_t col, const long double value) {
+            if (value != 0) {
+                lower = std::max(lower, row > col ? row - col : 0);
+                upper = std::max(upper, col > row ? col - row : 0);
+            }
+        });
+    }
+    return {lower, upper};
+}
+
+/**
+ * @class BandMatrix
+ * @brief A square matrix stored by rows, keeping only the entries with -lower <= j - i <= upper.
+ *
+ * Row i holds the columns i - lower ... i + upper, contiguously, at values[i * width + (j - i + lower)], where
+ * width = lower + upper + 1. The slots that fall outside the matrix, at the top left and bottom right corners, are
+ * stored but never read. Memory is O(rows * width), and a matrix-vector product costs O(rows * width), instead of the
+ * O(rows^2) of a dense matrix. The diffusion matrix of an m x n mesh has both bandwidths equal to n.
+ *
+ * The band may be declared wider than the nonzeros of the matrix, to leave room for the fill-in of a factorization.
+ *
+ * The class implements the stencil operator interface (see StencilOperator.h), so it can be handed to the relaxation
+ * methods as it is.
+ *
+ * @tparam T The type of the elements in the matrix.
+ */
+template <typename T = MyBLAS::NumericType>
+class BandMatrix {
+
+  protected:
+    size_t _rows = 0;  ///< Number of rows and columns in the matrix.
+    size_t _lower = 0; ///< Number of stored diagonals below the main diagonal.
+    size_t _upper = 0; ///< Number of stored diagonals above the main diagonal.
+    size_t _width = 1; ///< Number of stored entries per row, lower + upper + 1.
+    std::vector<T> _values; ///< The stored entries, row by row.
+    typename ResourceMonitor<BandMatrix<T>>::Allocation _allocation; ///< The heap bytes of the values, as last recorded.
+
+    /**
+     * @brief Records the capacity of the values with the resource monitor.
+     */
+    void monitorAllocation() { _allocation.update(_values.capacity() * sizeof(T)); }
+
+  public:
+    /**
+     * @brief Returns the number of bytes allocated by the matrix.
+     * @param actual If true, counts the used size of the values array, otherwise counts its capacity.
+     * @return The number of allocated bytes.
+     */
+    [[nodiscard]] size_t getAllocatedBytes(bool actual = false) const {
+        return sizeof(*this) + (actual ? _values.size() : _values.capacity()) * sizeof(T);
+    }
+
+    /**
+     * @brief Default constructor. Initializes an empty matrix.
+     */
+    BandMatrix() {
+        ResourceMonitor<BandMatrix<T>>::registerInstance(this);
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~BandMatrix() {
+        ResourceMonitor<BandMatrix<T>>::unregisterInstance(this);
+    }
+
+    /**
+     * @brief Constructor that allocates a band of the given shape, filled with one value.
+     * @param rows Number of rows and columns in the matrix.
+     * @param lower Number of diagonals below the main diagonal.
+     * @param upper Number of diagonals above the main diagonal.
+     * @param value The value of every stored entry.
+     */
+    BandMatrix(const size_t rows, const size_t lower, const size_t upper, const T value = 0)
+        : _rows(rows), _lower(lower), _upper(upper), _width(lower + upper + 1), _values(rows * (lower + upper + 1), value) {
+        ResourceMonitor<BandMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Constructor that copies a dense matrix or stencil operator into a band of the given shape.
+     * @details The band must contain every nonzero of A. Stencil operators are copied in O(nnz), dense matrices in
+     * O(rows^2).
+     * @param A The square matrix to copy.
+     * @param lower Number of diagonals below the main diagonal, at least the lower bandwidth of A.
+     * @param upper Number of diagonals above the main diagonal, at least the upper bandwidth of A.
+     */
+    template <class MatrixType, std::enable_if_t<!std::is_arithmetic_v<MatrixType>, int> = 0>
+    BandMatrix(const MatrixType &A, const size_t lower, const size_t upper) : BandMatrix(A.getRows(), lower, upper) {
+        assert(A.getRows() == A.getCols());
+        const size_t rows = _rows;
+        #pragma omp parallel for schedule(static)
+        for (size_t row = 0; row < rows; row++) {
+            forEachRowEntry<T>(A, row, [this, row](const size_t col, const T value) {
+                if (inBand(row, col)) {
+                    _values[index(row, col)] = value;
+                } else {
+                    assert(value == static_cast<T>(0));
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Constructor that copies a dense matrix or stencil operator into a band just wide enough for its nonzeros.
+     * @param A The square matrix to copy.
+     */
+    template <class MatrixType, std::enable_if_t<!std::is_same_v<MatrixType, BandMatrix> && !std::is_arithmetic_v<MatrixType>, int> = 0>
+    explicit BandMatrix(const MatrixType &A) : BandMatrix(A, bandwidths(A)) {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The matrix to copy from.
+     */
+    BandMatrix(const BandMatrix &other)
+        : _rows(other._rows), _lower(other._lower), _upper(other._upper), _width(other._width), _values(other._values) {
+        ResourceMonitor<BandMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The matrix to move from.
+     */
+    BandMatrix(BandMatrix &&other) noexcept
+        : _rows(other._rows), _lower(other._lower), _upper(other._upper), _width(other._width),
+          _values(std::move(other._values)), _allocation(std::move(other._allocation)) {
+        other._rows = 0;
+        ResourceMonitor<BandMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The matrix to copy from.
+     * @return Reference to the current matrix.
+     */
+    BandMatrix &operator=(const BandMatrix &other) {
+        if (this != &other) {
+            _rows = other._rows;
+            _lower = other._lower;
+            _upper = other._upper;
+            _width = other._width;
+            _values = other._values;
+            monitorAllocation();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The matrix to move from.
+     * @return Reference to the current matrix.
+     */
+    BandMatrix &operator=(BandMatrix &&other) noexcept {
+        if (this != &other) {
+            _rows = other._rows;
+            _lower = other._lower;
+            _upper = other._upper;
+            _width = other._width;
+            _values = std::move(other._values);
+            other._rows = 0;
+            _allocation = std::move(other._allocation);
+            monitorAllocation();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Returns the number of rows in the matrix.
+     */
+    [[nodiscard]] size_t getRows() const { return _rows; }
+
+    /**
+     * @brief Returns the number of columns in the matrix.
+     */
+    [[nodiscard]] size_t getCols() const { return _rows; }
+
+    /**
+     * @brief Returns the number of stored diagonals below the main diagonal.
+     */
+    [[nodiscard]] size_t getLowerBandwidth() const { return _lower; }
+
+    /**
+     * @brief Returns the number of stored diagonals above the main diagonal.
+     */
+    [[nodiscard]] size_t getUpperBandwidth() const { return _upper; }
+
+    /**
+     * @brief Returns the number of stored entries per row, which is the stride between consecutive rows.
+     */
+    [[nodiscard]] size_t getWidth() const { return _width; }
+
+    /**
+     * @brief Returns the stored entries, row by row.
+     */
+    [[nodiscard]] std::vector<T> &getValues() { return _values; }
+    [[nodiscard]] const std::vector<T> &getValues() const { return _values; }
+
+    /**
+     * @brief Returns true if (row, col) lies within the stored band.
+     */
+    [[nodiscard]] bool inBand(const size_t row, const size_t col) const {
+        return col + _lower >= row && col <= row + _upper;
+    }
+
+    /**
+     * @brief Returns the position of (row, col) in the values array. The position must lie within the band.
+     */
+    [[nodiscard]] size_t index(const size_t row, const size_t col) const {
+        assert(inBand(row, col));
+        return row * _width + col + _lower - row;
+    }
+
+    /**
+     * @brief Returns the entry at the given position, or zero if it lies outside the band.
+     */
+    T operator()(const size_t row, const size_t col) const {
+        assert(row < _rows && col < _rows);
+        return inBand(row, col) ? _values[index(row, col)] : static_cast<T>(0);
+    }
+
+    /**
+     * @brief Returns a reference to the entry at the given position, which must lie within the band.
+     */
+    T &at(const size_t row, const size_t col) {
+        assert(row < _rows && col < _rows);
+        return _values[index(row, col)];
+    }
+
+    /**
+     * @brief Returns the first and one past the last column of the matrix that row stores.
+     */
+    [[nodiscard]] std::pair<size_t, size_t> columnRange(const size_t row) const {
+        return {row > _lower ? row - _lower : 0, std::min(_rows, row + _upper + 1)};
+    }
+
+    /**
+     * @brief Returns the diagonal entry of a row.
+     */
+    [[nodiscard]] T getStencilDiagonal(const size_t row) const { return _values[row * _width + _lower]; }
+
+    /**
+     * @brief Calls function(col, value) for each stored off-diagonal entry in a row, in increasing column order.
+     * @details Entries of the band that are zero are visited too.
+     * @param row The row index.
+     * @param function The callable to invoke for every entry.
+     */
+    template <typename Function>
+    void forEachNeighbor(const size_t row, Function &&function) const {
+        const auto [first, last] = columnRange(row);
+        for (size_t col = first; col < last; col++) {
+            if (col != row) {
+                function(col, _values[index(row, col)]);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the sum of a(row, col) * x[col] over the stored entries with col != row.
+     * @param row The row index.
+     * @param x The vector to multiply with.
+     * @return The off-diagonal row product.
+     */
+    template <class VectorType>
+    [[nodiscard]] T offDiagonalProduct(const size_t row, const VectorType &x) const {
+        T sum = 0;
+        forEachNeighbor(row, [&sum, &x](const size_t col, const T value) { sum += value * x[col]; });
+        return sum;
+    }
+
+    /**
+     * @brief Banded matrix-vector product y = A * x, written into a caller-owned buffer.
+     * @param x The vector to multiply with, of size getCols().
+     * @param y The output vector, of size getRows().
+     */
+    template <class VectorType>
+    void apply(const VectorType &x, VectorType &y) const {
+        assert(x.size() == _rows);
+        assert(y.size() == _rows);
+        const size_t rows = _rows;
+        #pragma omp parallel for schedule(static)
+        for (size_t row = 0; row < rows; row++) {
+            const auto [first, last] = columnRange(row);
+            const T *entries = _values.data() + index(row, first);
+            T sum = 0;
+            for (size_t col = first; col < last; col++) {
+                sum += entries[col - first] * x[col];
+            }
+            y[row] = sum;
+        }
+    }
+
+    /**
+     * @brief Banded matrix-vector product y = A * x.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    template <class VectorType>
+    [[nodiscard]] VectorType apply(const VectorType &x) const {
+        VectorType y(_rows, 0);
+        apply(x, y);
+        return y;
+    }
+
+    /**
+     * @brief Overload of the multiplication operator for multiplying a band matrix and a MyBLAS::Vector.
+     * @param A The band matrix.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    friend Vector<T> operator*(const BandMatrix &A, const Vector<T> &x) {
+        return A.apply(x);
+    }
+
+  private:
+    template <class MatrixType>
+    BandMatrix(const MatrixType &A, const std::pair<size_t, size_t> &shape) : BandMatrix(A, shape.first, shape.second) {}
+};
+
+} // namespace MyBLAS
+
+#endif // NE591_008_BANDMATRIX_H
@@ -136,9 +136,9 @@ class LazyMatrix {
     /**
      * @brief Move constructor for the LazyMatrix class.
      *
-     * @param other The LazyMatrix object to be copied.
+     * @param other The LazyMatrix object to be moved from. It is left empty.
      */
-    LazyMatrix(const LazyMatrix&& other) noexcept
+    LazyMatrix(LazyMatrix&& other) noexcept
         : rows_(other.rows_), cols_(other.cols_), generator_(std::move(other.generator_)), matrix_(std::move(other.matrix_)) {
         other.rows_ = 0;
         other.cols_ = 0;
@@ -159,7 +159,6 @@ class LazyMatrix {
             cols_ = other.cols_;
             generator_ = other.generator_;
             matrix_ = other.matrix_;
-            ResourceMonitor<LazyMatrix<DataType>>::registerInstance(this);
         }
         return *this;
     }
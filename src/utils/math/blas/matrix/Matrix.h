@@ -11,11 +11,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 #include <unordered_set>
 
+#include "math/blas/AlignedBuffer.h"
 #include "math/blas/Constants.h"
+#include "math/blas/GEMM.h"
 #include "math/blas/vector/Vector.h"
 #include "profiler/ResourceMonitor.h"
 
@@ -27,37 +32,142 @@ template <typename T> class Vector;
 /**
  * @class Matrix
  * @brief Class representing a matrix of T type values.
+ *
+ * The elements are stored row-major in a single buffer aligned to a cache line. Consecutive rows are
+ * getLeadingDimension() elements apart, which is the column count rounded up to a whole number of cache lines once a
+ * row spans at least one, so that every row starts on an aligned address. Narrow matrices are stored unpadded.
+ *
+ * operator[] returns a lightweight view of a row rather than a std::vector, so existing A[i][j] code keeps working
+ * while reading straight out of the contiguous buffer. getData() still returns a nested std::vector copy for the
+ * JSON writers.
  */
 template <typename T = MyBLAS::NumericType> class Matrix {
 
-  protected:
-    std::vector<std::vector<T>> data; ///< 2D vector representing the matrix data.
-
   public:
+    /**
+     * @class RowView
+     * @brief Non-owning view of one row of the matrix.
+     *
+     * Copying a view is cheap and aliases the same row. Assigning to a mutable view copies the elements into the row.
+     *
+     * @tparam ElementType T for a mutable view, const T for a read-only one.
+     */
+    template <typename ElementType>
+    class RowView {
+      public:
+        RowView(ElementType *begin, const size_t size) : _begin(begin), _size(size) {}
+
+        RowView(const RowView &other) = default;
+
+        /**
+         * @brief A mutable view converts to a read-only one.
+         */
+        template <typename OtherType, typename = std::enable_if_t<std::is_same_v<const OtherType, ElementType>>>
+        RowView(const RowView<OtherType> &other) : _begin(other.data()), _size(other.size()) {}
+
+        /**
+         * @brief Copies the elements of another row into this one.
+         */
+        RowView &operator=(const RowView &other) {
+            assert(other.size() == _size);
+            std::copy(other.begin(), other.end(), _begin);
+            return *this;
+        }
 
-    // TODO:: Document
-    [[nodiscard]] size_t getAllocatedBytes(bool actual = false) const {
-        auto nRows = actual ? data.size() : data.capacity();
-        if (data.empty()) {
-            return 0;
+        /**
+         * @brief Copies the elements of a std::vector into this row.
+         */
+        RowView &operator=(const std::vector<T> &values) {
+            assert(values.size() == _size);
+            std::copy(values.begin(), values.end(), _begin);
+            return *this;
         }
-        auto nCols = actual ? data[0].size() : data[0].capacity();
 
-        assert(nRows >= getRows());
-        assert(nCols >= getCols());
+        ElementType &operator[](const size_t col) const {
+            assert(col < _size);
+            return _begin[col];
+        }
+
+        [[nodiscard]] size_t size() const { return _size; }
+        [[nodiscard]] bool empty() const { return _size == 0; }
+        [[nodiscard]] ElementType *data() const { return _begin; }
+        [[nodiscard]] ElementType *begin() const { return _begin; }
+        [[nodiscard]] ElementType *end() const { return _begin + _size; }
+
+        /**
+         * @brief Copies the row out into a std::vector.
+         */
+        operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
 
-        size_t byteCount = 0;
+      private:
+        ElementType *_begin;
+        size_t _size;
+    };
 
-        // count all the elements
-        byteCount += (nRows * nCols) * (sizeof(T) > 0.0 ? sizeof(T) : 1);
+    using Row = RowView<T>;
+    using ConstRow = RowView<const T>;
 
-        // count all the row containers
-        byteCount += nRows * sizeof(std::vector<T>);
+  protected:
+    size_t rows = 0; ///< Number of rows in the matrix.
+    size_t cols = 0; ///< Number of columns in the matrix.
+    size_t stride = 0; ///< Leading dimension, i.e. the distance in elements between the starts of consecutive rows.
+    AlignedBuffer<T, CacheLineBytes, ResourceMonitor<Matrix<T>>> data; ///< Contiguous, row-major matrix data of size rows * stride.
+
+    /**
+     * @brief Returns the leading dimension used for a matrix with the given number of columns.
+     * @details Rows at least one cache line wide are padded to a whole number of cache lines.
+     * @param columns Number of columns in the matrix.
+     * @return The leading dimension, in elements.
+     */
+    static size_t leadingDimension(const size_t columns) {
+        if constexpr (CacheLineBytes % sizeof(T) != 0) {
+            return columns;
+        } else {
+            constexpr size_t lanes = CacheLineBytes / sizeof(T);
+            return columns < lanes ? columns : ((columns + lanes - 1) / lanes) * lanes;
+        }
+    }
+
+    /**
+     * @brief Resizes the buffer to hold a rows x cols matrix, filling it with the given value.
+     * @param _rows Number of rows.
+     * @param _cols Number of columns.
+     * @param _initial Value to fill the buffer with.
+     */
+    void allocate(const size_t _rows, const size_t _cols, const T _initial = 0) {
+        rows = _rows;
+        cols = _cols;
+        stride = leadingDimension(_cols);
+        data.assign(rows * stride, _initial);
+    }
+
+    /**
+     * @brief Copies a nested std::vector into the buffer. Every row must have the size of the first one.
+     * @param rowData The rows to copy.
+     */
+    void assignRows(const std::vector<std::vector<T>> &rowData) {
+        allocate(rowData.size(), rowData.empty() ? 0 : rowData[0].size());
+        for (size_t i = 0; i < rows; ++i) {
+            assert(rowData[i].size() == cols);
+            std::copy(rowData[i].begin(), rowData[i].end(), rowPointer(i));
+        }
+    }
 
-        // Memory used by this object itself.
-        byteCount += sizeof(*this);
+  public:
 
-        return byteCount;
+    /**
+     * @brief Returns the number of bytes allocated by the matrix.
+     * @param actual If true, counts the used size of the buffer, otherwise counts its capacity.
+     * @return The number of allocated bytes.
+     */
+    [[nodiscard]] size_t getAllocatedBytes(bool actual = false) const {
+        const size_t nItems = actual ? data.size() : data.capacity();
+        if (nItems == 0) {
+            return 0;
+        }
+        assert(nItems >= getRows() * getCols());
+        // count all the elements, including the row padding, plus the object itself
+        return nItems * sizeof(T) + sizeof(*this);
     }
 
     /**
@@ -78,7 +188,8 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @brief Constructor that initializes the matrix with a given 2D vector.
      * @param _data 2D vector to initialize the matrix with.
      */
-    explicit Matrix(std::vector<std::vector<T>> &_data) : data(_data) {
+    explicit Matrix(std::vector<std::vector<T>> &_data) {
+        assignRows(_data);
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -86,7 +197,8 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @brief Const Constructor that initializes the matrix with a given 2D vector.
      * @param _data 2D vector to initialize the matrix with.
      */
-    explicit Matrix(const std::vector<std::vector<T>> &_data) : data(_data) {
+    explicit Matrix(const std::vector<std::vector<T>> &_data) {
+        assignRows(_data);
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -94,7 +206,8 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @brief Constructor that initializes the matrix with a given 2D vector.
      * @param _data 2D vector to initialize the matrix with.
      */
-    explicit Matrix(std::vector<std::vector<T>>&& _data) : data(std::move(_data)) {
+    explicit Matrix(std::vector<std::vector<T>>&& _data) {
+        assignRows(_data);
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -102,16 +215,16 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @brief Move constructor.
      * @param other The matrix to move from.
      */
-    Matrix(Matrix&& other) noexcept : data(std::move(other.data)) {
+    Matrix(Matrix&& other) noexcept : rows(other.rows), cols(other.cols), stride(other.stride), data(std::move(other.data)) {
         ResourceMonitor<Matrix<T>>::registerInstance(this);
-        // Remove the moved-from instance from the tracking set.
+        other.rows = other.cols = other.stride = 0;
     }
 
     /**
      * @brief Copy constructor.
      * @param other The matrix to copy from.
      */
-    Matrix(const Matrix& other) : data(other.data) {
+    Matrix(const Matrix& other) : rows(other.rows), cols(other.cols), stride(other.stride), data(other.data) {
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -121,13 +234,15 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     template <typename U>
     explicit Matrix(const Matrix<U>& other) {
-        const size_t rows = other.getRows(), cols = other.getCols();
-        data = std::vector<std::vector<T>>(rows, std::vector<T>(cols));
-        #pragma omp parallel for simd default(none) shared(other)
-        for (size_t i = 0; i < rows; ++i) {
+        allocate(other.getRows(), other.getCols());
+        const size_t _rows = rows, _cols = cols;
+        #pragma omp parallel for default(none) shared(other, _rows, _cols)
+        for (size_t i = 0; i < _rows; ++i) {
+            T *row = rowPointer(i);
+            const U *otherRow = other[i].data();
             #pragma omp simd
-            for (size_t j = 0; j < cols; ++j) {
-                data[i][j] = static_cast<T>(other[i][j]);
+            for (size_t j = 0; j < _cols; ++j) {
+                row[j] = static_cast<T>(otherRow[j]);
             }
         }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
@@ -141,13 +256,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     template <class MatrixType>
     explicit Matrix(MatrixType matrix) {
-        const size_t rows = matrix.getRows(), cols = matrix.getCols();
-        data = std::vector<std::vector<T>>(rows, std::vector<T>(cols, 0));
-        #pragma omp parallel for simd default(none) shared(matrix)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                data[i][j] = matrix[i][j];
+        allocate(matrix.getRows(), matrix.getCols());
+        const size_t _rows = rows, _cols = cols;
+        #pragma omp parallel for default(none) shared(matrix, _rows, _cols)
+        for (size_t i = 0; i < _rows; ++i) {
+            T *row = rowPointer(i);
+            for (size_t j = 0; j < _cols; ++j) {
+                row[j] = matrix[i][j];
             }
         }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
@@ -159,8 +274,8 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @param _cols Number of columns in the matrix.
      * @param _initial Initial value for all elements in the matrix.
      */
-    Matrix(size_t _rows, size_t _cols, const T _initial = 0)
-        : data(_rows, std::vector<T>(_cols, _initial)) {
+    Matrix(size_t _rows, size_t _cols, const T _initial = 0) {
+        allocate(_rows, _cols, _initial);
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -169,15 +284,11 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @param initList Initializer list to initialize the matrix with.
      */
     Matrix(std::initializer_list<std::initializer_list<T>> initList) {
-        data.resize(initList.size());
+        allocate(initList.size(), initList.size() == 0 ? 0 : initList.begin()->size());
         size_t i = 0;
         for (const auto &row : initList) {
-            data[i].resize(initList.begin()->size());
-            size_t j = 0;
-            for (const auto &elem : row) {
-                data[i][j] = elem;
-                ++j;
-            }
+            assert(row.size() == cols);
+            std::copy(row.begin(), row.end(), rowPointer(i));
             ++i;
         }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
@@ -185,16 +296,17 @@ template <typename T = MyBLAS::NumericType> class Matrix {
 
     /**
      * @brief Constructor that initializes the matrix with a given size and a lambda function.
-     * @param rows Number of rows in the matrix.
-     * @param cols Number of columns in the matrix.
+     * @param _rows Number of rows in the matrix.
+     * @param _cols Number of columns in the matrix.
      * @param func Lambda function to generate the elements of the matrix.
      */
-    explicit Matrix(const size_t rows, const size_t cols, std::function<T(size_t, size_t)> func) : data(rows, std::vector<T>(cols)) {
-        #pragma omp parallel for simd default(none) shared(func)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                data[i][j] = func(i, j);
+    explicit Matrix(const size_t _rows, const size_t _cols, std::function<T(size_t, size_t)> func) {
+        allocate(_rows, _cols);
+        #pragma omp parallel for default(none) shared(func, _rows, _cols)
+        for (size_t i = 0; i < _rows; ++i) {
+            T *row = rowPointer(i);
+            for (size_t j = 0; j < _cols; ++j) {
+                row[j] = func(i, j);
             }
         }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
@@ -206,8 +318,10 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     Matrix& operator=(const Matrix& other) {
         if (this != &other) {
+            rows = other.rows;
+            cols = other.cols;
+            stride = other.stride;
             data = other.data;
-            // Update the instances set
             // No need to update the instances set because 'this' already exists
         }
         return *this;
@@ -220,11 +334,15 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     Matrix& operator=(Matrix&& other) noexcept {
         if (this != &other) {
+            rows = other.rows;
+            cols = other.cols;
+            stride = other.stride;
             data = std::move(other.data);
             // No need to update the instances set because 'this' already exists
             // don't erase the moved-from object from the instances set since we are only moving the content, not the
             // instance. Clear the data since we use instance.data to compute allocated memory
             other.data.clear();
+            other.rows = other.cols = other.stride = 0;
         }
         return *this;
     }
@@ -237,7 +355,7 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     T &operator()(size_t row, size_t col) {
         assert(row < getRows() && col < getCols());
-        return data[row][col];
+        return data[row * stride + col];
     }
 
     /**
@@ -248,54 +366,82 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     const T &operator()(size_t row, size_t col) const {
         assert(row < getRows() && col < getCols());
-        return data[row][col];
+        return data[row * stride + col];
     }
 
 
     /**
      * @brief Overloaded operator[] to access individual rows of the matrix.
      * @param rowNum Index of the row to access.
-     * @return Reference to the row at the given index.
+     * @return View of the row at the given index.
      */
-    std::vector<T> &operator[](const size_t rowNum) {
+    Row operator[](const size_t rowNum) {
         assert(rowNum < getRows());
-        return data[rowNum];
+        return Row(rowPointer(rowNum), cols);
     }
 
     /**
      * @brief Overloaded operator[] to access individual rows of the matrix (const version).
      * @param rowNum Index of the row to access.
-     * @return Const reference to the row at the given index.
+     * @return Read-only view of the row at the given index.
      */
-    const std::vector<T> &operator[](const size_t rowNum) const {
+    ConstRow operator[](const size_t rowNum) const {
         assert(rowNum < getRows());
-        return data[rowNum];
+        return ConstRow(rowPointer(rowNum), cols);
     }
 
     /**
-     * @brief Getter for the matrix data.
-     * @return Const reference to the matrix data.
+     * @brief Returns a pointer to the first element of a row.
+     * @param rowNum Index of the row.
+     */
+    [[nodiscard]] T *rowPointer(const size_t rowNum) { return data.data() + rowNum * stride; }
+
+    /**
+     * @brief Returns a pointer to the first element of a row (const version).
+     * @param rowNum Index of the row.
+     */
+    [[nodiscard]] const T *rowPointer(const size_t rowNum) const { return data.data() + rowNum * stride; }
+
+    /**
+     * @brief Getter for the underlying buffer, row-major with getLeadingDimension() elements per row.
+     */
+    [[nodiscard]] T *getBuffer() { return data.data(); }
+
+    /**
+     * @brief Getter for the underlying buffer (const version).
      */
-    [[nodiscard]] const std::vector<std::vector<T>> &getData() const { return data; }
+    [[nodiscard]] const T *getBuffer() const { return data.data(); }
 
     /**
-     * @brief Getter for the vector data.
-     * @return reference to the vector data.
+     * @brief Getter for the leading dimension, the distance in elements between the starts of consecutive rows.
      */
-    [[nodiscard]] std::vector<std::vector<T>> &getData() { return data; }
+    [[nodiscard]] size_t getLeadingDimension() const { return stride; }
 
     /**
-     * @brief Getter for the vector data.
-     * @return reference to the vector data.
+     * @brief Getter for the matrix data.
+     * @return A copy of the matrix data as one std::vector per row.
      */
-    [[nodiscard]] std::vector<std::vector<T>> &getMutableData() { return data; }
+    [[nodiscard]] std::vector<std::vector<T>> getData() const {
+        std::vector<std::vector<T>> rowData(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            rowData[i].assign(rowPointer(i), rowPointer(i) + cols);
+        }
+        return rowData;
+    }
 
     /**
      * @brief Adds a new row to the end of the matrix.
      * @param row Vector representing the new row to be added.
      */
     void push_back(const std::vector<T> &row) {
-        data.push_back(row);
+        if (rows == 0) {
+            cols = row.size();
+            stride = leadingDimension(cols);
+        }
+        assert(row.size() == cols);
+        data.resize((rows + 1) * stride, 0);
+        std::copy(row.begin(), row.end(), rowPointer(rows));
+        ++rows;
     }
 
     [[nodiscard]]  /**
@@ -303,7 +449,7 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @return Number of rows in the matrix.
                    */
     inline size_t getRows() const {
-        return data.size();
+        return rows;
     }
 
     [[nodiscard]]  /**
@@ -311,7 +457,7 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @return Number of columns in the matrix.
                    */
     inline size_t getCols() const {
-        return data.empty() ? 0 : data[0].size();
+        return cols;
     }
 
     /**
@@ -321,9 +467,9 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     static Matrix eye(const size_t size) {
         Matrix eye(size, size, 0);
-        #pragma omp parallel for simd default(none) shared(eye)
+        #pragma omp parallel for simd default(none) shared(eye, size)
         for (size_t i = 0; i < size; ++i) {
-            eye[i][i] = 1;
+            eye(i, i) = 1;
         }
         return eye;
     }
@@ -336,14 +482,14 @@ template <typename T = MyBLAS::NumericType> class Matrix {
     Matrix operator+(const Matrix &rhs) const {
         assert(getRows() == rhs.getRows());
         assert(getCols() == rhs.getCols());
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] + rhs.data[i][j];
-            }
+        Matrix result(getRows(), getCols(), 0);
+        // both operands share the same leading dimension, so the padded buffers can be combined in a single sweep
+        const size_t size = data.size();
+        const T *lhs_data = data.data(), *rhs_data = rhs.data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, rhs_data, result_data, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] + rhs_data[k];
         }
         return result;
     }
@@ -356,37 +502,27 @@ template <typename T = MyBLAS::NumericType> class Matrix {
     Matrix operator-(const Matrix &rhs) const {
         assert(getRows() == rhs.getRows());
         assert(getCols() == rhs.getCols());
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] - rhs.data[i][j];
-            }
+        Matrix result(getRows(), getCols(), 0);
+        const size_t size = data.size();
+        const T *lhs_data = data.data(), *rhs_data = rhs.data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, rhs_data, result_data, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] - rhs_data[k];
         }
         return result;
     }
 
     /**
      * @brief Overloaded operator* to multiply two matrices.
+     * @details Runs the cache-blocked, packed GEMM kernel in GEMM.h.
      * @param rhs Matrix to multiply with the current matrix.
      * @return Resultant matrix after multiplication.
      */
     Matrix operator*(const Matrix &rhs) const {
         assert(getCols() == rhs.getRows());
-        const size_t my_rows = getRows(), my_cols = getCols();
-        const size_t rhs_cols = rhs.getCols();
-        Matrix result(my_rows, rhs_cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
-        for (size_t i = 0; i < my_rows; ++i) {
-            for (size_t j = 0; j < rhs_cols; ++j) {
-                #pragma omp ordered simd
-                for (size_t k = 0; k < my_cols; ++k) {
-                    result[i][j] += this->data[i][k] * rhs.data[k][j];
-                }
-            }
-        }
+        Matrix result(getRows(), rhs.getCols(), 0);
+        gemm(static_cast<T>(1), *this, rhs, static_cast<T>(0), result);
         return result;
     }
 
@@ -401,12 +537,12 @@ template <typename T = MyBLAS::NumericType> class Matrix {
         const size_t my_rows = getRows(), my_cols = getCols();
         const size_t rhs_cols = rhs.getCols();
         MatrixType1 result(my_rows, rhs_cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
+        #pragma omp parallel for default(none) shared(result, rhs, my_rows, my_cols, rhs_cols)
         for (size_t i = 0; i < my_rows; ++i) {
+            const T *a_row = rowPointer(i);
             for (size_t j = 0; j < rhs_cols; ++j) {
-                #pragma omp ordered simd
                 for (size_t k = 0; k < my_cols; ++k) {
-                    result[i][j] += this->data[i][k] * rhs.data[k][j];
+                    result[i][j] += a_row[k] * rhs[k][j];
                 }
             }
         }
@@ -424,12 +560,12 @@ template <typename T = MyBLAS::NumericType> class Matrix {
         const size_t my_rows = getRows(), my_cols = getCols();
         const size_t rhs_cols = rhs.getCols();
         MatrixType1 result(my_rows, rhs_cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
+        #pragma omp parallel for default(none) shared(result, rhs, my_rows, my_cols, rhs_cols)
         for (size_t i = 0; i < my_rows; ++i) {
+            const T *a_row = rowPointer(i);
             for (size_t j = 0; j < rhs_cols; ++j) {
-                #pragma omp ordered simd
                 for (size_t k = 0; k < my_cols; ++k) {
-                    result[i][j] += this->data[i][k] * rhs.data[k][j];
+                    result[i][j] += a_row[k] * rhs[k][j];
                 }
             }
         }
@@ -437,22 +573,35 @@ template <typename T = MyBLAS::NumericType> class Matrix {
     }
 
     /**
-     * @brief Overloaded operator* to multiply a matrix with a vector.
-     * @param rhs Vector to multiply with the current matrix.
-     * @return Resultant vector after multiplication.
+     * @brief Matrix-vector product y = A * x, written into a caller-owned buffer.
+     * @param x The vector to multiply with, of size getCols().
+     * @param y The output vector, of size getRows().
      */
-    Vector<T> operator*(const Vector<T> &rhs) const {
-        assert(getCols() == rhs.size());
+    void apply(const Vector<T> &x, Vector<T> &y) const {
+        assert(getCols() == x.size());
+        assert(getRows() == y.size());
         const size_t my_rows = getRows();
         const size_t my_cols = getCols();
-        Vector<T> result(my_rows, 0);
-        #pragma omp parallel for simd default(none) shared(result, rhs)
+        #pragma omp parallel for default(none) shared(x, y, my_rows, my_cols)
         for (size_t i = 0; i < my_rows; ++i) {
-            #pragma omp ordered simd
+            const T *a_row = rowPointer(i);
+            T sum = 0;
+            #pragma omp simd reduction(+:sum)
             for (size_t j = 0; j < my_cols; ++j) {
-                result[i] += this->data[i][j] * rhs[j];
+                sum += a_row[j] * x[j];
             }
+            y[i] = sum;
         }
+    }
+
+    /**
+     * @brief Overloaded operator* to multiply a matrix with a vector.
+     * @param rhs Vector to multiply with the current matrix.
+     * @return Resultant vector after multiplication.
+     */
+    Vector<T> operator*(const Vector<T> &rhs) const {
+        Vector<T> result(getRows(), 0);
+        apply(rhs, result);
         return result;
     }
 
@@ -466,12 +615,10 @@ template <typename T = MyBLAS::NumericType> class Matrix {
         const size_t subRows = subMatrix.getRows(), subCols = subMatrix.getCols();
         assert(rowStart + subRows <= getRows());
         assert(colStart + subCols <= getCols());
-        #pragma omp parallel for simd default(none) shared(subMatrix)
+        #pragma omp parallel for default(none) shared(subMatrix, rowStart, colStart, subRows, subCols)
         for (size_t i = 0; i < subRows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < subCols; ++j) {
-                data[rowStart + i][colStart + j] = subMatrix[i][j];
-            }
+            const T *source = subMatrix.rowPointer(i);
+            std::copy(source, source + subCols, rowPointer(rowStart + i) + colStart);
         }
     }
 
@@ -487,12 +634,10 @@ template <typename T = MyBLAS::NumericType> class Matrix {
         assert(rowStart + subRows <= getRows());
         assert(colStart + subCols <= getCols());
         Matrix<T> subMatrix(subRows, subCols, 0);
-        #pragma omp parallel for simd default(none) shared(subMatrix)
+        #pragma omp parallel for default(none) shared(subMatrix, rowStart, colStart, subRows, subCols)
         for (size_t i = 0; i < subRows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < subCols; ++j) {
-                subMatrix[i][j] = data[rowStart + i][colStart + j];
-            }
+            const T *source = rowPointer(rowStart + i) + colStart;
+            std::copy(source, source + subCols, subMatrix.rowPointer(i));
         }
 
         return subMatrix;
@@ -516,10 +661,8 @@ template <typename T = MyBLAS::NumericType> class Matrix {
             return false;
         }
         for (size_t i = 0; i < my_rows; ++i) {
-            for (size_t j = 0; j < my_cols; ++j) {
-                if (this->data[i][j] != rhs.data[i][j]) {
-                    return false;
-                }
+            if (!std::equal(rowPointer(i), rowPointer(i) + my_cols, rhs.rowPointer(i))) {
+                return false;
             }
         }
         return true;
@@ -531,14 +674,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @return Resultant matrix after multiplication.
      */
     Matrix operator*(const T &scalar) const {
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, scalar)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] * scalar;
-            }
+        Matrix result(getRows(), getCols(), 0);
+        const size_t size = data.size();
+        const T *lhs_data = data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, result_data, scalar, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] * scalar;
         }
         return result;
     }
@@ -560,14 +702,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     Matrix operator/(const T &scalar) const {
         assert(scalar != 0);
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, scalar)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] / scalar;
-            }
+        Matrix result(getRows(), getCols(), 0);
+        const size_t size = data.size();
+        const T *lhs_data = data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, result_data, scalar, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] / scalar;
         }
         return result;
     }
@@ -578,14 +719,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @return Resultant matrix after addition.
      */
     Matrix operator+(const T &scalar) const {
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, scalar)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] + scalar;
-            }
+        Matrix result(getRows(), getCols(), 0);
+        const size_t size = data.size();
+        const T *lhs_data = data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, result_data, scalar, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] + scalar;
         }
         return result;
     }
@@ -596,14 +736,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      * @return Resultant matrix after subtraction.
      */
     Matrix operator-(const T &scalar) const {
-        const size_t rows = getRows(), cols = getCols();
-        Matrix result(rows, cols, 0);
-        #pragma omp parallel for simd default(none) shared(result, scalar)
-        for (size_t i = 0; i < rows; ++i) {
-            #pragma omp ordered simd
-            for (size_t j = 0; j < cols; ++j) {
-                result[i][j] = this->data[i][j] - scalar;
-            }
+        Matrix result(getRows(), getCols(), 0);
+        const size_t size = data.size();
+        const T *lhs_data = data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(lhs_data, result_data, scalar, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = lhs_data[k] - scalar;
         }
         return result;
     }
@@ -615,7 +754,9 @@ template <typename T = MyBLAS::NumericType> class Matrix {
      */
     void swapRows(size_t row1, size_t row2) {
         assert(row1 < getRows() && row2 < getRows());
-        std::swap(data[row1], data[row2]);
+        if (row1 != row2) {
+            std::swap_ranges(rowPointer(row1), rowPointer(row1) + cols, rowPointer(row2));
+        }
     }
 
     /**
@@ -629,7 +770,7 @@ template <typename T = MyBLAS::NumericType> class Matrix {
         const size_t rows = m.getRows(), cols = m.getCols();
         for (size_t i = 0; i < rows; ++i) {
             for (size_t j = 0; j < cols; ++j) {
-                os << std::setw(width) << std::setfill(' ') << std::scientific << static_cast<long double>(m[i][j]);
+                os << std::setw(width) << std::setfill(' ') << std::scientific << static_cast<long double>(m(i, j));
             }
             os << '\n';
         }
@@ -645,14 +786,13 @@ template <typename T = MyBLAS::NumericType> class Matrix {
     static Matrix<T> elementwiseProduct(const Matrix<T> &A, const Matrix<T> &B) {
         assert(A.getRows() == B.getRows());
         assert(A.getCols() == B.getCols());
-        const size_t a_rows = A.getRows(), b_cols = B.getCols();
-        MyBLAS::Matrix<T> result(a_rows, b_cols);
-        #pragma omp parallel for simd default(none) shared(result, A, B)
-        for (size_t row = 0; row < a_rows; row++) {
-            #pragma omp ordered simd
-            for (size_t col = 0; col < b_cols; col++) {
-                result[row][col] = A[row][col] * B[row][col];
-            }
+        MyBLAS::Matrix<T> result(A.getRows(), B.getCols());
+        const size_t size = A.data.size();
+        const T *a_data = A.data.data(), *b_data = B.data.data();
+        T *result_data = result.data.data();
+        #pragma omp parallel for simd default(none) shared(a_data, b_data, result_data, size)
+        for (size_t k = 0; k < size; ++k) {
+            result_data[k] = a_data[k] * b_data[k];
         }
         return result;
     }
@@ -678,9 +818,10 @@ template <template<typename> class M, template<typename> class V, typename T> V<
     const auto n = b.size();
     auto y = V<T>(n);
     for (size_t row = 0; row < n; row++) {
+        const auto L_row = L[row];
         T sum = 0;
         for (size_t col = 0; col < row; col++) {
-            sum += L[row][col] * y[col];
+            sum += L_row[col] * y[col];
         }
         y[row] = (b[row] - sum);
     }
@@ -709,11 +850,12 @@ template <template<typename> class M, template<typename> class V, typename T> V<
     const auto n = y.size();
     auto x = V<T>(n, static_cast<T>(0));
     for (int64_t i = n - 1; i >= 0; i--) {
+        const auto U_row = U[static_cast<size_t>(i)];
         T sum = 0;
         for (auto j = static_cast<size_t>(i + 1); j < n; j++) {
-            sum += U[i][j] * x[j];
+            sum += U_row[j] * x[j];
         }
-        x[i] = (y[i] - sum) / U[i][i];
+        x[i] = (y[i] - sum) / U_row[static_cast<size_t>(i)];
     }
     return x;
 }
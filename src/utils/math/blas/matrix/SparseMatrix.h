@@ -0,0 +1,571 @@
+/**
+* @file SparseMatrix.h
+* @brief Header file for the SparseMatrix class.
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @details This file contains the definition of the SparseMatrix class, which stores a matrix in compressed sparse row
+* (CSR) format, with an optional compressed sparse column (CSC) copy for transposed products.
+ */
+
+#ifndef NE591_008_SPARSEMATRIX_H
+#define NE591_008_SPARSEMATRIX_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "math/blas/Constants.h"
+#include "math/blas/matrix/LazyMatrix.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/vector/Vector.h"
+#include "profiler/ResourceMonitor.h"
+
+namespace MyBLAS {
+
+/**
+ * @class SparseMatrix
+ * @brief A matrix stored in compressed sparse row (CSR) format.
+ *
+ * Row i owns the entries values[rowPointers[i]] ... values[rowPointers[i+1] - 1], whose column indices are stored in
+ * the same positions of columnIndices, sorted in increasing order. Only the nonzeros are stored, so memory and the cost
+ * of a matrix-vector product are both O(nnz).
+ *
+ * The class implements the stencil operator interface (see StencilOperator.h), so the relaxation methods, CG and the
+ * power iterations only visit the stored entries. The diagonal is cached separately, since every relaxation sweep
+ * needs it.
+ *
+ * A CSC copy of the matrix can be built on demand with buildTranspose(), after which applyTranspose() computes
+ * y = A^T * x as a row-parallel gather instead of a scatter.
+ *
+ * @tparam T The type of the elements in the matrix.
+ */
+template <typename T = MyBLAS::NumericType>
+class SparseMatrix {
+
+  protected:
+    size_t _rows = 0; ///< Number of rows in the matrix.
+    size_t _cols = 0; ///< Number of columns in the matrix.
+    std::vector<size_t> _rowPointers{0}; ///< Offsets into the column index/value arrays, one per row plus one.
+    std::vector<size_t> _columnIndices; ///< Column index of each stored entry, sorted within each row.
+    std::vector<T> _values; ///< Value of each stored entry.
+    std::vector<T> _diagonal; ///< Cached diagonal entries, zero where the diagonal is not stored.
+
+    std::vector<size_t> _columnPointers; ///< CSC offsets, one per column plus one. Empty until buildTranspose().
+    std::vector<size_t> _rowIndices; ///< CSC row index of each stored entry.
+    std::vector<T> _transposedValues; ///< CSC value of each stored entry.
+    typename ResourceMonitor<SparseMatrix<T>>::Allocation _allocation; ///< The heap bytes of the arrays, as last recorded.
+
+    /**
+     * @brief Records the capacity of the arrays with the resource monitor.
+     */
+    void monitorAllocation() { _allocation.update(getAllocatedBytes() - sizeof(*this)); }
+
+  public:
+
+    /**
+     * @brief Read-only view of a single row, so that A[i][j] works like it does for the dense types.
+     */
+    class ConstRow {
+      public:
+        ConstRow(const SparseMatrix &matrix, const size_t row) : _matrix(matrix), _row(row) {}
+
+        /**
+         * @brief Returns the entry at the given column, or zero if it is not stored.
+         * @param col The column index.
+         */
+        T operator[](const size_t col) const { return _matrix(_row, col); }
+
+      private:
+        const SparseMatrix &_matrix;
+        const size_t _row;
+    };
+
+    /**
+     * @brief Returns the number of bytes allocated by the matrix.
+     * @param actual If true, counts the used sizes of the underlying arrays, otherwise counts their capacities.
+     * @return The number of allocated bytes.
+     */
+    [[nodiscard]] size_t getAllocatedBytes(bool actual = false) const {
+        const auto bytes = [actual](const auto &array) {
+            using ElementType = typename std::decay_t<decltype(array)>::value_type;
+            return (actual ? array.size() : array.capacity()) * sizeof(ElementType);
+        };
+        size_t byteCount = sizeof(*this);
+        byteCount += bytes(_rowPointers) + bytes(_columnIndices) + bytes(_values) + bytes(_diagonal);
+        byteCount += bytes(_columnPointers) + bytes(_rowIndices) + bytes(_transposedValues);
+        return byteCount;
+    }
+
+    /**
+     * @brief Default constructor. Initializes an empty matrix.
+     */
+    SparseMatrix() {
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~SparseMatrix() {
+        ResourceMonitor<SparseMatrix<T>>::unregisterInstance(this);
+    }
+
+    /**
+     * @brief Constructor that takes the CSR arrays directly.
+     * @param rows Number of rows in the matrix.
+     * @param cols Number of columns in the matrix.
+     * @param rowPointers Row offsets, of size rows + 1.
+     * @param columnIndices Column index of each entry, sorted within each row.
+     * @param values Value of each entry.
+     */
+    SparseMatrix(const size_t rows, const size_t cols, std::vector<size_t> rowPointers, std::vector<size_t> columnIndices, std::vector<T> values)
+        : _rows(rows), _cols(cols), _rowPointers(std::move(rowPointers)), _columnIndices(std::move(columnIndices)), _values(std::move(values)) {
+        assert(_rowPointers.size() == _rows + 1);
+        assert(_columnIndices.size() == _values.size());
+        assert(_rowPointers.back() == _values.size());
+        cacheDiagonal();
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Constructor that compresses a dense matrix, dropping the entries that are exactly zero.
+     * @param matrix The dense matrix.
+     */
+    explicit SparseMatrix(const Matrix<T> &matrix) {
+        compress(matrix.getRows(), matrix.getCols(), [&matrix](const size_t i, const size_t j) { return matrix[i][j]; });
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Constructor that compresses a lazy matrix by evaluating every entry once.
+     * @note This is O(rows * cols) generator calls. Stencil operators are picked up by the constructor below instead.
+     * @param matrix The lazy matrix.
+     */
+    explicit SparseMatrix(const LazyMatrix<T> &matrix) {
+        compress(matrix.getRows(), matrix.getCols(), [&matrix](const size_t i, const size_t j) { return matrix(i, j); });
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Constructor that copies the nonzeros out of a stencil operator, such as the diffusion matrix.
+     * @details Only the diagonal and the neighbors of each row are visited, so this is O(nnz).
+     * @param stencil The stencil operator.
+     */
+    template <class StencilType, std::enable_if_t<is_stencil_operator_v<StencilType> && !std::is_same_v<StencilType, SparseMatrix>, int> = 0>
+    explicit SparseMatrix(const StencilType &stencil) : _rows(stencil.getRows()), _cols(stencil.getCols()) {
+        _rowPointers.assign(_rows + 1, 0);
+        for (size_t row = 0; row < _rows; row++) {
+            size_t count = (stencil.getStencilDiagonal(row) != static_cast<T>(0)) ? 1 : 0;
+            stencil.forEachNeighbor(row, [&count](const size_t, const T value) { count += (value != static_cast<T>(0)); });
+            _rowPointers[row + 1] = _rowPointers[row] + count;
+        }
+        _columnIndices.resize(_rowPointers.back());
+        _values.resize(_rowPointers.back());
+        #pragma omp parallel for schedule(static)
+        for (size_t row = 0; row < _rows; row++) {
+            size_t position = _rowPointers[row];
+            const auto insert = [this, &position](const size_t col, const T value) {
+                if (value != static_cast<T>(0)) {
+                    _columnIndices[position] = col;
+                    _values[position] = value;
+                    position++;
+                }
+            };
+            insert(row, stencil.getStencilDiagonal(row));
+            stencil.forEachNeighbor(row, insert);
+            sortRow(row);
+        }
+        cacheDiagonal();
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The matrix to copy from.
+     */
+    SparseMatrix(const SparseMatrix &other)
+        : _rows(other._rows), _cols(other._cols), _rowPointers(other._rowPointers), _columnIndices(other._columnIndices),
+          _values(other._values), _diagonal(other._diagonal), _columnPointers(other._columnPointers),
+          _rowIndices(other._rowIndices), _transposedValues(other._transposedValues) {
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The matrix to move from.
+     */
+    SparseMatrix(SparseMatrix &&other) noexcept
+        : _rows(other._rows), _cols(other._cols), _rowPointers(std::move(other._rowPointers)),
+          _columnIndices(std::move(other._columnIndices)), _values(std::move(other._values)),
+          _diagonal(std::move(other._diagonal)), _columnPointers(std::move(other._columnPointers)),
+          _rowIndices(std::move(other._rowIndices)), _transposedValues(std::move(other._transposedValues)),
+          _allocation(std::move(other._allocation)) {
+        other._rows = 0;
+        other._cols = 0;
+        other._rowPointers = {0};
+        ResourceMonitor<SparseMatrix<T>>::registerInstance(this);
+        monitorAllocation();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The matrix to copy from.
+     * @return Reference to the current matrix.
+     */
+    SparseMatrix &operator=(const SparseMatrix &other) {
+        if (this != &other) {
+            _rows = other._rows;
+            _cols = other._cols;
+            _rowPointers = other._rowPointers;
+            _columnIndices = other._columnIndices;
+            _values = other._values;
+            _diagonal = other._diagonal;
+            _columnPointers = other._columnPointers;
+            _rowIndices = other._rowIndices;
+            _transposedValues = other._transposedValues;
+            monitorAllocation();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The matrix to move from.
+     * @return Reference to the current matrix.
+     */
+    SparseMatrix &operator=(SparseMatrix &&other) noexcept {
+        if (this != &other) {
+            _rows = other._rows;
+            _cols = other._cols;
+            _rowPointers = std::move(other._rowPointers);
+            _columnIndices = std::move(other._columnIndices);
+            _values = std::move(other._values);
+            _diagonal = std::move(other._diagonal);
+            _columnPointers = std::move(other._columnPointers);
+            _rowIndices = std::move(other._rowIndices);
+            _transposedValues = std::move(other._transposedValues);
+            other._rows = 0;
+            other._cols = 0;
+            other._rowPointers = {0};
+            _allocation = std::move(other._allocation);
+            monitorAllocation();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Returns the number of rows in the matrix.
+     */
+    [[nodiscard]] size_t getRows() const { return _rows; }
+
+    /**
+     * @brief Returns the number of columns in the matrix.
+     */
+    [[nodiscard]] size_t getCols() const { return _cols; }
+
+    /**
+     * @brief Returns the number of stored entries.
+     */
+    [[nodiscard]] size_t getNonZeros() const { return _values.size(); }
+
+    /**
+     * @brief Returns the CSR row offsets.
+     */
+    [[nodiscard]] const std::vector<size_t> &getRowPointers() const { return _rowPointers; }
+
+    /**
+     * @brief Returns the CSR column indices.
+     */
+    [[nodiscard]] const std::vector<size_t> &getColumnIndices() const { return _columnIndices; }
+
+    /**
+     * @brief Returns the CSR values.
+     */
+    [[nodiscard]] const std::vector<T> &getValues() const { return _values; }
+
+    /**
+     * @brief Returns the entry at the given position, or zero if it is not stored.
+     * @details Looks the column up with a binary search over the row, so this is O(log(nnz per row)).
+     * @param row The row index.
+     * @param col The column index.
+     * @return The entry at (row, col).
+     */
+    T operator()(const size_t row, const size_t col) const {
+        assert(row < _rows && col < _cols);
+        const auto begin = _columnIndices.begin() + static_cast<std::ptrdiff_t>(_rowPointers[row]);
+        const auto end = _columnIndices.begin() + static_cast<std::ptrdiff_t>(_rowPointers[row + 1]);
+        const auto it = std::lower_bound(begin, end, col);
+        if (it == end || *it != col) {
+            return 0;
+        }
+        return _values[static_cast<size_t>(it - _columnIndices.begin())];
+    }
+
+    /**
+     * @brief Returns a read-only view of a row.
+     * @param row The row index.
+     * @return The row view.
+     */
+    ConstRow operator[](const size_t row) const { return ConstRow(*this, row); }
+
+    /**
+     * @brief Returns the diagonal entry of a row.
+     * @param row The row index.
+     * @return The diagonal entry, or zero if it is not stored.
+     */
+    [[nodiscard]] T getStencilDiagonal(const size_t row) const { return _diagonal[row]; }
+
+    /**
+     * @brief Calls function(col, value) for each stored off-diagonal entry in a row, in increasing column order.
+     * @param row The row index.
+     * @param function The callable to invoke for every entry.
+     */
+    template <typename Function>
+    void forEachNeighbor(const size_t row, Function &&function) const {
+        for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+            if (_columnIndices[k] != row) {
+                function(_columnIndices[k], _values[k]);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the sum of a(row, col) * x[col] over the stored entries with col != row.
+     * @param row The row index.
+     * @param x The vector to multiply with.
+     * @return The off-diagonal row product.
+     */
+    template <class VectorType>
+    [[nodiscard]] T offDiagonalProduct(const size_t row, const VectorType &x) const {
+        T sum = 0;
+        for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+            const size_t col = _columnIndices[k];
+            if (col != row) {
+                sum += _values[k] * x[col];
+            }
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Sparse matrix-vector product y = A * x, written into a caller-owned buffer.
+     * @param x The vector to multiply with, of size getCols().
+     * @param y The output vector, of size getRows().
+     */
+    template <class VectorType>
+    void apply(const VectorType &x, VectorType &y) const {
+        assert(x.size() == _cols);
+        assert(y.size() == _rows);
+        const size_t rows = _rows;
+        #pragma omp parallel for schedule(static)
+        for (size_t row = 0; row < rows; row++) {
+            T sum = 0;
+            for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+                sum += _values[k] * x[_columnIndices[k]];
+            }
+            y[row] = sum;
+        }
+    }
+
+    /**
+     * @brief Sparse matrix-vector product y = A * x.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    template <class VectorType>
+    [[nodiscard]] VectorType apply(const VectorType &x) const {
+        VectorType y(_rows, 0);
+        apply(x, y);
+        return y;
+    }
+
+    /**
+     * @brief Builds the CSC copy of the matrix used by applyTranspose(). Calling it again rebuilds it.
+     * @return Reference to the current matrix.
+     */
+    SparseMatrix &buildTranspose() {
+        const size_t nnz = _values.size();
+        _columnPointers.assign(_cols + 1, 0);
+        for (size_t k = 0; k < nnz; k++) {
+            _columnPointers[_columnIndices[k] + 1]++;
+        }
+        for (size_t col = 0; col < _cols; col++) {
+            _columnPointers[col + 1] += _columnPointers[col];
+        }
+        _rowIndices.resize(nnz);
+        _transposedValues.resize(nnz);
+        std::vector<size_t> next(_columnPointers.begin(), _columnPointers.end() - 1);
+        for (size_t row = 0; row < _rows; row++) {
+            for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+                const size_t position = next[_columnIndices[k]]++;
+                _rowIndices[position] = row;
+                _transposedValues[position] = _values[k];
+            }
+        }
+        monitorAllocation();
+        return *this;
+    }
+
+    /**
+     * @brief Returns true if the CSC copy has been built.
+     */
+    [[nodiscard]] bool hasTranspose() const { return !_columnPointers.empty(); }
+
+    /**
+     * @brief Transposed product y = A^T * x, written into a caller-owned buffer.
+     * @details Uses the CSC copy when it has been built, which parallelizes over the output. Otherwise, the CSR arrays
+     * are scattered serially.
+     * @param x The vector to multiply with, of size getRows().
+     * @param y The output vector, of size getCols().
+     */
+    template <class VectorType>
+    void applyTranspose(const VectorType &x, VectorType &y) const {
+        assert(x.size() == _rows);
+        assert(y.size() == _cols);
+        const size_t cols = _cols;
+        if (hasTranspose()) {
+            #pragma omp parallel for schedule(static)
+            for (size_t col = 0; col < cols; col++) {
+                T sum = 0;
+                for (size_t k = _columnPointers[col]; k < _columnPointers[col + 1]; k++) {
+                    sum += _transposedValues[k] * x[_rowIndices[k]];
+                }
+                y[col] = sum;
+            }
+            return;
+        }
+        std::fill(y.begin(), y.end(), static_cast<T>(0));
+        for (size_t row = 0; row < _rows; row++) {
+            for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+                y[_columnIndices[k]] += _values[k] * x[row];
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the transpose of the matrix as a new CSR matrix.
+     * @return The transposed matrix.
+     */
+    [[nodiscard]] SparseMatrix transpose() const {
+        SparseMatrix copy(*this);
+        if (!copy.hasTranspose()) {
+            copy.buildTranspose();
+        }
+        return SparseMatrix(_cols, _rows, copy._columnPointers, copy._rowIndices, copy._transposedValues);
+    }
+
+    /**
+     * @brief Overload of the multiplication operator for multiplying a sparse matrix and a MyBLAS::Vector.
+     * @param A The sparse matrix.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    friend Vector<T> operator*(const SparseMatrix &A, const Vector<T> &x) {
+        return A.apply(x);
+    }
+
+    /**
+     * @brief Overloaded stream insertion operator to print the matrix as (row, col) value triplets.
+     * @param os Output stream.
+     * @param m Matrix to print.
+     * @return Output stream with the matrix.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const SparseMatrix &m) {
+        for (size_t row = 0; row < m._rows; row++) {
+            for (size_t k = m._rowPointers[row]; k < m._rowPointers[row + 1]; k++) {
+                os << "(" << row << ", " << m._columnIndices[k] << ") " << m._values[k] << "\n";
+            }
+        }
+        return os;
+    }
+
+  private:
+    /**
+     * @brief Builds the CSR arrays by evaluating every entry of a rows x cols operator once.
+     * @details Counts the nonzeros of each row in parallel, prefix-sums the counts, then fills the rows in parallel.
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param at Callable returning the entry at (i, j).
+     */
+    template <typename Accessor>
+    void compress(const size_t rows, const size_t cols, Accessor &&at) {
+        _rows = rows;
+        _cols = cols;
+        _rowPointers.assign(rows + 1, 0);
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < rows; i++) {
+            size_t count = 0;
+            for (size_t j = 0; j < cols; j++) {
+                count += (at(i, j) != static_cast<T>(0));
+            }
+            _rowPointers[i + 1] = count;
+        }
+        for (size_t i = 0; i < rows; i++) {
+            _rowPointers[i + 1] += _rowPointers[i];
+        }
+        _columnIndices.resize(_rowPointers.back());
+        _values.resize(_rowPointers.back());
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < rows; i++) {
+            size_t position = _rowPointers[i];
+            for (size_t j = 0; j < cols; j++) {
+                const T value = at(i, j);
+                if (value != static_cast<T>(0)) {
+                    _columnIndices[position] = j;
+                    _values[position] = value;
+                    position++;
+                }
+            }
+        }
+        cacheDiagonal();
+    }
+
+    /**
+     * @brief Sorts the entries of a row by column index.
+     * @param row The row index.
+     */
+    void sortRow(const size_t row) {
+        const size_t begin = _rowPointers[row], end = _rowPointers[row + 1];
+        // rows hold a handful of entries, so insertion sort is all that is needed here
+        for (size_t k = begin + 1; k < end; k++) {
+            const size_t col = _columnIndices[k];
+            const T value = _values[k];
+            size_t position = k;
+            while (position > begin && _columnIndices[position - 1] > col) {
+                _columnIndices[position] = _columnIndices[position - 1];
+                _values[position] = _values[position - 1];
+                position--;
+            }
+            _columnIndices[position] = col;
+            _values[position] = value;
+        }
+    }
+
+    /**
+     * @brief Caches the diagonal entries, so that relaxation sweeps don't have to search for them.
+     */
+    void cacheDiagonal() {
+        _diagonal.assign(_rows, static_cast<T>(0));
+        for (size_t row = 0; row < _rows; row++) {
+            for (size_t k = _rowPointers[row]; k < _rowPointers[row + 1]; k++) {
+                if (_columnIndices[k] == row) {
+                    _diagonal[row] = _values[k];
+                    break;
+                }
+            }
+        }
+    }
+};
+
+} // namespace MyBLAS
+
+#endif // NE591_008_SPARSEMATRIX_H
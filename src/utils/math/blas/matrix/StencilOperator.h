@@ -0,0 +1,143 @@
+/**
+* @file StencilOperator.h
+* @brief Detection trait and row helpers for matrix-free stencil operators.
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @details A stencil operator is a square matrix that knows where its nonzeros are, so that row-wise relaxation
+* sweeps and matrix-vector products only need to visit those entries instead of scanning every column. Any matrix
+* type that provides the following members is treated as a stencil operator:
+*
+*   - getStencilDiagonal(row)      : the diagonal entry a(row, row)
+*   - offDiagonalProduct(row, x)   : sum over col != row of a(row, col) * x[col], visiting only the nonzeros
+*   - forEachNeighbor(row, fn)     : calls fn(col, a(row, col)) for every off-diagonal nonzero in the row
+*   - apply(x, y)                  : fused y = A * x into a caller-owned buffer
+*
+* The helpers below let solver templates be written once and pick the O(nnz) path at compile time, falling back to
+* the dense row scan for MyBLAS::Matrix and generic MyBLAS::LazyMatrix types.
+ */
+
+#ifndef NE591_008_STENCILOPERATOR_H
+#define NE591_008_STENCILOPERATOR_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace MyBLAS {
+
+/**
+ * @brief Detects whether MatrixType exposes the stencil operator interface.
+ * @tparam MatrixType The matrix type to inspect.
+ */
+template <typename MatrixType, typename = void>
+struct is_stencil_operator : std::false_type {};
+
+template <typename MatrixType>
+struct is_stencil_operator<MatrixType, std::void_t<decltype(std::declval<const MatrixType &>().getStencilDiagonal(std::declval<size_t>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Convenience variable template for is_stencil_operator.
+ */
+template <typename MatrixType>
+inline constexpr bool is_stencil_operator_v = is_stencil_operator<MatrixType>::value;
+
+/**
+ * @brief Detects whether MatrixType can write its matrix-vector product into a caller-owned VectorType, through a
+ * member apply(x, y). Stencil operators and MyBLAS::Matrix both provide it.
+ * @tparam MatrixType The matrix type to inspect.
+ * @tparam VectorType The vector type of x and y.
+ */
+template <typename MatrixType, typename VectorType, typename = void>
+struct has_apply : std::false_type {};
+
+template <typename MatrixType, typename VectorType>
+struct has_apply<MatrixType, VectorType, std::void_t<decltype(std::declval<const MatrixType &>().apply(std::declval<const VectorType &>(), std::declval<VectorType &>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Convenience variable template for has_apply.
+ */
+template <typename MatrixType, typename VectorType>
+inline constexpr bool has_apply_v = has_apply<MatrixType, VectorType>::value;
+
+/**
+ * @brief Returns the diagonal entry a(row, row) of the matrix.
+ * @param A The matrix.
+ * @param row The row index.
+ * @return The diagonal entry.
+ */
+template <template<typename> class MatrixType, typename T>
+inline T diagonalEntry(const MatrixType<T> &A, const size_t row) {
+    if constexpr (is_stencil_operator_v<MatrixType<T>>) {
+        return A.getStencilDiagonal(row);
+    } else {
+        return A[row][row];
+    }
+}
+
+/**
+ * @brief Computes the off-diagonal part of the row product, i.e. sum over col != row of a(row, col) * x[col].
+ * @details For stencil operators only the nonzeros are visited. For everything else, the full row is scanned and the
+ * diagonal contribution is subtracted back out, which is how the relaxation methods have always computed it.
+ * @param A The matrix.
+ * @param row The row index.
+ * @param x The vector to multiply with.
+ * @return The off-diagonal row product.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+inline T offDiagonalRowProduct(const MatrixType<T> &A, const size_t row, const VectorType<T> &x) {
+    if constexpr (is_stencil_operator_v<MatrixType<T>>) {
+        return A.offDiagonalProduct(row, x);
+    } else {
+        const size_t n = A.getCols();
+        // subtract the contribution from the diagonal term, since it should not be counted.
+        T sum = -(A[row][row] * x[row]);
+        for (size_t col = 0; col < n; col++) {
+            sum += A[row][col] * x[col];
+        }
+        return sum;
+    }
+}
+
+/**
+ * @brief Calls function(col, a(row, col)) for the entries of a row, diagonal included.
+ * @details Stencil operators only visit their nonzeros, with the diagonal first. For everything else, every column of
+ * the row is visited in order.
+ * @param A The matrix.
+ * @param row The row index.
+ * @param function The callable to invoke for every visited entry.
+ */
+template <template<typename> class MatrixType, typename T, typename Function>
+inline void forEachNonZeroInRow(const MatrixType<T> &A, const size_t row, Function &&function) {
+    if constexpr (is_stencil_operator_v<MatrixType<T>>) {
+        function(row, A.getStencilDiagonal(row));
+        A.forEachNeighbor(row, function);
+    } else {
+        const size_t n = A.getCols();
+        for (size_t col = 0; col < n; col++) {
+            function(col, static_cast<T>(A[row][col]));
+        }
+    }
+}
+
+/**
+ * @brief Computes y = A * x into a caller-owned vector.
+ * @details Matrix types with an apply(x, y) member, i.e. stencil operators and dense matrices, write straight into y
+ * and do not allocate. Other matrix types fall back to the regular operator*.
+ * @param A The matrix.
+ * @param x The vector to multiply with.
+ * @param y The output vector. When A has apply(x, y), it must already have A.getRows() elements.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+inline void multiplyInto(const MatrixType<T> &A, const VectorType<T> &x, VectorType<T> &y) {
+    if constexpr (has_apply_v<MatrixType<T>, VectorType<T>>) {
+        A.apply(x, y);
+    } else {
+        y = A * x;
+    }
+}
+
+} // namespace MyBLAS
+
+#endif // NE591_008_STENCILOPERATOR_H
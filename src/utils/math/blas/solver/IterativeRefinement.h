@@ -0,0 +1,191 @@
+/**
+ * @file IterativeRefinement.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Mixed precision solvers, which do the expensive work in a low precision type and recover the accuracy of the
+ * working precision T with iterative refinement.
+ *
+ * Each refinement step computes the residual r = b - A * x in T, solves the correction equation A * d = r in the low
+ * precision type, and updates x += d in T. The low precision solve only has to reduce the error by a constant factor
+ * per step, which it does as long as cond(A) * eps(low) is well below one. The attainable accuracy is then set by the
+ * precision of the residual, not that of the solve. With T = long double, the factorization or the Krylov iterations
+ * run in float or double, which vectorize and move half or a quarter of the bytes of x87 arithmetic.
+ */
+
+#ifndef NE591_008_ITERATIVEREFINEMENT_H
+#define NE591_008_ITERATIVEREFINEMENT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/BandedFactorization.h"
+#include "math/factorization/LUP.h"
+#include "math/relaxation/ConjugateGradient.h"
+
+namespace MyBLAS::Solver {
+
+/**
+ * @brief Iterative refinement of A * x = b, with the corrections solved by a caller supplied low precision solver.
+ *
+ * The residual is scaled by its largest magnitude before it is rounded, so that it neither underflows nor overflows
+ * the low precision type as it shrinks. Refinement stops when the L2 norm of the residual drops below the tolerance,
+ * when max_refinements steps have been taken, or when a step fails to reduce the residual, which happens once the
+ * low precision solve no longer contracts the error. Such a step is undone, so the returned x has the smallest
+ * residual seen.
+ *
+ * @tparam LowType The precision of the correction solves.
+ * @param A The coefficient matrix, applied in the working precision T.
+ * @param b The right hand side.
+ * @param solveCorrection A callable (const Vector<LowType> &r, Vector<LowType> &d) -> size_t, which writes an
+ * approximation of A^-1 * r into d, and returns the number of iterations it took.
+ * @param max_refinements The maximum number of refinement steps.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @return The solution, with the number of refinement steps, and the total iterations of the correction solves.
+ */
+template <typename LowType, template<typename> class MatrixType, template<typename> class VectorType, typename T, typename CorrectionSolver>
+Solution<T> refine(const MatrixType<T> &A, const VectorType<T> &b, CorrectionSolver &&solveCorrection,
+                   const size_t max_refinements, const T tolerance) {
+    const size_t n = A.getRows();
+    Solution<T> results(n);
+    results.iterations = 0;
+    results.refinements = 0;
+
+    VectorType<T> r = b;
+    VectorType<T> Ax(n, 0);
+    VectorType<LowType> rLow(n, 0);
+    VectorType<LowType> dLow(n, 0);
+    auto &x = results.x;
+
+    T error = std::sqrt(r * r);
+    while (error > tolerance && results.refinements < max_refinements) {
+
+        T scale = 0;
+        for (size_t i = 0; i < n; i++) {
+            scale = std::max(scale, std::abs(r[i]));
+        }
+        for (size_t i = 0; i < n; i++) {
+            rLow[i] = static_cast<LowType>(r[i] / scale);
+        }
+
+        results.iterations += solveCorrection(rLow, dLow);
+        results.refinements++;
+
+        for (size_t i = 0; i < n; i++) {
+            x[i] += scale * static_cast<T>(dLow[i]);
+        }
+        MyBLAS::multiplyInto(A, x, Ax);
+        for (size_t i = 0; i < n; i++) {
+            Ax[i] = b[i] - Ax[i];
+        }
+        const T next = std::sqrt(Ax * Ax);
+        if (!(next < error)) {
+            for (size_t i = 0; i < n; i++) {
+                x[i] -= scale * static_cast<T>(dLow[i]);
+            }
+            break;
+        }
+        r = Ax;
+        error = next;
+    }
+
+    results.converged = (error <= tolerance);
+    results.iterative_error = error;
+    return results;
+}
+
+/**
+ * @brief Solves A * x = b with LU factors computed in LowType, refined to the working precision T.
+ *
+ * The O(n^3) factorization runs once in the low precision, and each refinement step costs one O(n^2) residual in T and
+ * one pair of triangular solves in LowType. Stencil operators, such as the diffusion matrix, are factorized in band
+ * storage instead, which costs O(n * p^2) for a bandwidth p, and never forms the dense matrix.
+ *
+ * @tparam LowType The precision of the factorization, float or double.
+ * @param A The coefficient matrix.
+ * @param b The right hand side.
+ * @param max_refinements The maximum number of refinement steps.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @return The solution. Its iterations count the triangular solves, one per refinement step.
+ */
+template <typename LowType, template<typename> class MatrixType, template<typename> class VectorType, typename T>
+Solution<T> applyMixedPrecisionLUP(const MatrixType<T> &A, const VectorType<T> &b, const size_t max_refinements,
+                                   const T tolerance) {
+    const auto singular = [&A]() {
+        std::cerr << "Mixed precision LUP: the matrix is singular in the low precision, not refining\n";
+        Solution<T> results(A.getRows());
+        results.method = MyFactorizationMethod::METHOD_LUP;
+        return results;
+    };
+
+    if constexpr (is_stencil_operator_v<MatrixType<T>>) {
+        const MyFactorizationMethod::BandedLU<LowType> factors(A);
+        if (!factors.isNonsingular()) {
+            return singular();
+        }
+        auto results = refine<LowType>(A, b, [&factors](const VectorType<LowType> &r, VectorType<LowType> &d) -> size_t {
+            d = r;
+            factors.solveInPlace(d);
+            return 1;
+        }, max_refinements, tolerance);
+        results.method = MyFactorizationMethod::METHOD_LUP;
+        return results;
+    } else {
+        MyBLAS::Matrix<LowType> LU(A.getRows(), A.getCols(), [&A](size_t i, size_t j) {
+            return static_cast<LowType>(A[i][j]);
+        });
+        std::vector<size_t> pivots;
+        if (!MyBLAS::LUP::factorizeInPlace(LU, pivots)) {
+            return singular();
+        }
+
+        auto results = refine<LowType>(A, b, [&LU, &pivots](const VectorType<LowType> &r, VectorType<LowType> &d) -> size_t {
+            d = r;
+            MyBLAS::LUP::solveInPlace(LU, pivots, d);
+            return 1;
+        }, max_refinements, tolerance);
+        results.method = MyFactorizationMethod::METHOD_LUP;
+        return results;
+    }
+}
+
+/**
+ * @brief Solves A * x = b with conjugate gradient in LowType, refined to the working precision T.
+ *
+ * Each correction is solved only until its residual has dropped by sqrt(eps(LowType)), since reducing it further is
+ * lost to the rounding of the correction anyway. The Krylov space is rebuilt at every refinement step, which costs a
+ * few extra iterations over a single solve in T, but every one of them runs in the low precision.
+ *
+ * @tparam LowType The precision of the conjugate gradient iterations, float or double.
+ * @param A The symmetric positive definite coefficient matrix, in the working precision.
+ * @param ALow The same matrix, in the low precision.
+ * @param b The right hand side.
+ * @param max_iterations The maximum total number of conjugate gradient iterations, across all refinement steps.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @return The solution. Its iterations are the total conjugate gradient iterations.
+ */
+template <typename LowType, template<typename> class MatrixType, template<typename> class VectorType, typename T>
+Solution<T> applyMixedPrecisionConjugateGradient(const MatrixType<T> &A, const MatrixType<LowType> &ALow,
+                                                 const VectorType<T> &b, const size_t max_iterations, const T tolerance) {
+    const LowType reduction = std::sqrt(std::numeric_limits<LowType>::epsilon());
+    size_t remaining = max_iterations;
+    auto results = refine<LowType>(A, b, [&ALow, &remaining, reduction](const VectorType<LowType> &r, VectorType<LowType> &d) -> size_t {
+        const auto correction = MyRelaxationMethod::applyConjugateGradient(ALow, r, remaining, reduction * std::sqrt(r * r));
+        d = correction.x;
+        remaining -= std::min(remaining, correction.iterations);
+        return correction.iterations;
+    }, max_iterations, tolerance);
+    results.method = MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT;
+    return results;
+}
+
+} // namespace MyBLAS::Solver
+
+#endif // NE591_008_ITERATIVEREFINEMENT_H
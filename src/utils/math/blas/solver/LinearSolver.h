@@ -34,7 +34,7 @@ template <class...> inline constexpr bool always_false_v = false;
  * @param value The value whose type key is to be returned.
  * @return The key of the type of the given value.
  */
-const char *TypeKey(const Type &value) {
+inline const char *TypeKey(const Type &value) {
     return std::visit(
         [](auto &&arg) {
             using T = std::decay_t<decltype(arg)>;
@@ -59,16 +59,39 @@ template <typename T> struct Solution {
     explicit Solution<T>(size_t size) { x = MyBLAS::Vector<T>(size, 0); }
 
     Solution() = default;
+
+    /**
+     * @brief Converts a solution computed in another precision, such as one selected with --working-precision.
+     */
+    template <typename U>
+    explicit Solution(const Solution<U> &other)
+        : method(other.method), converged(other.converged), iterations(other.iterations),
+          iterative_error(static_cast<T>(other.iterative_error)), refinements(other.refinements), x(other.x),
+          phi(other.phi), eigenvalue(static_cast<T>(other.eigenvalue)),
+          eigenvalue_imaginary(static_cast<T>(other.eigenvalue_imaginary)),
+          eigenvalue_iterative_error(static_cast<T>(other.eigenvalue_iterative_error)), residual(other.residual),
+          residual_infinite_norm(static_cast<T>(other.residual_infinite_norm)) {}
+
     MyBLAS::Solver::Type method;
     bool converged = false;
     size_t iterations = std::numeric_limits<size_t>::quiet_NaN();
     T iterative_error = std::numeric_limits<T>::quiet_NaN();
 
+    /**
+     * @brief The number of iterative refinement steps taken by a mixed precision solve, and zero otherwise.
+     */
+    size_t refinements = 0;
+
     MyBLAS::Vector<T> x{};
 
     MyBLAS::Matrix<T> phi{};
 
     T eigenvalue = std::numeric_limits<T>::quiet_NaN();
+
+    /**
+     * @brief The imaginary part of a complex eigenvalue, such as one found by Arnoldi, and NaN for a real eigenvalue.
+     */
+    T eigenvalue_imaginary = std::numeric_limits<T>::quiet_NaN();
     T eigenvalue_iterative_error = std::numeric_limits<T>::quiet_NaN();
 
     MyBLAS::Vector<T> residual{};
@@ -91,10 +114,18 @@ template <typename T> struct Solution {
         jsonMap["iterative-error"]["x"] = iterative_error;
         jsonMap["x"] = x.getData();
 
+        if (refinements > 0) {
+            jsonMap["refinement-steps"] = refinements;
+        }
+
         if (!std::isnan(eigenvalue)) {
             jsonMap["eigenvalue"] = eigenvalue;
         }
 
+        if (!std::isnan(eigenvalue_imaginary)) {
+            jsonMap["eigenvalue-imaginary"] = eigenvalue_imaginary;
+        }
+
         if (!std::isnan(eigenvalue_iterative_error)) {
             jsonMap["iterative-error"]["eigenvalue"] = eigenvalue_iterative_error;
         }
@@ -123,12 +154,20 @@ template <typename T> struct Solution {
         os << ":::::: Iterations       :     " << solution.iterations << std::endl;
         os << ":::::: Iterative Error  :     " << solution.iterative_error << std::endl;
 
+        if (solution.refinements > 0) {
+            os << ":::::: Refinement Steps :     " << solution.refinements << std::endl;
+        }
+
         os << ":::::: Iterate Vector x : " << solution.x;
 
         if (!std::isnan(solution.eigenvalue)) {
             os << ":::::: Eigenvalue       :     " << solution.eigenvalue << std::endl;
         }
 
+        if (!std::isnan(solution.eigenvalue_imaginary)) {
+            os << ":::::: Eigenvalue (Im)  :     " << solution.eigenvalue_imaginary << std::endl;
+        }
+
         if (!std::isnan(solution.eigenvalue_iterative_error)) {
             os << ":::::: Eigenvalue Error :     " << solution.eigenvalue_iterative_error << std::endl;
         }
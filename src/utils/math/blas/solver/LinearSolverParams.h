@@ -26,6 +26,7 @@
 
 #include "matrix/LazyMatrix.h"
 #include "matrix/Matrix.h"
+#include "matrix/SparseMatrix.h"
 #include "vector/LazyVector.h"
 #include "vector/Vector.h"
 
@@ -227,7 +228,7 @@ struct TemplatedParameters {
      * @throw std::invalid_argument if the size of the constants vector does not match with the size.
      */
     TemplatedParameters& setConstants(const VectorType<T>& _constants) {
-        if (_constants.getSize() != n) {
+        if (_constants.size() != n) {
             throw std::invalid_argument("Invalid size for the constants vector. It should match with the size.");
         }
         constants = _constants;
@@ -243,7 +244,7 @@ struct TemplatedParameters {
      * @throw std::invalid_argument if the size of the initial guess vector does not match with the size n.
      */
     TemplatedParameters& setInitialGuess(const VectorType<T>& _initial_guess) {
-        if (_initial_guess.getSize() != n) {
+        if (_initial_guess.size() != n) {
             throw std::invalid_argument("Invalid size for the constants vector. It should match with the size n.");
         }
         initial_guess = _initial_guess;
@@ -341,6 +342,13 @@ struct Parameters : public TemplatedParameters<MyBLAS::Matrix, MyBLAS::Vector, T
 template <typename T>
 struct LazyParameters : public TemplatedParameters<MyBLAS::LazyMatrix, MyBLAS::LazyVector, T> {};
 
+/**
+ * @brief Structure that represents the input to the linear solver, with the coefficients stored in CSR format.
+ * @tparam T The type of the elements in the matrix/vector.
+ */
+template <typename T>
+struct SparseParameters : public TemplatedParameters<MyBLAS::SparseMatrix, MyBLAS::Vector, T> {};
+
 }  // namespace MyBLAS
 
 #endif // NE591_008_LINEARSOLVERPARAMS_H
@@ -0,0 +1,97 @@
+/**
+* @file PrecisionTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the runtime selection of the working precision, and for converting solutions
+* between precisions.
+ */
+
+#include "math/blas/Precision.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+namespace MyBLAS {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(PrecisionTests, NumericTypes);
+
+template <typename T> class PrecisionTests : public ::testing::Test {
+  protected:
+    static Precision precisionOf() {
+        if constexpr (std::is_same_v<T, float>) {
+            return PRECISION_FLOAT;
+        } else if constexpr (std::is_same_v<T, double>) {
+            return PRECISION_DOUBLE;
+        } else {
+            return PRECISION_LONG_DOUBLE;
+        }
+    }
+};
+
+// Every key parses back to its precision, and unknown keys leave the precision untouched
+TEST(PrecisionKeyTests, ParseRoundTripTest) {
+    for (const auto precision : {PRECISION_FLOAT, PRECISION_DOUBLE, PRECISION_LONG_DOUBLE}) {
+        Precision parsed = PRECISION_LONG_DOUBLE;
+        EXPECT_TRUE(parsePrecision(PrecisionKey(precision), parsed));
+        EXPECT_EQ(parsed, precision);
+    }
+    Precision parsed = PRECISION_DOUBLE;
+    EXPECT_FALSE(parsePrecision("quad", parsed));
+    EXPECT_FALSE(parsePrecision("", parsed));
+    EXPECT_EQ(parsed, PRECISION_DOUBLE);
+}
+
+// float128 cannot instantiate the solvers, so it is rejected rather than run in another type
+TEST(PrecisionKeyTests, Float128RejectedTest) {
+    Precision parsed = PRECISION_FLOAT;
+    EXPECT_FALSE(parsePrecision("float128", parsed));
+    EXPECT_EQ(parsed, PRECISION_FLOAT);
+}
+
+// The dispatched callable sees the selected type, and its return value is passed through
+TYPED_TEST(PrecisionTests, DispatchSelectsTypeTest) {
+    const auto size = dispatchPrecision(TestFixture::precisionOf(), [](auto precision) {
+        using T = typename decltype(precision)::type;
+        EXPECT_TRUE((std::is_same_v<T, TypeParam>));
+        return sizeof(T);
+    });
+    EXPECT_EQ(size, sizeof(TypeParam));
+}
+
+// A solution converts to long double and back without losing anything representable in TypeParam
+TYPED_TEST(PrecisionTests, SolutionConversionTest) {
+    Solver::Solution<TypeParam> solution(4);
+    solution.method = MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT;
+    solution.converged = true;
+    solution.iterations = 17;
+    solution.refinements = 2;
+    solution.iterative_error = static_cast<TypeParam>(0.125);
+    for (size_t i = 0; i < 4; i++) {
+        solution.x[i] = static_cast<TypeParam>(1) / static_cast<TypeParam>(i + 3);
+    }
+
+    const Solver::Solution<long double> wide(solution);
+    EXPECT_EQ(wide.method, Solver::Type(MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT));
+    EXPECT_TRUE(wide.converged);
+    EXPECT_EQ(wide.iterations, 17);
+    EXPECT_EQ(wide.refinements, 2);
+    EXPECT_EQ(wide.iterative_error, 0.125L);
+    EXPECT_TRUE(std::isnan(wide.eigenvalue));
+    EXPECT_EQ(wide.phi.getRows(), 0);
+
+    const Solver::Solution<TypeParam> narrow(wide);
+    ASSERT_EQ(narrow.x.size(), 4);
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(wide.x[i], static_cast<long double>(solution.x[i]));
+        EXPECT_EQ(narrow.x[i], solution.x[i]);
+    }
+}
+
+} // namespace MyBLAS
@@ -7,6 +7,7 @@
  */
 
 #include "math/blas/matrix/Matrix.h"
+#include <cstdint>
 #include <gtest/gtest.h>
 
 #define TOLERANCE 1e-14
@@ -552,4 +553,40 @@ TYPED_TEST(BaseMatrixTests, InstanceTrackingOnMoveAssignment) {
     EXPECT_EQ(this->map->getCurrentInstanceCount(), initialCount);
 }
 
+// Test that rows live in one aligned buffer, padded to the leading dimension, and that the row views alias it
+TYPED_TEST(BaseMatrixTests, ContiguousStorageLayout) {
+    const size_t rows = 5, cols = 37;
+    Matrix<TypeParam> m(rows, cols, [](size_t i, size_t j) { return static_cast<TypeParam>(i * 100 + j); });
+    const size_t ld = m.getLeadingDimension();
+    EXPECT_GE(ld, cols);
+    for (size_t i = 0; i < rows; ++i) {
+        EXPECT_EQ(m[i].data(), m.getBuffer() + i * ld);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m[i].data()) % CacheLineBytes, 0u);
+        EXPECT_EQ(m[i].size(), cols);
+    }
+
+    // writing through a row view writes into the matrix, and assigning a row copies it
+    m[1][2] = 7;
+    EXPECT_EQ(m(1, 2), static_cast<TypeParam>(7));
+    m[3] = m[1];
+    EXPECT_EQ(m(3, 2), static_cast<TypeParam>(7));
+    EXPECT_EQ(m(3, 36), static_cast<TypeParam>(136));
+
+    // the nested vector shims still round-trip
+    const std::vector<std::vector<TypeParam>> nested = m.getData();
+    ASSERT_EQ(nested.size(), rows);
+    EXPECT_EQ(nested[4], static_cast<std::vector<TypeParam>>(m[4]));
+    EXPECT_EQ(Matrix<TypeParam>(nested), m);
+
+    Matrix<TypeParam> appended;
+    for (const auto &row : nested) {
+        appended.push_back(row);
+    }
+    EXPECT_EQ(appended, m);
+
+    m.swapRows(0, 4);
+    EXPECT_EQ(m(0, 0), static_cast<TypeParam>(400));
+    EXPECT_EQ(m(4, 0), static_cast<TypeParam>(0));
+}
+
 } // namespace MyBLAS
@@ -0,0 +1,120 @@
+/**
+* @file GEMMTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the blocked MyBLAS::gemm kernel.
+ */
+
+#include "math/Random.h"
+#include "math/blas/GEMM.h"
+#include "math/blas/matrix/Matrix.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace MyBLAS {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(GEMMTests, NumericTypes);
+
+template <typename T>
+class GEMMTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief Checks C against alpha * A * B + beta * C0, accumulated naively in long double.
+     */
+    static void expectProduct(const T alpha, const Matrix<T> &A, const Matrix<T> &B, const T beta, const Matrix<T> &C0,
+                              const Matrix<T> &C) {
+        const size_t m = A.getRows(), n = B.getCols(), k = A.getCols();
+        ASSERT_EQ(C.getRows(), m);
+        ASSERT_EQ(C.getCols(), n);
+        const auto epsilon = static_cast<long double>(std::numeric_limits<T>::epsilon());
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                long double expected = 0, magnitude = 0;
+                for (size_t p = 0; p < k; ++p) {
+                    expected += static_cast<long double>(A[i][p]) * static_cast<long double>(B[p][j]);
+                    magnitude += std::abs(static_cast<long double>(A[i][p]) * static_cast<long double>(B[p][j]));
+                }
+                expected = static_cast<long double>(alpha) * expected + static_cast<long double>(beta) * static_cast<long double>(C0[i][j]);
+                magnitude = std::abs(static_cast<long double>(alpha)) * magnitude + std::abs(static_cast<long double>(beta) * static_cast<long double>(C0[i][j]));
+                const long double tolerance = 4 * static_cast<long double>(k + 2) * epsilon * magnitude;
+                EXPECT_LE(std::abs(static_cast<long double>(C[i][j]) - expected), tolerance) << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+};
+
+// Test odd shapes that leave partial micro-tiles and partial cache blocks in every dimension
+TYPED_TEST(GEMMTests, ShapesTest) {
+    size_t seed = 42;
+    const std::vector<std::tuple<size_t, size_t, size_t>> shapes = {
+        {1, 1, 1}, {7, 5, 3}, {6, 32, 17}, {37, 53, 29}, {130, 97, 300}, {97, 130, 513}, {200, 1, 64}, {1, 200, 64},
+    };
+    for (const auto &[m, n, k] : shapes) {
+        const auto A = Random::generate_matrix<TypeParam>(m, k, -1, 1, ++seed);
+        const auto B = Random::generate_matrix<TypeParam>(k, n, -1, 1, ++seed);
+        const Matrix<TypeParam> zero(m, n, 0);
+        const Matrix<TypeParam> C = A * B;
+        TestFixture::expectProduct(1, A, B, 0, zero, C);
+    }
+}
+
+// Test that alpha scales the product and beta scales what was in C, and that beta = 0 ignores NaNs in C
+TYPED_TEST(GEMMTests, AlphaBetaTest) {
+    const size_t m = 45, n = 70, k = 90;
+    const auto A = Random::generate_matrix<TypeParam>(m, k, -1, 1, 7);
+    const auto B = Random::generate_matrix<TypeParam>(k, n, -1, 1, 8);
+    const auto C0 = Random::generate_matrix<TypeParam>(m, n, -1, 1, 9);
+
+    Matrix<TypeParam> C = C0;
+    gemm(static_cast<TypeParam>(-0.5), A, B, static_cast<TypeParam>(2), C);
+    TestFixture::expectProduct(static_cast<TypeParam>(-0.5), A, B, static_cast<TypeParam>(2), C0, C);
+
+    Matrix<TypeParam> overwritten(m, n, std::numeric_limits<TypeParam>::quiet_NaN());
+    gemm(static_cast<TypeParam>(1), A, B, static_cast<TypeParam>(0), overwritten);
+    TestFixture::expectProduct(1, A, B, 0, Matrix<TypeParam>(m, n, 0), overwritten);
+}
+
+// Test the in-place Schur complement update used by the recursive LU factorizations
+TYPED_TEST(GEMMTests, SchurComplementTest) {
+    const size_t n = 80;
+    const auto A21 = Random::generate_matrix<TypeParam>(n, 1, -1, 1, 11);
+    const auto A12 = Random::generate_matrix<TypeParam>(1, n, -1, 1, 12);
+    const auto A22 = Random::generate_matrix<TypeParam>(n, n, -1, 1, 13);
+    Matrix<TypeParam> updated = A22;
+    gemm(static_cast<TypeParam>(-1), A21, A12, static_cast<TypeParam>(1), updated);
+    TestFixture::expectProduct(-1, A21, A12, 1, A22, updated);
+}
+
+// Test the raw pointer interface on sub-blocks, where the leading dimensions are wider than the blocks
+TYPED_TEST(GEMMTests, LeadingDimensionTest) {
+    const size_t m = 33, n = 41, k = 57;
+    const auto bigA = Random::generate_matrix<TypeParam>(m + 5, k + 9, -1, 1, 21);
+    const auto bigB = Random::generate_matrix<TypeParam>(k + 3, n + 7, -1, 1, 22);
+    Matrix<TypeParam> bigC(m + 2, n + 11, 0);
+
+    gemm(m, n, k, static_cast<TypeParam>(1), bigA.rowPointer(2) + 4, bigA.getLeadingDimension(), bigB.rowPointer(1) + 3,
+         bigB.getLeadingDimension(), static_cast<TypeParam>(0), bigC.rowPointer(1) + 5, bigC.getLeadingDimension());
+
+    const auto A = bigA.subMatrix(2, 4, m, k);
+    const auto B = bigB.subMatrix(1, 3, k, n);
+    TestFixture::expectProduct(1, A, B, 0, Matrix<TypeParam>(m, n, 0), bigC.subMatrix(1, 5, m, n));
+
+    // nothing outside the target block was touched
+    for (size_t j = 0; j < bigC.getCols(); ++j) {
+        EXPECT_EQ(bigC[0][j], static_cast<TypeParam>(0));
+    }
+    for (size_t i = 0; i < bigC.getRows(); ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            EXPECT_EQ(bigC[i][j], static_cast<TypeParam>(0));
+        }
+    }
+}
+
+} // namespace MyBLAS
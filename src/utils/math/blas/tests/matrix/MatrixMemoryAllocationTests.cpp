@@ -71,4 +71,34 @@ TYPED_TEST(MatrixMemoryAllocationTests, ConstructorTest) {
     }
 }
 
+// The buffer allocations are recorded as they happen, and released when the matrices go out of scope
+TYPED_TEST(MatrixMemoryAllocationTests, TrackedBytesTest) {
+    using Monitor = ResourceMonitor<Matrix<TypeParam>>;
+    const size_t rows = 36;
+    const size_t cols = 42;
+    const size_t heldBefore = Monitor::getCurrentBytes();
+    const size_t instancesBefore = Monitor::getCurrentInstanceCount();
+    Monitor::clear();
+    EXPECT_EQ(Monitor::getMaxBytesEver(), heldBefore);
+    {
+        Matrix<TypeParam> matrix1(rows, cols);
+        const size_t held = Monitor::getCurrentBytes() - heldBefore;
+        EXPECT_GE(held, rows * cols * sizeof(TypeParam));
+        EXPECT_EQ(Monitor::getCurrentInstanceCount(), instancesBefore + 1);
+
+        Matrix<TypeParam> matrix2 = matrix1;
+        EXPECT_EQ(Monitor::getCurrentBytes() - heldBefore, 2 * held);
+        EXPECT_EQ(Monitor::getAllocationCount(), 2u);
+
+        // a move hands the buffer over without allocating
+        Matrix<TypeParam> matrix3 = std::move(matrix2);
+        EXPECT_EQ(Monitor::getCurrentBytes() - heldBefore, 2 * held);
+        EXPECT_EQ(Monitor::getAllocationCount(), 2u);
+        EXPECT_EQ(Monitor::getCurrentInstanceCount(), instancesBefore + 3);
+    }
+    EXPECT_EQ(Monitor::getCurrentBytes(), heldBefore);
+    EXPECT_EQ(Monitor::getCurrentInstanceCount(), instancesBefore);
+    EXPECT_GE(Monitor::getMaxBytesEver() - heldBefore, 2 * rows * cols * sizeof(TypeParam));
+}
+
 } // namespace MyBLAS
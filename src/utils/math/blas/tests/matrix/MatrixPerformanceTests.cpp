@@ -8,9 +8,11 @@
 
 #include "math/Random.h"
 #include "math/blas/matrix/Matrix.h"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <gtest/gtest.h>
+#include <limits>
 #include <omp.h>
 
 namespace MyBLAS {
@@ -54,9 +56,56 @@ TYPED_TEST(PerformanceMatrixTests, MatrixMultiplicationPerformanceTest) {
         elapsed = end - start;
         std::cout << "Time taken for openmp matrix multiplication of size " << size << "x" << size << ": " << elapsed.count() << "s\n";
 
+        // operator* blocks the k loop, so its sums are rounded in a different order than the triple loop above
+        const auto tolerance = std::max(1e-6, static_cast<double>(size) * 2000.0 * static_cast<double>(std::numeric_limits<TypeParam>::epsilon()));
         for (size_t i = 0; i < size; ++i) {
             for (size_t j = 0; j < size; ++j) {
-                ASSERT_NEAR(static_cast<double>(m4[i][j]), static_cast<double>(m3[i][j]), static_cast<double>(1e-6));
+                ASSERT_NEAR(static_cast<double>(m4[i][j]), static_cast<double>(m3[i][j]), tolerance);
+            }
+        }
+    }
+}
+
+// Compares the contiguous Matrix storage against the nested std::vector<std::vector<T>> layout it replaced, using the
+// same triple loop that Matrix::operator* used to run on the nested layout as the baseline.
+TYPED_TEST(PerformanceMatrixTests, ContiguousStoragePerformanceTest) {
+    size_t seed = 591;
+    const size_t BASE = 2, MIN_POWER = 4, MAX_POWER = 9, STEP = 1;
+    const auto min = static_cast<size_t>(std::pow(BASE, MIN_POWER));
+    const auto max = static_cast<size_t>(std::pow(BASE, MAX_POWER));
+    for (auto size = min; size <= max; size *= (BASE * STEP)) {
+
+        auto m1 = Random::generate_matrix<TypeParam>(size, size, -100, 100, ++seed);
+        auto m2 = Random::generate_matrix<TypeParam>(size, size, -20, 20, ++seed);
+        const std::vector<std::vector<TypeParam>> nested1 = m1.getData(), nested2 = m2.getData();
+
+        std::vector<std::vector<TypeParam>> nested3(size, std::vector<TypeParam>(size, 0));
+        auto start = std::chrono::high_resolution_clock::now();
+        #pragma omp parallel for default(none) shared(nested1, nested2, nested3, size)
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = 0; j < size; ++j) {
+                for (size_t k = 0; k < size; ++k) {
+                    nested3[i][j] += nested1[i][k] * nested2[k][j];
+                }
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<long double> nested = end - start;
+
+        start = std::chrono::high_resolution_clock::now();
+        Matrix<TypeParam> m3 = m1 * m2;
+        end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<long double> contiguous = end - start;
+
+        std::cout << "[" << sizeof(TypeParam) << "]b: matrix multiplication of size " << size << "x" << size
+                  << ", nested rows: " << nested.count() << "s, contiguous: " << contiguous.count() << "s, speedup: "
+                  << nested.count() / contiguous.count() << "x\n";
+
+        // the two sum in different orders, so allow for the rounding of size terms of magnitude up to 100 * 20
+        const auto tolerance = static_cast<double>(size) * 2000.0 * static_cast<double>(std::numeric_limits<TypeParam>::epsilon());
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = 0; j < size; ++j) {
+                ASSERT_NEAR(static_cast<double>(nested3[i][j]), static_cast<double>(m3[i][j]), tolerance);
             }
         }
     }
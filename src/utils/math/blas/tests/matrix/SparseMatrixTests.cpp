@@ -0,0 +1,222 @@
+/**
+* @file SparseMatrixTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the MyBLAS::SparseMatrix class.
+ */
+
+#include "math/blas/matrix/LazyMatrix.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/PowerIteration.h"
+#include "math/relaxation/SOR.h"
+#include "math/relaxation/SORPJ.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyBLAS {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(SparseMatrixTests, NumericTypes);
+
+template <typename T>
+class SparseMatrixTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief A small, symmetric, diagonally dominant tridiagonal matrix with a zero off the band.
+     */
+    static Matrix<T> tridiagonal(const size_t n) {
+        return Matrix<T>(n, n, [](size_t i, size_t j) -> T {
+            if (i == j) {
+                return 4;
+            }
+            return (i == j + 1 || j == i + 1) ? -1 : 0;
+        });
+    }
+
+    /**
+     * @brief A non-symmetric matrix, with an empty row and a missing diagonal entry.
+     */
+    static Matrix<T> unstructured() {
+        return Matrix<T>({{1, 0, 2, 0}, {0, 0, 0, 0}, {3, 0, 0, 4}, {0, 5, 0, 6}, {7, 0, 8, 0}});
+    }
+};
+
+// Test that compressing a dense matrix keeps exactly its nonzeros
+TYPED_TEST(SparseMatrixTests, FromMatrixTest) {
+    const auto dense = TestFixture::unstructured();
+    const SparseMatrix<TypeParam> sparse(dense);
+    EXPECT_EQ(sparse.getRows(), 5);
+    EXPECT_EQ(sparse.getCols(), 4);
+    EXPECT_EQ(sparse.getNonZeros(), 8);
+    EXPECT_EQ(sparse.getRowPointers(), std::vector<size_t>({0, 2, 2, 4, 6, 8}));
+    EXPECT_EQ(sparse.getColumnIndices(), std::vector<size_t>({0, 2, 0, 3, 1, 3, 0, 2}));
+    for (size_t i = 0; i < dense.getRows(); i++) {
+        for (size_t j = 0; j < dense.getCols(); j++) {
+            EXPECT_EQ(sparse(i, j), dense[i][j]);
+            EXPECT_EQ(sparse[i][j], dense[i][j]);
+        }
+    }
+    EXPECT_EQ(sparse.getStencilDiagonal(0), 1);
+    EXPECT_EQ(sparse.getStencilDiagonal(2), 0);
+    EXPECT_EQ(sparse.getStencilDiagonal(3), 6);
+}
+
+// Test that compressing a lazy matrix matches compressing the equivalent dense matrix
+TYPED_TEST(SparseMatrixTests, FromLazyMatrixTest) {
+    const auto dense = TestFixture::tridiagonal(6);
+    const LazyMatrix<TypeParam> lazy(dense);
+    const SparseMatrix<TypeParam> fromLazy(lazy);
+    const SparseMatrix<TypeParam> fromDense(dense);
+    EXPECT_EQ(fromLazy.getNonZeros(), 16);
+    EXPECT_EQ(fromLazy.getRowPointers(), fromDense.getRowPointers());
+    EXPECT_EQ(fromLazy.getColumnIndices(), fromDense.getColumnIndices());
+    EXPECT_EQ(fromLazy.getValues(), fromDense.getValues());
+}
+
+// Test the constructor that takes the CSR arrays, and the conversion back to a dense matrix
+TYPED_TEST(SparseMatrixTests, FromArraysTest) {
+    const SparseMatrix<TypeParam> sparse(3, 3, {0, 2, 3, 5}, {0, 2, 1, 0, 2}, {1, 2, 3, 4, 5});
+    const Matrix<TypeParam> dense(sparse);
+    const Matrix<TypeParam> expected({{1, 0, 2}, {0, 3, 0}, {4, 0, 5}});
+    EXPECT_EQ(dense, expected);
+}
+
+// Test the sparse matrix-vector products against the dense ones
+TYPED_TEST(SparseMatrixTests, MatrixVectorProductTest) {
+    const auto dense = TestFixture::unstructured();
+    SparseMatrix<TypeParam> sparse(dense);
+    const Vector<TypeParam> x({1, 2, 3, 4});
+    const Vector<TypeParam> expected = dense * x;
+
+    const Vector<TypeParam> product = sparse * x;
+    Vector<TypeParam> y(5, 0);
+    sparse.apply(x, y);
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(product[i], expected[i]);
+        EXPECT_EQ(y[i], expected[i]);
+    }
+}
+
+// Test the transposed products, both with and without the CSC copy
+TYPED_TEST(SparseMatrixTests, TransposeTest) {
+    const auto dense = TestFixture::unstructured();
+    SparseMatrix<TypeParam> sparse(dense);
+    const Vector<TypeParam> x({1, 2, 3, 4, 5});
+    Vector<TypeParam> expected(4, 0);
+    for (size_t i = 0; i < dense.getRows(); i++) {
+        for (size_t j = 0; j < dense.getCols(); j++) {
+            expected[j] += dense[i][j] * x[i];
+        }
+    }
+
+    Vector<TypeParam> scattered(4, 0);
+    EXPECT_FALSE(sparse.hasTranspose());
+    sparse.applyTranspose(x, scattered);
+
+    const size_t bytesBefore = sparse.getAllocatedBytes();
+    sparse.buildTranspose();
+    EXPECT_TRUE(sparse.hasTranspose());
+    EXPECT_GT(sparse.getAllocatedBytes(), bytesBefore);
+    Vector<TypeParam> gathered(4, 0);
+    sparse.applyTranspose(x, gathered);
+
+    const auto transposed = sparse.transpose();
+    EXPECT_EQ(transposed.getRows(), 4);
+    EXPECT_EQ(transposed.getCols(), 5);
+    const Vector<TypeParam> product = transposed * x;
+
+    for (size_t j = 0; j < expected.size(); j++) {
+        EXPECT_EQ(scattered[j], expected[j]);
+        EXPECT_EQ(gathered[j], expected[j]);
+        EXPECT_EQ(product[j], expected[j]);
+    }
+}
+
+// Test that the allocated bytes track the stored entries, not the dense size
+TYPED_TEST(SparseMatrixTests, AllocatedBytesTest) {
+    const size_t n = 256;
+    const SparseMatrix<TypeParam> sparse(TestFixture::tridiagonal(n));
+    const size_t stored = sparse.getNonZeros() * (sizeof(TypeParam) + sizeof(size_t)) + (n + 1) * sizeof(size_t) + n * sizeof(TypeParam);
+    EXPECT_GE(sparse.getAllocatedBytes(true), stored);
+    EXPECT_LT(sparse.getAllocatedBytes(true), n * n * sizeof(TypeParam));
+    EXPECT_TRUE(is_stencil_operator_v<SparseMatrix<TypeParam>>);
+}
+
+// Test that the relaxation and CG solvers give the same answer on the sparse matrix as on the dense matrix
+TYPED_TEST(SparseMatrixTests, SolversMatchDenseMatrixTest) {
+    const auto dense = TestFixture::tridiagonal(12);
+    const SparseMatrix<TypeParam> sparse(dense);
+    const Vector<TypeParam> b(12, [](size_t i) { return static_cast<TypeParam>(i % 3) + 1; });
+    const size_t max_iterations = 1000;
+    const TypeParam threshold = std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+    const TypeParam tolerance = 100 * threshold;
+
+    const auto check = [&](const Solver::Solution<TypeParam> &reference, const Solver::Solution<TypeParam> &solution) {
+        EXPECT_EQ(solution.converged, reference.converged);
+        for (size_t i = 0; i < b.size(); i++) {
+            EXPECT_LE(std::abs(solution.x[i] - reference.x[i]), tolerance);
+        }
+    };
+
+    check(MyRelaxationMethod::applyPointJacobi(dense, b, max_iterations, threshold),
+          MyRelaxationMethod::applyPointJacobi(sparse, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applySORSerial(dense, b, max_iterations, threshold, static_cast<TypeParam>(1.1)),
+          MyRelaxationMethod::applySORSerial(sparse, b, max_iterations, threshold, static_cast<TypeParam>(1.1)));
+    check(MyRelaxationMethod::applySOR(dense, b, max_iterations, threshold),
+          MyRelaxationMethod::applySOR(sparse, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applyConjugateGradient(dense, b, max_iterations, threshold),
+          MyRelaxationMethod::applyConjugateGradient(sparse, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applyConjugateGradient(dense, b, max_iterations, threshold),
+          MyRelaxationMethod::applyPipelinedConjugateGradient(sparse, b, max_iterations, threshold));
+}
+
+// Test that pipelined CG follows the same Krylov iterates as standard CG, up to rounding
+TYPED_TEST(SparseMatrixTests, PipelinedConjugateGradientTest) {
+    const size_t n = 40;
+    const auto dense = TestFixture::tridiagonal(n);
+    const SparseMatrix<TypeParam> sparse(dense);
+    const Vector<TypeParam> b(n, [](size_t i) { return static_cast<TypeParam>(i % 7) - 3; });
+    const TypeParam threshold = std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+
+    const auto reference = MyRelaxationMethod::applyConjugateGradient(sparse, b, 1000, threshold);
+    for (const auto &solution : {MyRelaxationMethod::applyPipelinedConjugateGradient(sparse, b, 1000, threshold),
+                                 MyRelaxationMethod::applyPipelinedConjugateGradient(dense, b, 1000, threshold)}) {
+        EXPECT_TRUE(solution.converged);
+        EXPECT_EQ(solution.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_PIPELINED_CONJUGATE_GRADIENT));
+        EXPECT_LE(solution.iterations, reference.iterations + 2);
+        EXPECT_LE(solution.iterative_error, threshold);
+
+        // the true residual, not just the recurred one, meets the threshold
+        const Vector<TypeParam> residual = b - dense * solution.x;
+        EXPECT_LE(std::sqrt(residual * residual), 10 * threshold);
+    }
+}
+
+// Test that the direct power iteration gives the same dominant eigenvalue on the sparse matrix as on the dense matrix
+TYPED_TEST(SparseMatrixTests, PowerIterationTest) {
+    const size_t n = 8;
+    const auto dense = TestFixture::tridiagonal(n);
+    Vector<TypeParam> guess(n, [](size_t i) { return static_cast<TypeParam>(i + 1); });
+
+    Solver::Parameters<TypeParam> denseParams;
+    denseParams.setSize(n).setMaxIterations(2000).setConvergenceThreshold(std::sqrt(std::numeric_limits<TypeParam>::epsilon()));
+    denseParams.setCoefficients(dense).setInitialGuess(guess);
+
+    Solver::SparseParameters<TypeParam> sparseParams;
+    sparseParams.setSize(n).setMaxIterations(2000).setConvergenceThreshold(std::sqrt(std::numeric_limits<TypeParam>::epsilon()));
+    sparseParams.setCoefficients(SparseMatrix<TypeParam>(dense)).setInitialGuess(guess);
+
+    const auto reference = MyRelaxationMethod::applyDirectPowerIteration<Matrix, Vector, TypeParam>(denseParams);
+    const auto solution = MyRelaxationMethod::applyDirectPowerIteration<SparseMatrix, Vector, TypeParam>(sparseParams);
+    EXPECT_EQ(solution.iterations, reference.iterations);
+    EXPECT_LE(std::abs(solution.eigenvalue - reference.eigenvalue), 100 * std::numeric_limits<TypeParam>::epsilon() * reference.eigenvalue);
+}
+
+} // namespace MyBLAS
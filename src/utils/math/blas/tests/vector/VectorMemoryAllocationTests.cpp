@@ -72,4 +72,22 @@ TYPED_TEST(VectorMemoryAllocationTests, ConstructorTest) {
 
 }
 
+// Temporaries constructed inside a parallel region are all counted, and all released
+TYPED_TEST(VectorMemoryAllocationTests, ParallelInstanceCountTest) {
+    using Monitor = ResourceMonitor<Vector<TypeParam>>;
+    const size_t size = 64;
+    const size_t instancesBefore = Monitor::getCurrentInstanceCount();
+    const size_t heldBefore = Monitor::getCurrentBytes();
+    Monitor::clear();
+    #pragma omp parallel for default(none) shared(size)
+    for (size_t i = 0; i < 1000; i++) {
+        Vector<TypeParam> vector(size, static_cast<TypeParam>(i));
+        Vector<TypeParam> copy = vector;
+    }
+    EXPECT_EQ(Monitor::getCurrentInstanceCount(), instancesBefore);
+    EXPECT_EQ(Monitor::getCurrentBytes(), heldBefore);
+    EXPECT_EQ(Monitor::getAllocationCount(), 2000u);
+    EXPECT_GE(Monitor::getMaxBytesEver() - heldBefore, 2 * size * sizeof(TypeParam));
+}
+
 } // namespace MyBLAS
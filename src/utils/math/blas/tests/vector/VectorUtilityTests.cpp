@@ -52,4 +52,41 @@ TYPED_TEST(VectorUtilityTests, DotProductTest) {
     EXPECT_EQ(vectorA * vectorB, expectedDotProduct);
 }
 
+// Test the in-place AXPY and XPAY kernels against the vector expressions
+TYPED_TEST(VectorUtilityTests, AxpyXpayTest) {
+    const Vector<TypeParam> x({1, 2, 3, 4});
+    Vector<TypeParam> y({4, 3, 2, 1});
+    axpy(static_cast<TypeParam>(2), x, y);
+    EXPECT_EQ(y, Vector<TypeParam>({6, 7, 8, 9}));
+    xpay(x, static_cast<TypeParam>(0.5), y);
+    EXPECT_EQ(y, Vector<TypeParam>({4, 5.5, 7, 8.5}));
+}
+
+// Test that the fused CG updates match the unfused expressions, and return the new residual products
+TYPED_TEST(VectorUtilityTests, FusedConjugateGradientUpdateTest) {
+    const TypeParam alpha = 0.25;
+    const Vector<TypeParam> p({1, -2, 3, -4, 5});
+    const Vector<TypeParam> Ap({2, 1, -1, 0, 4});
+    const Vector<TypeParam> M_inv({0.5, 0.25, 1, 2, 0.125});
+    const Vector<TypeParam> x0({1, 1, 1, 1, 1});
+    const Vector<TypeParam> r0({3, -1, 2, 0, 8});
+
+    const Vector<TypeParam> expectedX = x0 + alpha * p;
+    const Vector<TypeParam> expectedR = r0 - alpha * Ap;
+    const Vector<TypeParam> expectedZ = Vector<TypeParam>::elementwiseProduct(expectedR, M_inv);
+
+    Vector<TypeParam> x = x0, r = r0;
+    EXPECT_EQ(updateSolutionAndResidual(alpha, p, Ap, x, r), expectedR * expectedR);
+    EXPECT_EQ(x, expectedX);
+    EXPECT_EQ(r, expectedR);
+
+    Vector<TypeParam> z(5, 0);
+    x = x0;
+    r = r0;
+    EXPECT_EQ(updateSolutionAndPreconditionedResidual(alpha, p, Ap, M_inv, x, r, z), expectedZ * expectedR);
+    EXPECT_EQ(x, expectedX);
+    EXPECT_EQ(r, expectedR);
+    EXPECT_EQ(z, expectedZ);
+}
+
 }
@@ -33,6 +33,12 @@ template <typename T> class Vector {
   protected:
     std::vector<T> data; ///< Vector representing the vector data.
     bool isRow;          ///< Boolean indicating whether the vector is a row vector.
+    typename ResourceMonitor<Vector<T>>::Allocation allocation; ///< The heap bytes of data, as last recorded.
+
+    /**
+     * @brief Records the capacity of the data with the resource monitor.
+     */
+    void monitorAllocation() { allocation.update(data.capacity() * sizeof(T)); }
 
   public:
 
@@ -57,7 +63,7 @@ template <typename T> class Vector {
      * @brief Default constructor. Initializes an empty column vector.
      */
     Vector() : isRow(false) {
-        // ResourceMonitor<Vector<T>>::registerInstance(this);
+        ResourceMonitor<Vector<T>>::registerInstance(this);
     }
 
     // TODO:: DOCUMENT
@@ -68,6 +74,7 @@ template <typename T> class Vector {
     // TODO:: DOCUMENT
     Vector(const Vector& other) : data(other.data), isRow(other.isRow) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -77,6 +84,7 @@ template <typename T> class Vector {
      */
     explicit Vector(std::vector<T> &_data, bool _isRow) : data(_data), isRow(_isRow) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -86,6 +94,7 @@ template <typename T> class Vector {
      */
     explicit Vector(std::vector<T> _data, bool _isRow) : data(std::move(_data)), isRow(_isRow) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -94,6 +103,7 @@ template <typename T> class Vector {
      */
     explicit Vector(std::vector<T> &_data) : data(_data), isRow(false) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -102,6 +112,7 @@ template <typename T> class Vector {
      */
     explicit Vector(std::vector<T> _data) : data(_data), isRow(false) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -113,6 +124,7 @@ template <typename T> class Vector {
      */
     explicit Vector(size_t size, const T initial = 0, bool _isRow = false) : data(size, initial), isRow(_isRow) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -121,11 +133,12 @@ template <typename T> class Vector {
      * @param func Lambda function to generate the elements of the vector.
      */
     explicit Vector(const size_t size, std::function<T(size_t)> func) : data(size), isRow(false) {
-        #pragma omp parallel for simd default(none) shared(func)
+        #pragma omp parallel for simd default(none) shared(func, size)
         for (size_t i = 0; i < size; i++) {
             data[i] = func(i);
         }
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -135,6 +148,7 @@ template <typename T> class Vector {
      */
     Vector(std::initializer_list<T> initList, bool _isRow = false) : data(initList), isRow(_isRow) {
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -148,6 +162,7 @@ template <typename T> class Vector {
             data[i] = vector[i];
         }
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     /**
@@ -161,6 +176,7 @@ template <typename T> class Vector {
             data[i] = vector[i];
         }
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     // Constructor that initializes the vector with another vector of a different type.
@@ -173,6 +189,7 @@ template <typename T> class Vector {
         }
         isRow = other.isRowVector(); // Assuming Vector<U> has a method isRowVector()
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     // Constructor that initializes the vector with another vector or a compatible type.
@@ -185,6 +202,7 @@ template <typename T> class Vector {
         }
         isRow = vector.isRowVector(); // Assuming VectorType has a method isRowVector()
         ResourceMonitor<Vector<T>>::registerInstance(this);
+        monitorAllocation();
     }
 
     // Copy assignment operator
@@ -192,6 +210,7 @@ template <typename T> class Vector {
         if (this != &other) {
             data = other.data;
             isRow = other.isRow;
+            monitorAllocation();
         }
         return *this;
     }
@@ -201,6 +220,7 @@ template <typename T> class Vector {
         if (this != &other) {
             data = std::move(other.data);
             isRow = other.isRow;
+            allocation = std::move(other.allocation);
             // Since we've moved from 'other', we may want to reset its state as appropriate
             other.isRow = false; // or true, depending on what you consider a default state
         }
@@ -437,7 +457,7 @@ template <typename T> class Vector {
         assert(A.size() == B.size());
         const auto size = A.size();
         MyBLAS::Vector<T> result(size);
-        #pragma omp parallel for simd default(none) shared(result, A, B)
+        #pragma omp parallel for simd default(none) shared(result, A, B, size)
         for (size_t i = 0; i < size; i++) {
             result[i] = A[i] * B[i];
         }
@@ -0,0 +1,393 @@
+/**
+ * @file BandedFactorization.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief LU factorization with partial pivoting, and Cholesky factorization, of a band matrix.
+ *
+ * Gaussian elimination never creates fill-in outside the band of a matrix. Without pivoting, L keeps the lower
+ * bandwidth p of A, and U keeps its upper bandwidth q. Partial pivoting only draws rows from the p rows below the
+ * pivot, which widens U to p + q diagonals but leaves L alone. Each elimination step updates a p x (p + q) block of
+ * the trailing matrix, so the factorization costs O(N * p * (p + q)) time and O(N * (2p + q)) memory, instead of the
+ * O(N^3) and O(N^2) of a dense factorization. For the diffusion matrix of an m x n mesh, N = m * n and p = q = n, so a
+ * 256 x 256 mesh needs about 0.8 GB of long doubles for its LU factors, instead of the 34 GB of the dense matrix.
+ *
+ * Symmetric positive definite matrices need no pivoting, and their Cholesky factor keeps the bandwidth of A, which
+ * halves the memory and the work again.
+ *
+ * Each elimination step updates the rows of its trailing block in parallel.
+ */
+
+#ifndef NE591_008_BANDEDFACTORIZATION_H
+#define NE591_008_BANDEDFACTORIZATION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "Factorize.h"
+#include "math/blas/matrix/BandMatrix.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "utils/profiler/Zones.h"
+
+namespace MyFactorizationMethod {
+
+/**
+ * @brief The smallest trailing block, in entries, whose update is spread over the OpenMP threads. Smaller blocks do
+ * not pay for the barriers of a parallel elimination step.
+ */
+constexpr size_t MinParallelBandBlock = 4096;
+
+/**
+ * @class BandedLU
+ * @brief The factorization P * A = L * U of a band matrix, with partial pivoting.
+ *
+ * The factors are packed into one MyBLAS::BandMatrix, with the multipliers of L below the diagonal and U on and above
+ * it. Following the LAPACK gbtrf convention, row k was interchanged with row pivots[k] at step k, and the interchanges
+ * are not applied to the columns of L that were already eliminated. A solve therefore applies each interchange just
+ * before the elimination step that used it.
+ *
+ * Once factorized, solveInPlace() may be called any number of times, from several threads at once.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class BandedLU {
+  public:
+    BandedLU() = default;
+
+    /**
+     * @brief Factorizes a band, dense or stencil matrix.
+     * @param A The square matrix.
+     */
+    template <class MatrixType>
+    explicit BandedLU(const MatrixType &A) { factorize(A); }
+
+    /**
+     * @brief Computes the factors of A, replacing any held ones.
+     * @details A is copied into a band with room for the fill-in of pivoting, and eliminated in place.
+     * @param A The square matrix.
+     * @return false if an exactly zero pivot was met. The factorization still runs to completion in that case.
+     */
+    template <class MatrixType>
+    bool factorize(const MatrixType &A) {
+        const auto [lower, upper] = MyBLAS::bandwidths(A);
+        LU = MyBLAS::BandMatrix<T>(A, lower, lower + upper);
+        factorized = true;
+        nonsingular = eliminate(upper);
+        if (!nonsingular) {
+            std::cerr << "Warning: banded LU factorization met a zero pivot, the matrix is singular.\n";
+        }
+        return nonsingular;
+    }
+
+    /**
+     * @brief Solves A * x = b in place, overwriting the right hand side x with the solution.
+     */
+    template <template<typename> class VectorType>
+    void solveInPlace(VectorType<T> &x) const {
+        assert(factorized);
+        const size_t n = LU.getRows();
+        const size_t lower = LU.getLowerBandwidth();
+        const size_t width = LU.getWidth();
+        const T *a = LU.getValues().data();
+        assert(x.size() == n);
+
+        // forward substitution with the unit lower triangular L, interleaved with the row interchanges
+        for (size_t k = 0; k < n; k++) {
+            if (pivots[k] != k) {
+                std::swap(x[k], x[pivots[k]]);
+            }
+            const T xk = x[k];
+            const size_t last = std::min(n - 1, k + lower);
+            for (size_t i = k + 1; i <= last; i++) {
+                x[i] -= a[LU.index(i, k)] * xk;
+            }
+        }
+
+        // backward substitution with U, whose row i is contiguous from the diagonal
+        for (size_t i = n; i-- > 0;) {
+            const T *row = a + i * width + lower;
+            const size_t count = LU.columnRange(i).second - i;
+            T sum = 0;
+            for (size_t c = 1; c < count; c++) {
+                sum += row[c] * x[i + c];
+            }
+            x[i] = (x[i] - sum) / row[0];
+        }
+    }
+
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+    [[nodiscard]] bool isNonsingular() const { return nonsingular; }
+    [[nodiscard]] const MyBLAS::BandMatrix<T> &getFactors() const { return LU; }
+    [[nodiscard]] const std::vector<size_t> &getPivots() const { return pivots; }
+
+  private:
+    MyBLAS::BandMatrix<T> LU;
+    std::vector<size_t> pivots;
+    bool factorized = false;
+    bool nonsingular = true;
+
+    /**
+     * @brief Right-looking elimination of the band in place.
+     * @details Step k picks the pivot among the rows k ... k + lower, swaps it into row k, and subtracts multiples of
+     * row k from the rows below it. Row k + lower is the last row with an entry in column k. Like LAPACK gbtf2, the
+     * last column that any pivot row has reached so far is tracked, so that the update stops there rather than at the
+     * edge of the band. Without interchanges, which is the case for the diagonally dominant diffusion matrix, that
+     * skips the lower diagonals of fill-in room, a third of the band.
+     * @param bandwidth The upper bandwidth of A, before any fill-in.
+     */
+    bool eliminate(const size_t bandwidth) {
+        const size_t n = LU.getRows();
+        const size_t lower = LU.getLowerBandwidth();
+        const size_t upper = LU.getUpperBandwidth();
+        const size_t width = LU.getWidth();
+        T *a = LU.getValues().data();
+        pivots.assign(n, 0);
+        auto &rowPivots = pivots;
+        bool regular = true;
+        bool skip = false;
+        size_t reach = 0;
+
+        #pragma omp parallel default(none) shared(a, n, lower, upper, width, bandwidth, rowPivots, regular, skip, reach) if(lower * upper >= MinParallelBandBlock)
+        for (size_t k = 0; k < n; k++) {
+            const size_t last = std::min(n - 1, k + lower);
+
+            #pragma omp single
+            {
+                size_t pivotRow = k;
+                T maxVal = std::abs(a[k * width + lower]);
+                for (size_t i = k + 1; i <= last; i++) {
+                    const T absoluteVal = std::abs(a[i * width + k + lower - i]);
+                    if (absoluteVal > maxVal) {
+                        maxVal = absoluteVal;
+                        pivotRow = i;
+                    }
+                }
+                rowPivots[k] = pivotRow;
+                reach = std::max(reach, std::min(n - 1, pivotRow + bandwidth));
+                const size_t right = std::min(reach, k + upper);
+                if (pivotRow != k) {
+                    T *pivotEntries = a + k * width + lower;
+                    T *otherEntries = a + pivotRow * width + k + lower - pivotRow;
+                    for (size_t c = 0; c <= right - k; c++) {
+                        std::swap(pivotEntries[c], otherEntries[c]);
+                    }
+                }
+                skip = (maxVal == static_cast<T>(0));
+                if (skip) {
+                    regular = false;
+                }
+            }
+
+            // every thread takes part in the loop, even when it is empty, so that its barrier keeps the next step's
+            // pivot search from overwriting skip and reach before the others have read it
+            const size_t end = skip ? k : last;
+            const T *pivotEntries = a + k * width + lower;
+            const size_t count = std::min(reach, k + upper) - k;
+            #pragma omp for schedule(static)
+            for (size_t i = k + 1; i <= end; i++) {
+                // row i starts at column k, lower - (i - k) slots into its storage
+                T *entries = a + i * width + k + lower - i;
+                entries[0] /= pivotEntries[0];
+                const T multiplier = entries[0];
+                if (multiplier != static_cast<T>(0)) {
+                    for (size_t c = 1; c <= count; c++) {
+                        entries[c] -= multiplier * pivotEntries[c];
+                    }
+                }
+            }
+        }
+        return regular;
+    }
+};
+
+/**
+ * @class BandedCholesky
+ * @brief The factorization A = R^T * R of a symmetric positive definite band matrix, with R = L^T upper triangular.
+ *
+ * Only the upper triangle of A is read. R keeps the bandwidth q of A, and is stored as a MyBLAS::BandMatrix with no
+ * diagonals below the main one, so row k of R is contiguous from its diagonal. That makes both the trailing updates and
+ * the backward substitution unit-stride.
+ *
+ * Once factorized, solveInPlace() may be called any number of times, from several threads at once.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class BandedCholesky {
+  public:
+    BandedCholesky() = default;
+
+    /**
+     * @brief Factorizes a symmetric positive definite band, dense or stencil matrix.
+     * @param A The square, symmetric matrix.
+     */
+    template <class MatrixType>
+    explicit BandedCholesky(const MatrixType &A) { factorize(A); }
+
+    /**
+     * @brief Computes the factor of A, replacing any held one.
+     * @param A The square, symmetric matrix.
+     * @return false if a pivot was not positive, i.e. A is not positive definite. The factor is unusable in that case.
+     */
+    template <class MatrixType>
+    bool factorize(const MatrixType &A) {
+        const size_t upper = MyBLAS::bandwidths(A).second;
+        R = MyBLAS::BandMatrix<T>(A.getRows(), 0, upper);
+        const size_t n = A.getRows();
+        auto &factor = R;
+        #pragma omp parallel for schedule(static) default(none) shared(A, factor, n)
+        for (size_t row = 0; row < n; row++) {
+            MyBLAS::forEachRowEntry<T>(A, row, [&factor, row](const size_t col, const T value) {
+                if (col >= row && value != static_cast<T>(0)) {
+                    factor.at(row, col) = value;
+                }
+            });
+        }
+        factorized = eliminate();
+        if (!factorized) {
+            std::cerr << "Error: banded Cholesky factorization met a non-positive pivot, the matrix is not positive "
+                         "definite.\n";
+        }
+        return factorized;
+    }
+
+    /**
+     * @brief Solves A * x = b in place, overwriting the right hand side x with the solution.
+     */
+    template <template<typename> class VectorType>
+    void solveInPlace(VectorType<T> &x) const {
+        assert(factorized);
+        const size_t n = R.getRows();
+        const size_t width = R.getWidth();
+        const T *r = R.getValues().data();
+        assert(x.size() == n);
+
+        // R^T * y = b, column k of R^T being the contiguous row k of R
+        for (size_t k = 0; k < n; k++) {
+            const T *row = r + k * width;
+            const size_t count = R.columnRange(k).second - k;
+            x[k] /= row[0];
+            const T yk = x[k];
+            for (size_t c = 1; c < count; c++) {
+                x[k + c] -= row[c] * yk;
+            }
+        }
+
+        // R * x = y
+        for (size_t k = n; k-- > 0;) {
+            const T *row = r + k * width;
+            const size_t count = R.columnRange(k).second - k;
+            T sum = 0;
+            for (size_t c = 1; c < count; c++) {
+                sum += row[c] * x[k + c];
+            }
+            x[k] = (x[k] - sum) / row[0];
+        }
+    }
+
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+    [[nodiscard]] const MyBLAS::BandMatrix<T> &getFactor() const { return R; }
+
+  private:
+    MyBLAS::BandMatrix<T> R;
+    bool factorized = false;
+
+    /**
+     * @brief Right-looking elimination of the upper band in place.
+     * @details Step k scales row k by the square root of its pivot, then subtracts r(k, i) * r(k, j) from every
+     * r(i, j) with k < i <= j <= k + upper, one row i per thread.
+     */
+    bool eliminate() {
+        const size_t n = R.getRows();
+        const size_t upper = R.getUpperBandwidth();
+        const size_t width = R.getWidth();
+        T *r = R.getValues().data();
+        bool positive = true;
+
+        #pragma omp parallel default(none) shared(r, n, upper, width, positive) if(upper * upper >= 2 * MinParallelBandBlock)
+        for (size_t k = 0; k < n && positive; k++) {
+            T *pivotEntries = r + k * width;
+            const size_t count = std::min(n - 1, k + upper) - k;
+
+            #pragma omp single
+            {
+                if (pivotEntries[0] > static_cast<T>(0)) {
+                    const T pivot = std::sqrt(pivotEntries[0]);
+                    pivotEntries[0] = pivot;
+                    for (size_t c = 1; c <= count; c++) {
+                        pivotEntries[c] /= pivot;
+                    }
+                } else {
+                    positive = false;
+                }
+            }
+
+            if (positive) {
+                #pragma omp for schedule(static)
+                for (size_t i = 1; i <= count; i++) {
+                    const T factor = pivotEntries[i];
+                    if (factor != static_cast<T>(0)) {
+                        T *entries = r + (k + i) * width;
+                        for (size_t c = i; c <= count; c++) {
+                            entries[c - i] -= factor * pivotEntries[c];
+                        }
+                    }
+                }
+            }
+        }
+        return positive;
+    }
+};
+
+/**
+ * @brief Solves A * x = b with the banded LU factorization with partial pivoting.
+ * @param A The square band, dense or stencil matrix.
+ * @param b The right hand side.
+ * @return A Solution object containing the solution vector.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applyBandedLUP(const MatrixType<T> &A, const VectorType<T> &b) {
+    PROFILE_ZONE_NAMED(factorizeZone, "Banded LUP factorize");
+    const BandedLU<T> factors(A);
+    PROFILE_ZONE_STOP(factorizeZone);
+    MyBLAS::Solver::Solution<T> results;
+    results.x = b;
+    PROFILE_ZONE_NAMED(solveZone, "Banded LUP solve");
+    factors.solveInPlace(results.x);
+    PROFILE_ZONE_STOP(solveZone);
+    results.method = METHOD_LUP;
+    results.converged = factors.isNonsingular();
+    return results;
+}
+
+/**
+ * @brief Solves A * x = b with the banded Cholesky factorization.
+ * @param A The symmetric positive definite band, dense or stencil matrix.
+ * @param b The right hand side.
+ * @return A Solution object containing the solution vector, unconverged if A is not positive definite.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applyBandedCholesky(const MatrixType<T> &A, const VectorType<T> &b) {
+    PROFILE_ZONE_NAMED(factorizeZone, "Banded Cholesky factorize");
+    const BandedCholesky<T> factor(A);
+    PROFILE_ZONE_STOP(factorizeZone);
+    MyBLAS::Solver::Solution<T> results(b.size());
+    results.method = METHOD_CHOLESKY;
+    if (factor.isFactorized()) {
+        PROFILE_ZONE("Banded Cholesky solve");
+        results.x = b;
+        factor.solveInPlace(results.x);
+        results.converged = true;
+    }
+    return results;
+}
+
+} // namespace MyFactorizationMethod
+
+#endif // NE591_008_BANDEDFACTORIZATION_H
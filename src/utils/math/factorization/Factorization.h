@@ -0,0 +1,123 @@
+/**
+ * @file Factorization.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief A reusable factorization handle: factor a matrix once, then solve against any number of right hand sides.
+ *
+ * Solving A * x = b with a direct method costs O(n^3) for the factorization and only O(n^2) for the triangular
+ * solves. Callers that solve repeatedly against the same matrix, such as inverse power iteration, keep a
+ * Factorization around and only pay the cubic cost when the matrix actually changes.
+ */
+
+#ifndef NE591_008_FACTORIZATION_H
+#define NE591_008_FACTORIZATION_H
+
+#include <cassert>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "Factorize.h"
+#include "LUP.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+
+namespace MyFactorizationMethod {
+
+/**
+ * @class Factorization
+ * @brief Holds the packed triangular factors of a square matrix, along with any row interchanges.
+ *
+ * The factors are stored in a single n x n matrix in the LAPACK layout, with the unit diagonal of L implied, so that
+ * the handle costs the same memory as the matrix it factors.
+ *
+ * @tparam T The data type of the matrix elements.
+ */
+template <typename T>
+class Factorization {
+  public:
+    Factorization() = default;
+
+    /**
+     * @brief Factorizes A with the given method.
+     */
+    template <template<typename> class MatrixType>
+    explicit Factorization(const MatrixType<T> &A, const Type _method = METHOD_LUP) {
+        factorize(A, _method);
+    }
+
+    /**
+     * @brief Replaces the held factors with those of A.
+     *
+     * @param A The square matrix to factorize. It is copied, and left untouched.
+     * @param _method METHOD_LUP for partial pivoting, or METHOD_LU to factorize without row interchanges.
+     * @return false if the matrix is singular, in which case solve() will divide by a zero pivot.
+     */
+    template <template<typename> class MatrixType>
+    bool factorize(const MatrixType<T> &A, const Type _method = METHOD_LUP) {
+        factors = MyBLAS::Matrix<T>(A);
+        return factorizeInPlace(_method);
+    }
+
+    /**
+     * @brief Takes ownership of A and factorizes it without copying it.
+     *
+     * @param A The square matrix to factorize, moved into the handle.
+     * @param _method METHOD_LUP for partial pivoting, or METHOD_LU to factorize without row interchanges.
+     * @return false if the matrix is singular.
+     */
+    bool factorize(MyBLAS::Matrix<T> &&A, const Type _method = METHOD_LUP) {
+        factors = std::move(A);
+        return factorizeInPlace(_method);
+    }
+
+    /**
+     * @brief Solves A * x = b in O(n^2) using the held factors.
+     */
+    [[nodiscard]] MyBLAS::Vector<T> solve(const MyBLAS::Vector<T> &b) const {
+        MyBLAS::Vector<T> x = b;
+        solveInPlace(x);
+        return x;
+    }
+
+    /**
+     * @brief Solves A * x = b in O(n^2) using the held factors, overwriting b with x.
+     */
+    void solveInPlace(MyBLAS::Vector<T> &b) const {
+        assert(factorized);
+        MyBLAS::LUP::solveInPlace(factors, pivots, b);
+    }
+
+    [[nodiscard]] size_t size() const { return factors.getRows(); }
+    [[nodiscard]] Type getMethod() const { return method; }
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+    [[nodiscard]] bool isNonsingular() const { return nonsingular; }
+
+    /**
+     * @brief The packed factors, with L strictly below the diagonal and U on and above it.
+     */
+    [[nodiscard]] const MyBLAS::Matrix<T> &getFactors() const { return factors; }
+
+    /**
+     * @brief The row interchanges, where row k was swapped with row pivots[k] at step k.
+     */
+    [[nodiscard]] const std::vector<size_t> &getPivots() const { return pivots; }
+
+  private:
+    MyBLAS::Matrix<T> factors;
+    std::vector<size_t> pivots;
+    Type method = METHOD_LUP;
+    bool factorized = false;
+    bool nonsingular = false;
+
+    bool factorizeInPlace(const Type _method) {
+        method = _method;
+        const bool pivoting = (method == METHOD_LUP);
+        nonsingular = MyBLAS::LUP::factorizeInPlace(factors, pivots, MyBLAS::LUP::DefaultBlockSize, pivoting);
+        factorized = true;
+        return nonsingular;
+    }
+};
+
+} // namespace MyFactorizationMethod
+#endif // NE591_008_FACTORIZATION_H
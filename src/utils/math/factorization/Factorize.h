@@ -58,6 +58,9 @@ namespace MyFactorizationMethod {
 enum Type {
     METHOD_LU,  ////< LU factorization
     METHOD_LUP, ////< LU factorization with pivoting
+    METHOD_DST, ////< Diagonalization by the discrete sine transform, for the uniform diffusion stencil
+    METHOD_CHOLESKY, ////< Cholesky factorization, for symmetric positive definite matrices
+    METHOD_SPARSE_CHOLESKY, ////< Supernodal sparse Cholesky factorization, in nested dissection order
 };
 
 /**
@@ -65,10 +68,13 @@ enum Type {
  * @param value The factorization method type.
  * @return The string representation of the factorization method type.
  */
-const char *TypeKey(MyFactorizationMethod::Type value) {
+inline const char *TypeKey(MyFactorizationMethod::Type value) {
     static const char *methodTypeKeys[] = {
         "LU",
         "LUP",
+        "DST",
+        "Cholesky",
+        "SparseCholesky",
     };
     return methodTypeKeys[static_cast<int>(value)];
 }
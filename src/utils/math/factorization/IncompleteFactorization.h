@@ -0,0 +1,473 @@
+/**
+ * @file IncompleteFactorization.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Zero fill-in incomplete LU and Cholesky factorizations of a sparse matrix, for use as preconditioners.
+ *
+ * ILU(0) and IC(0) compute triangular factors that keep the sparsity pattern of A, dropping every fill-in entry that a
+ * complete factorization would create. The factors cost the same memory as A, and applying them costs about as much as
+ * a matrix-vector product. Since L * U only approximates A, they are used to precondition an iterative method, rather
+ * than to solve the system directly.
+ *
+ * The triangular solves are level scheduled. Row i of a lower triangular factor can be solved as soon as every row it
+ * reads from has been, so the rows are grouped into levels, where level(i) = 1 + max level(j) over the nonzeros L(i, j).
+ * The rows of a level are independent, and are solved in parallel, with one barrier per level. On the m x n diffusion
+ * mesh the levels are the anti-diagonals i + j of the mesh, so there are m + n - 1 of them.
+ */
+
+#ifndef NE591_008_INCOMPLETEFACTORIZATION_H
+#define NE591_008_INCOMPLETEFACTORIZATION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <omp.h>
+
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/vector/Vector.h"
+
+namespace MyFactorizationMethod {
+
+/**
+ * @class TriangularFactor
+ * @brief A sparse triangular matrix in CSR format, with its rows grouped into levels for a parallel solve.
+ *
+ * The strictly triangular entries are stored per row, and the diagonal is stored inverted, with ones for a unit
+ * diagonal.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class TriangularFactor {
+  public:
+    TriangularFactor() = default;
+
+    /**
+     * @brief Builds the factor and its level schedule.
+     * @param rowPointers Offsets of each row into columnIndices and values, of size rows + 1.
+     * @param columnIndices The column of each strictly triangular entry.
+     * @param values The value of each strictly triangular entry.
+     * @param diagonal The diagonal of the factor.
+     * @param _lower True if the entries are below the diagonal, false if they are above it.
+     */
+    TriangularFactor(std::vector<size_t> rowPointers, std::vector<size_t> columnIndices, std::vector<T> values,
+                     const std::vector<T> &diagonal, const bool _lower)
+        : _rowPointers(std::move(rowPointers)), _columnIndices(std::move(columnIndices)), _values(std::move(values)),
+          _inverseDiagonal(diagonal.size()), lower(_lower) {
+        const size_t rows = diagonal.size();
+        for (size_t i = 0; i < rows; i++) {
+            _inverseDiagonal[i] = static_cast<T>(1) / diagonal[i];
+        }
+        schedule();
+    }
+
+    /**
+     * @brief Solves the triangular system in place, overwriting the right hand side x with the solution.
+     */
+    template <template<typename> class VectorType>
+    void solveInPlace(VectorType<T> &x) const {
+        const size_t rows = _inverseDiagonal.size();
+        const auto &rowPointers = _rowPointers;
+        const auto &columnIndices = _columnIndices;
+        const auto &values = _values;
+        const auto &inverseDiagonal = _inverseDiagonal;
+        const auto &levelPointers = _levelPointers;
+        const auto &levelRows = _levelRows;
+
+        // on one thread, the natural order streams through the rows and x, which the level order does not
+        if (omp_get_max_threads() == 1) {
+            for (size_t step = 0; step < rows; step++) {
+                const size_t row = lower ? step : rows - 1 - step;
+                T sum = x[row];
+                for (size_t entry = rowPointers[row]; entry < rowPointers[row + 1]; entry++) {
+                    sum -= values[entry] * x[columnIndices[entry]];
+                }
+                x[row] = sum * inverseDiagonal[row];
+            }
+            return;
+        }
+
+        const size_t levels = getLevels();
+        #pragma omp parallel default(none) shared(x, levels, rowPointers, columnIndices, values, inverseDiagonal, levelPointers, levelRows)
+        for (size_t level = 0; level < levels; level++) {
+            // the rows of a level only read from the rows of earlier levels, so they can overwrite x in place
+            #pragma omp for schedule(static)
+            for (size_t k = levelPointers[level]; k < levelPointers[level + 1]; k++) {
+                const size_t row = levelRows[k];
+                T sum = x[row];
+                for (size_t entry = rowPointers[row]; entry < rowPointers[row + 1]; entry++) {
+                    sum -= values[entry] * x[columnIndices[entry]];
+                }
+                x[row] = sum * inverseDiagonal[row];
+            }
+        }
+    }
+
+    /**
+     * @brief The number of levels, i.e. the number of sequential steps in a solve.
+     */
+    [[nodiscard]] size_t getLevels() const { return _levelPointers.empty() ? 0 : _levelPointers.size() - 1; }
+
+    /**
+     * @brief The number of stored off-diagonal entries.
+     */
+    [[nodiscard]] size_t getNonZeros() const { return _values.size(); }
+
+  private:
+    std::vector<size_t> _rowPointers{0};
+    std::vector<size_t> _columnIndices;
+    std::vector<T> _values;
+    std::vector<T> _inverseDiagonal;
+    std::vector<size_t> _levelPointers;  ///< Offsets of each level into _levelRows, one per level plus one.
+    std::vector<size_t> _levelRows;      ///< The rows, sorted by level.
+    bool lower = true;
+
+    /**
+     * @brief Groups the rows into levels, in the order in which a sequential substitution would visit them.
+     */
+    void schedule() {
+        const size_t rows = _inverseDiagonal.size();
+        std::vector<size_t> level(rows, 0);
+        size_t levels = 0;
+        for (size_t step = 0; step < rows; step++) {
+            const size_t row = lower ? step : rows - 1 - step;
+            size_t depth = 0;
+            for (size_t entry = _rowPointers[row]; entry < _rowPointers[row + 1]; entry++) {
+                depth = std::max(depth, level[_columnIndices[entry]] + 1);
+            }
+            level[row] = depth;
+            levels = std::max(levels, depth + 1);
+        }
+
+        // counting sort of the rows by level, keeping the rows of each level in increasing order
+        _levelPointers.assign(levels + 1, 0);
+        for (size_t row = 0; row < rows; row++) {
+            _levelPointers[level[row] + 1]++;
+        }
+        for (size_t l = 0; l < levels; l++) {
+            _levelPointers[l + 1] += _levelPointers[l];
+        }
+        std::vector<size_t> next(_levelPointers.begin(), _levelPointers.end() - 1);
+        _levelRows.resize(rows);
+        for (size_t row = 0; row < rows; row++) {
+            _levelRows[next[level[row]]++] = row;
+        }
+    }
+};
+
+/**
+ * @brief The packed ILU(0) factors of a sparse matrix, L strictly below the diagonal and U on and above it, stored in
+ * a copy of the values array of A.
+ */
+template <typename T>
+struct IncompleteFactors {
+    std::vector<T> values;              ///< The factors, in the CSR layout of A.
+    std::vector<size_t> diagonalPosition; ///< The position of the diagonal in each row.
+    size_t replacedPivots = 0;          ///< The number of pivots that were replaced.
+    bool nonsingular = true;            ///< False if a pivot was replaced.
+    bool complete = true;               ///< False if a row of A does not store its diagonal.
+};
+
+/**
+ * @brief Returns a nonzero magnitude to replace the pivot of a row with.
+ * @details This is |a(i,i)|, or when that is zero too, the absolute row sum of A, which bounds the eigenvalues of A
+ * like a diagonal shift would. A row of zeros gets 1.
+ * @param A The sparse matrix.
+ * @param row The row of the pivot.
+ * @return The replacement pivot, which is always positive.
+ */
+template <typename T>
+T replacementPivot(const MyBLAS::SparseMatrix<T> &A, const size_t row) {
+    const T diagonal = std::abs(A.getStencilDiagonal(row));
+    if (diagonal != static_cast<T>(0)) {
+        return diagonal;
+    }
+    const auto &rowPointers = A.getRowPointers();
+    const auto &values = A.getValues();
+    T rowSum = 0;
+    for (size_t entry = rowPointers[row]; entry < rowPointers[row + 1]; entry++) {
+        rowSum += std::abs(values[entry]);
+    }
+    return rowSum != static_cast<T>(0) ? rowSum : static_cast<T>(1);
+}
+
+/**
+ * @brief Gaussian elimination restricted to the sparsity pattern of A, in the IKJ order.
+ * @details Row i is eliminated with every earlier row k that it has an entry for. Updates that land on an entry of the
+ * pattern are applied, and the rest (the fill-in) are dropped, or with a relaxation factor omega > 0, a fraction omega
+ * of them is added to the diagonal of row i instead. With omega = 1 this is the modified factorization, MILU(0), whose
+ * factors have the same row sums as A. On the diffusion operator it reduces the condition number from O(h^-2) to
+ * O(h^-1).
+ *
+ * A pivot that cannot be used is replaced by replacementPivot() as soon as row i is eliminated, before any later row
+ * divides by it, so that the factors stay consistent with each other. The replacements are counted in the factors, and
+ * reported once on std::cerr.
+ * @param A The square sparse matrix, with sorted column indices.
+ * @param omega The fraction of the dropped fill-in that is moved onto the diagonal, in [0, 1].
+ * @param positive If true, non-positive pivots are replaced too, as the incomplete Cholesky factor needs.
+ * @return The packed factors.
+ */
+template <typename T>
+IncompleteFactors<T> eliminateInPattern(const MyBLAS::SparseMatrix<T> &A, const T omega, const bool positive = false) {
+    constexpr size_t NoEntry = static_cast<size_t>(-1);
+    const size_t n = A.getRows();
+    const auto &rowPointers = A.getRowPointers();
+    const auto &columnIndices = A.getColumnIndices();
+
+    IncompleteFactors<T> factors;
+    factors.values = A.getValues();
+    factors.diagonalPosition.assign(n, 0);
+    auto &values = factors.values;
+    auto &diagonalPosition = factors.diagonalPosition;
+
+    // maps each column to its position in the row being eliminated
+    std::vector<size_t> position(n, NoEntry);
+
+    for (size_t i = 0; i < n; i++) {
+        const size_t begin = rowPointers[i], end = rowPointers[i + 1];
+        for (size_t entry = begin; entry < end; entry++) {
+            position[columnIndices[entry]] = entry;
+        }
+        if (position[i] == NoEntry) {
+            std::cerr << "IncompleteFactorization: row " << i << " does not store its diagonal entry\n";
+            factors.complete = false;
+            return factors;
+        }
+        diagonalPosition[i] = position[i];
+
+        T dropped = 0;
+        for (size_t entry = begin; entry < end && columnIndices[entry] < i; entry++) {
+            const size_t k = columnIndices[entry];
+            values[entry] /= values[diagonalPosition[k]];
+            const T multiplier = values[entry];
+            for (size_t kj = diagonalPosition[k] + 1; kj < rowPointers[k + 1]; kj++) {
+                const size_t ij = position[columnIndices[kj]];
+                if (ij != NoEntry) {
+                    values[ij] -= multiplier * values[kj];
+                } else {
+                    dropped += multiplier * values[kj];
+                }
+            }
+        }
+        values[diagonalPosition[i]] -= omega * dropped;
+
+        const T pivot = values[diagonalPosition[i]];
+        if (pivot == static_cast<T>(0) || (positive && pivot < static_cast<T>(0))) {
+            values[diagonalPosition[i]] = replacementPivot(A, i);
+            factors.replacedPivots++;
+            factors.nonsingular = false;
+        }
+
+        for (size_t entry = begin; entry < end; entry++) {
+            position[columnIndices[entry]] = NoEntry;
+        }
+    }
+    if (factors.replacedPivots > 0) {
+        std::cerr << "IncompleteFactorization: replaced " << factors.replacedPivots << " "
+                  << (positive ? "non-positive" : "zero") << " pivot(s)\n";
+    }
+    return factors;
+}
+
+/**
+ * @class IncompleteLU
+ * @brief The ILU(0) factorization A ~ L * U, where L is unit lower triangular, and L + U has the sparsity pattern of A.
+ *
+ * Applying the factorization, z = U^-1 * L^-1 * r, is a preconditioner for any iterative method. Non-symmetric
+ * matrices are allowed. A zero pivot is replaced by a nonzero one, so that the preconditioner stays usable, and the
+ * number of replaced pivots is kept.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class IncompleteLU {
+  public:
+    IncompleteLU() = default;
+
+    /**
+     * @brief Factorizes a sparse matrix with sorted column indices.
+     * @param A The square sparse matrix. Every row should store its diagonal entry.
+     * @param omega The fraction of the dropped fill-in moved onto the diagonal. 0 for ILU(0), 1 for MILU(0).
+     */
+    explicit IncompleteLU(const MyBLAS::SparseMatrix<T> &A, const T omega = 0) { factorize(A, omega); }
+
+    /**
+     * @brief Factorizes a dense, lazy or stencil matrix, by first compressing it into a MyBLAS::SparseMatrix.
+     */
+    template <class MatrixType, std::enable_if_t<!std::is_same_v<MatrixType, MyBLAS::SparseMatrix<T>>, int> = 0>
+    explicit IncompleteLU(const MatrixType &A, const T omega = 0) : IncompleteLU(MyBLAS::SparseMatrix<T>(A), omega) {}
+
+    /**
+     * @brief Computes the factors of A, replacing any held ones.
+     * @param A The square sparse matrix. Every row should store its diagonal entry.
+     * @param omega The fraction of the dropped fill-in moved onto the diagonal.
+     * @return false if a row does not store its diagonal, or a zero pivot was encountered.
+     */
+    bool factorize(const MyBLAS::SparseMatrix<T> &A, const T omega = 0) {
+        const auto factors = eliminateInPattern(A, omega);
+        if (!factors.complete) {
+            return false;
+        }
+
+        // split the packed factors into the strictly lower part of L and the upper part of U
+        const size_t n = A.getRows();
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        std::vector<size_t> lowerPointers(n + 1, 0), upperPointers(n + 1, 0);
+        std::vector<size_t> lowerColumns, upperColumns;
+        std::vector<T> lowerValues, upperValues, upperDiagonal(n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t e = rowPointers[i]; e < rowPointers[i + 1]; e++) {
+                const size_t col = columnIndices[e];
+                if (col < i) {
+                    lowerColumns.push_back(col);
+                    lowerValues.push_back(factors.values[e]);
+                } else if (col > i) {
+                    upperColumns.push_back(col);
+                    upperValues.push_back(factors.values[e]);
+                }
+            }
+            upperDiagonal[i] = factors.values[factors.diagonalPosition[i]];
+            lowerPointers[i + 1] = lowerColumns.size();
+            upperPointers[i + 1] = upperColumns.size();
+        }
+
+        L = TriangularFactor<T>(std::move(lowerPointers), std::move(lowerColumns), std::move(lowerValues), std::vector<T>(n, 1), true);
+        U = TriangularFactor<T>(std::move(upperPointers), std::move(upperColumns), std::move(upperValues), upperDiagonal, false);
+        replacedPivots = factors.replacedPivots;
+        factorized = true;
+        return factors.nonsingular;
+    }
+
+    /**
+     * @brief Applies the preconditioner, z = U^-1 * L^-1 * r.
+     */
+    template <template<typename> class VectorType>
+    void apply(const VectorType<T> &r, VectorType<T> &z) const {
+        assert(factorized);
+        z = r;
+        L.solveInPlace(z);
+        U.solveInPlace(z);
+    }
+
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+    [[nodiscard]] size_t getReplacedPivots() const { return replacedPivots; }
+    [[nodiscard]] const TriangularFactor<T> &getL() const { return L; }
+    [[nodiscard]] const TriangularFactor<T> &getU() const { return U; }
+
+  private:
+    TriangularFactor<T> L;
+    TriangularFactor<T> U;
+    size_t replacedPivots = 0;
+    bool factorized = false;
+};
+
+/**
+ * @class IncompleteCholesky
+ * @brief The IC(0) factorization A ~ L * L^T of a symmetric positive definite matrix, where L has the sparsity pattern
+ * of the lower triangle of A.
+ *
+ * For a symmetric matrix the ILU(0) factors are U = D * L1^T, with L1 unit lower triangular and D = diag(U), so the
+ * incomplete Cholesky factor is L = L1 * D^1/2. It is computed that way, from the same elimination as IncompleteLU,
+ * which also gives the modified variant MIC(0) through omega. Applying the factorization, z = L^-T * L^-1 * r, is a
+ * symmetric positive definite preconditioner, as conjugate gradient needs. IC(0) can break down on SPD matrices that
+ * are not M-matrices, when a pivot is not positive. The pivot is then replaced by a positive one during the
+ * elimination, so the later rows are eliminated with the replaced pivot, the factor still gives a symmetric positive
+ * definite preconditioner, and the number of replaced pivots is kept.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class IncompleteCholesky {
+  public:
+    IncompleteCholesky() = default;
+
+    /**
+     * @brief Factorizes a symmetric sparse matrix with sorted column indices.
+     * @param A The square, symmetric sparse matrix.
+     * @param omega The fraction of the dropped fill-in moved onto the diagonal. 0 for IC(0), 1 for MIC(0).
+     */
+    explicit IncompleteCholesky(const MyBLAS::SparseMatrix<T> &A, const T omega = 0) { factorize(A, omega); }
+
+    /**
+     * @brief Factorizes a symmetric dense, lazy or stencil matrix, by first compressing it into a MyBLAS::SparseMatrix.
+     */
+    template <class MatrixType, std::enable_if_t<!std::is_same_v<MatrixType, MyBLAS::SparseMatrix<T>>, int> = 0>
+    explicit IncompleteCholesky(const MatrixType &A, const T omega = 0) : IncompleteCholesky(MyBLAS::SparseMatrix<T>(A), omega) {}
+
+    /**
+     * @brief Computes the factor of A, replacing any held one.
+     * @param A The square, symmetric sparse matrix.
+     * @param omega The fraction of the dropped fill-in moved onto the diagonal.
+     * @return false if a row does not store its diagonal, or the factorization broke down on a non-positive pivot.
+     */
+    bool factorize(const MyBLAS::SparseMatrix<T> &A, const T omega = 0) {
+        const auto factors = eliminateInPattern(A, omega, true);
+        if (!factors.complete) {
+            return false;
+        }
+
+        const size_t n = A.getRows();
+        std::vector<T> diagonal(n);
+        for (size_t i = 0; i < n; i++) {
+            diagonal[i] = std::sqrt(factors.values[factors.diagonalPosition[i]]);
+        }
+
+        // L(i, j) = L1(i, j) * d(j) for j < i, and L^T(i, j) = U(i, j) / d(i) for j > i
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        std::vector<size_t> lowerPointers(n + 1, 0), upperPointers(n + 1, 0);
+        std::vector<size_t> lowerColumns, upperColumns;
+        std::vector<T> lowerValues, upperValues;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t e = rowPointers[i]; e < rowPointers[i + 1]; e++) {
+                const size_t col = columnIndices[e];
+                if (col < i) {
+                    lowerColumns.push_back(col);
+                    lowerValues.push_back(factors.values[e] * diagonal[col]);
+                } else if (col > i) {
+                    upperColumns.push_back(col);
+                    upperValues.push_back(factors.values[e] / diagonal[i]);
+                }
+            }
+            lowerPointers[i + 1] = lowerColumns.size();
+            upperPointers[i + 1] = upperColumns.size();
+        }
+
+        L = TriangularFactor<T>(std::move(lowerPointers), std::move(lowerColumns), std::move(lowerValues), diagonal, true);
+        LT = TriangularFactor<T>(std::move(upperPointers), std::move(upperColumns), std::move(upperValues), diagonal, false);
+        replacedPivots = factors.replacedPivots;
+        factorized = true;
+        return factors.nonsingular;
+    }
+
+    /**
+     * @brief Applies the preconditioner, z = L^-T * L^-1 * r.
+     */
+    template <template<typename> class VectorType>
+    void apply(const VectorType<T> &r, VectorType<T> &z) const {
+        assert(factorized);
+        z = r;
+        L.solveInPlace(z);
+        LT.solveInPlace(z);
+    }
+
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+    [[nodiscard]] size_t getReplacedPivots() const { return replacedPivots; }
+    [[nodiscard]] const TriangularFactor<T> &getL() const { return L; }
+
+  private:
+    TriangularFactor<T> L;
+    TriangularFactor<T> LT;
+    size_t replacedPivots = 0;
+    bool factorized = false;
+};
+
+} // namespace MyFactorizationMethod
+
+#endif // NE591_008_INCOMPLETEFACTORIZATION_H
@@ -34,6 +34,7 @@
 
 #include "../../CommandLine.h"
 #include "utils/Stopwatch.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyBLAS
@@ -127,8 +128,8 @@ static void recursiveLUFactorize(MyBLAS::Matrix<T> &L, MyBLAS::Matrix<T> &U, con
     A12 = A12 / U[0][0];
     A21 = L[0][0] * A21;
 
-    // Update A22
-    A22 = A22 - A21 * A12;
+    // Update A22 in place with the Schur complement, A22 -= A21 * A12
+    MyBLAS::gemm(static_cast<T>(-1), A21, A12, static_cast<T>(1), A22);
 
     // Recursively apply the same procedure to the updated A22
     MyBLAS::Matrix<T> L22(n - 1, n - 1);
@@ -157,6 +158,7 @@ static void recursiveLUFactorize(MyBLAS::Matrix<T> &L, MyBLAS::Matrix<T> &U, con
  * @param[in] A The input matrix to be factorized.
  */
 template <typename T> static void factorize(MyBLAS::Matrix<T> &L, MyBLAS::Matrix<T> &U, Matrix<T> A) {
+    PROFILE_ZONE("LU factorize");
     doolittleFactorize<T>(L, U, A);
     // recursiveLUFactorize(L, U, A);
 }
@@ -26,8 +26,12 @@
 #ifndef NE591_008_LUP_H
 #define NE591_008_LUP_H
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include <omp.h>
 #include "LU.h"
@@ -38,6 +42,7 @@
 #include "Factorize.h"
 #include "utils/Stopwatch.h"
 #include "utils/math/blas/solver/LinearSolver.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyBLAS
@@ -45,12 +50,193 @@
  */
 namespace MyBLAS::LUP {
 
+/**
+ * @brief Default number of columns in each panel of the blocked in-place factorization.
+ */
+constexpr size_t DefaultBlockSize = 64;
+
+/**
+ * @brief Factorizes the kb columns of A starting at column k0, with partial pivoting over the full column height.
+ *
+ * Each pivot swaps whole rows, so the already factored columns of L to the left and the trailing columns to the right
+ * see the same permutation. The update is confined to the panel columns; the trailing matrix is brought up to date by
+ * the caller with one triangular solve and one GEMM per panel.
+ *
+ * @param pivoting If false, the diagonal entry is always taken as the pivot, giving the unpivoted Doolittle factors.
+ * @return false if an exactly zero pivot was met. The factorization still runs to completion in that case.
+ */
+template <typename T>
+bool factorizePanel(MyBLAS::Matrix<T> &A, std::vector<size_t> &pivots, const size_t k0, const size_t kb,
+                    const bool pivoting = true) {
+    const size_t n = A.getRows();
+    const size_t ld = A.getLeadingDimension();
+    T *a = A.getBuffer();
+    bool nonsingular = true;
+
+    for (size_t j = k0; j < k0 + kb; j++) {
+        // Find the pivot row
+        size_t pivotRow = j;
+        T maxVal = std::abs(a[j * ld + j]);
+        for (size_t i = j + 1; pivoting && i < n; i++) {
+            const T absoluteVal = std::abs(a[i * ld + j]);
+            if (absoluteVal > maxVal) {
+                maxVal = absoluteVal;
+                pivotRow = i;
+            }
+        }
+        pivots[j] = pivotRow;
+        if (pivotRow != j) {
+            A.swapRows(j, pivotRow);
+        }
+
+        const T pivot = a[j * ld + j];
+        if (pivot == static_cast<T>(0)) {
+            nonsingular = false;
+            continue;
+        }
+
+        // Store the multipliers in place of the eliminated column, then update the rest of the panel
+        const T *pivotRowData = a + j * ld;
+        for (size_t i = j + 1; i < n; i++) {
+            T *row = a + i * ld;
+            row[j] /= pivot;
+            const T multiplier = row[j];
+            for (size_t c = j + 1; c < k0 + kb; c++) {
+                row[c] -= multiplier * pivotRowData[c];
+            }
+        }
+    }
+    return nonsingular;
+}
+
+/**
+ * @brief Blocked, right-looking LU factorization with partial pivoting, overwriting A with its factors.
+ *
+ * On return, the strictly lower triangle of A holds L (whose unit diagonal is implied) and the upper triangle holds U,
+ * so that P * A = L * U, where P is described by the pivots. Following the LAPACK getrf convention, row k was
+ * interchanged with row pivots[k] at step k. Only the n x n matrix and n pivot indices are stored, rather than the
+ * three dense n x n matrices held by MyFactorizationMethod::Parameters.
+ *
+ * Each step factorizes one panel of blockSize columns, then updates the trailing columns tile by tile. Every tile is
+ * an OpenMP task that applies the unit lower triangular solve with the panel's diagonal block to its rows of U and
+ * then subtracts the panel product from the rest of the tile with MyBLAS::gemm.
+ *
+ * @tparam T The data type of the matrix elements.
+ * @param A The square matrix to factorize, overwritten with L and U.
+ * @param pivots Resized to n and filled with the row interchanges.
+ * @param blockSize The number of columns per panel and per trailing update tile.
+ * @param pivoting If false, no rows are interchanged and the pivots are the identity.
+ * @return false if the matrix is singular, i.e. an exactly zero pivot was met.
+ */
+template <typename T>
+bool factorizeInPlace(MyBLAS::Matrix<T> &A, std::vector<size_t> &pivots, const size_t blockSize = DefaultBlockSize,
+                      const bool pivoting = true) {
+    assert(A.getRows() == A.getCols());
+    const size_t n = A.getRows();
+    const size_t ld = A.getLeadingDimension();
+    const size_t nb = std::max<size_t>(1, blockSize);
+    T *a = A.getBuffer();
+    pivots.resize(n);
+    bool nonsingular = true;
+    PROFILE_ZONE("LUP factorize");
+
+    #pragma omp parallel default(none) shared(A, a, pivots, pivoting, nonsingular, n, ld, nb)
+    #pragma omp single
+    for (size_t k0 = 0; k0 < n; k0 += nb) {
+        const size_t kb = std::min(nb, n - k0);
+        PROFILE_ZONE_NAMED(panelZone, "LUP panel");
+        if (!factorizePanel(A, pivots, k0, kb, pivoting)) {
+            nonsingular = false;
+        }
+        PROFILE_ZONE_STOP(panelZone);
+
+        const size_t trailing = k0 + kb;
+        for (size_t j0 = trailing; j0 < n; j0 += nb) {
+            const size_t jb = std::min(nb, n - j0);
+            #pragma omp task default(none) firstprivate(k0, kb, j0, jb, trailing) shared(a, n, ld)
+            {
+                // recorded on whichever thread runs the task
+                PROFILE_ZONE("LUP trailing update");
+                // U12 = L11^-1 * A12, restricted to this tile's columns
+                for (size_t i = k0 + 1; i < trailing; i++) {
+                    T *row = a + i * ld + j0;
+                    for (size_t p = k0; p < i; p++) {
+                        const T multiplier = a[i * ld + p];
+                        const T *source = a + p * ld + j0;
+                        for (size_t j = 0; j < jb; j++) {
+                            row[j] -= multiplier * source[j];
+                        }
+                    }
+                }
+                // A22 -= L21 * U12, restricted to this tile's columns
+                MyBLAS::gemm(n - trailing, jb, kb, static_cast<T>(-1), a + trailing * ld + k0, ld, a + k0 * ld + j0, ld,
+                             static_cast<T>(1), a + trailing * ld + j0, ld);
+            }
+        }
+        PROFILE_ZONE_NAMED(waitZone, "LUP taskwait");
+        #pragma omp taskwait
+        PROFILE_ZONE_STOP(waitZone);
+    }
+
+    if (!nonsingular) {
+        std::cerr << "Warning: LU factorization met a zero pivot, the matrix is singular.\n";
+    }
+    return nonsingular;
+}
+
+/**
+ * @brief Applies the row interchanges recorded by factorizeInPlace to a vector, in the order they were made.
+ */
+template <typename T>
+void permute(const std::vector<size_t> &pivots, MyBLAS::Vector<T> &b) {
+    for (size_t k = 0; k < pivots.size(); k++) {
+        if (pivots[k] != k) {
+            std::swap(b[k], b[pivots[k]]);
+        }
+    }
+}
+
+/**
+ * @brief Solves A * x = b in place, given the packed factors and pivots of A from factorizeInPlace.
+ *
+ * @param LU The packed factors of A.
+ * @param pivots The row interchanges of A.
+ * @param x On entry the right hand side b, on exit the solution x.
+ */
+template <typename T>
+void solveInPlace(const MyBLAS::Matrix<T> &LU, const std::vector<size_t> &pivots, MyBLAS::Vector<T> &x) {
+    const size_t n = LU.getRows();
+    assert(x.size() == n && pivots.size() == n);
+    PROFILE_ZONE("LUP solve");
+    permute(pivots, x);
+
+    // Forward substitution with the implied unit diagonal of L
+    for (size_t i = 1; i < n; i++) {
+        const T *row = LU.rowPointer(i);
+        T sum = 0;
+        for (size_t j = 0; j < i; j++) {
+            sum += row[j] * x[j];
+        }
+        x[i] -= sum;
+    }
+
+    // Backward substitution with U
+    for (size_t i = n; i-- > 0;) {
+        const T *row = LU.rowPointer(i);
+        T sum = 0;
+        for (size_t j = i + 1; j < n; j++) {
+            sum += row[j] * x[j];
+        }
+        x[i] = (x[i] - sum) / row[i];
+    }
+}
+
 /**
  * @brief Performs Doolittle's LU factorization with partial pivoting on a given matrix.
  *
- * This method first finds the pivot row by identifying the maximum absolute value in each column.
- * It then swaps the pivot row with the current row in both the matrix and the permutation matrix.
- * Finally, it performs Doolittle's LU factorization on the pivoted matrix.
+ * The factors are computed in place by factorizeInPlace, with the pivots chosen column by column as the elimination
+ * proceeds, and then unpacked into a unit lower triangular L, an upper triangular U, and the permutation matrix P
+ * such that P * A = L * U.
  *
  * @tparam T The data type of the matrix elements.
  * @param L The lower triangular matrix after factorization.
@@ -61,36 +247,35 @@ namespace MyBLAS::LUP {
 template <template<typename> class MatrixType, typename T>
 MatrixType<T> dooLittleFactorizeLUP(MatrixType<T> &L, MatrixType<T> &U, const MatrixType<T> &A) {
 
-    MatrixType pivotedA = A;
-
-    const size_t n = pivotedA.getCols();
-
-    // Initialize the permutation matrix P to the identity matrix
-    MatrixType P = MatrixType<T>::eye(n);
+    MyBLAS::Matrix<T> LU(A);
+    std::vector<size_t> pivots;
+    factorizeInPlace(LU, pivots);
 
-    // Perform LU factorization with partial pivoting
+    const size_t n = LU.getRows();
+    L = MatrixType<T>(n, n, 0);
+    U = MatrixType<T>(n, n, 0);
     for (size_t i = 0; i < n; i++) {
-        // Find the pivot row
-        T max_val = 0;
-        size_t pivot_row = i;
-//        #pragma omp parallel for default(none) shared(pivotedA, i, max_val, pivot_row)
+        for (size_t j = 0; j < i; j++) {
+            L[i][j] = LU[i][j];
+        }
+        L[i][i] = 1;
         for (size_t j = i; j < n; j++) {
-            const auto absoluteVal = std::abs(pivotedA[j][i]);
-//            #pragma omp critical
-            if (absoluteVal > max_val) {
-                max_val = absoluteVal;
-                pivot_row = j;
-            }
+            U[i][j] = LU[i][j];
         }
+    }
 
-        // Swap rows in A and P
-        if (pivot_row != i) {
-            pivotedA.swapRows(i, pivot_row);
-            P.swapRows(i, pivot_row);
-        }
+    // Row k of P * A is row order[k] of A
+    std::vector<size_t> order(n);
+    for (size_t k = 0; k < n; k++) {
+        order[k] = k;
+    }
+    for (size_t k = 0; k < n; k++) {
+        std::swap(order[k], order[pivots[k]]);
+    }
+    MatrixType<T> P(n, n, 0);
+    for (size_t k = 0; k < n; k++) {
+        P[k][order[k]] = 1;
     }
-    // Perform factorization on the updated matrix A
-    MyBLAS::LU::doolittleFactorize<T>(L, U, pivotedA);
 
     return P;
 }
@@ -148,8 +333,8 @@ MatrixType<T> recursiveFactorizeLUP(MatrixType<T> &L, MatrixType<T> &U, const Ma
         A12 = (A12 / U[0][0]);
         A21 = (A21 / L[0][0]);
 
-        // Update A22
-        A22 = A22 - (A21 * A12);
+        // Update A22 in place with the Schur complement, A22 -= A21 * A12
+        MyBLAS::gemm(static_cast<T>(-1), A21, A12, static_cast<T>(1), A22);
 
         // Recursively apply the same procedure to the updated A22
         MatrixType<T> L22(n - 1, n - 1);
@@ -266,34 +451,36 @@ MyFactorizationMethod::Parameters<T> factorize(const MatrixType<T> &A) {
 /**
  * @brief This function solves a system of linear equations Ax = b using LU factorization with partial pivoting.
  *
- * The function first performs LU factorization on the matrix A using the Doolittle's method.
- * It then solves the system Ly = Pb and Ux = y using forward and backward substitution, respectively.
+ * The function factorizes a copy of A in place with factorizeInPlace, then permutes b with the recorded row
+ * interchanges and solves Ly = Pb and Ux = y on the packed factors. Neither L, U nor P are formed explicitly.
  *
  * @tparam T This is the data type of the elements in the matrices and vectors. It can be any numeric type.
  * @param A This is the input matrix that represents the coefficients of the linear equations. It should be square.
  * @param b This is the input vector that represents the constant terms of the linear equations.
- * @param tolerance This is the tolerance for the forward and backward substitution. The default value is 0.
- * @return The function returns a Solution object which contains the solution vector x.
+ * @param tolerance Unused, kept for compatibility with the other direct solvers.
+ * @return The function returns a Solution object which contains the solution vector x. If the factorization met a zero
+ * pivot, converged is false and x is all NaN.
  * @note The function does not check if the input matrix A is square or if the dimensions of A and b are compatible.
  * It is the responsibility of the caller to ensure this.
  */
 template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
 MyBLAS::Solver::Solution<T> applyLUP(const MatrixType<T> &A, const VectorType<T> &b,
-                                            const T tolerance = 0) {
-
-    const size_t n = A.getRows(); // Get the number of rows in the matrix A
+                                            [[maybe_unused]] const T tolerance = 0) {
 
-    MyFactorizationMethod::Parameters<T> parameters(n);
-    parameters.P = dooLittleFactorizeLUP(parameters.L, parameters.U, A);
-
-    MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    MyBLAS::Matrix<T> LU(A);
+    std::vector<size_t> pivots;
+    MyBLAS::Solver::Solution<T> results;
 
-    const auto Pb = parameters.P * b;
-
-    const MyBLAS::Vector<T> y = MyBLAS::forwardSubstitution(parameters.L, Pb);
-    const MyBLAS::Vector<T> x = MyBLAS::backwardSubstitution(parameters.U, y);
+    // a zero pivot would divide by zero in the back substitution, so the solve is skipped
+    if (!factorizeInPlace(LU, pivots)) {
+        results.x = MyBLAS::Vector<T>(b.size(), std::numeric_limits<T>::quiet_NaN());
+        results.converged = false;
+        return results;
+    }
 
-    results.x = x;
+    results.x = b;
+    solveInPlace(LU, pivots, results.x);
+    results.converged = true;
 
     return results;
 }
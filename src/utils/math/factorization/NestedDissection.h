@@ -0,0 +1,294 @@
+/**
+ * @file NestedDissection.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Nested dissection orderings, which reduce the fill-in of a sparse Cholesky factorization.
+ *
+ * Nested dissection removes a small set of nodes, the separator, that splits the graph of the matrix into two halves
+ * with no edges between them, orders each half recursively, and numbers the separator last. Eliminating one half then
+ * creates no fill-in in the other, so the factor only fills in within each half and in the separator rows. On an
+ * m x n mesh, splitting across the shorter side every time gives O(N log N) nonzeros in the factor and O(N^1.5) work,
+ * with N = m * n, instead of the O(N^1.5) nonzeros and O(N^2) work of the banded ordering. The halves are also
+ * independent subtrees of the elimination tree, which is what lets them be factorized in parallel.
+ *
+ * An ordering is returned as a permutation: order[k] is the original index of the k-th unknown to be eliminated.
+ */
+
+#ifndef NE591_008_NESTEDDISSECTION_H
+#define NE591_008_NESTEDDISSECTION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "math/blas/matrix/SparseMatrix.h"
+
+namespace MyFactorizationMethod::Ordering {
+
+/**
+ * @brief The default number of nodes below which a part is no longer dissected, and is ordered as it is.
+ */
+constexpr size_t DefaultLeafSize = 16;
+
+/**
+ * @brief Geometric nested dissection of an m x n mesh, with node (i, j) at index i * n + j.
+ * @details Each rectangle is split by the mesh line through the middle of its longer side, which is the shortest
+ * separator there is. Rectangles with at most leafSize nodes are ordered row by row.
+ * @param m The number of mesh rows.
+ * @param n The number of mesh columns.
+ * @param leafSize The size below which rectangles are not split.
+ * @return The elimination order.
+ */
+inline std::vector<size_t> nestedDissection(const size_t m, const size_t n, const size_t leafSize = DefaultLeafSize) {
+    std::vector<size_t> order;
+    order.reserve(m * n);
+
+    // each rectangle is [r0, r1) x [c0, c1)
+    const auto dissect = [&order, n, leafSize](const auto &self, const size_t r0, const size_t r1, const size_t c0,
+                                                const size_t c1) -> void {
+        const size_t rows = r1 - r0, cols = c1 - c0;
+        if (rows == 0 || cols == 0) {
+            return;
+        }
+        if (rows * cols <= std::max<size_t>(leafSize, 1) || std::max(rows, cols) < 3) {
+            for (size_t i = r0; i < r1; i++) {
+                for (size_t j = c0; j < c1; j++) {
+                    order.push_back(i * n + j);
+                }
+            }
+            return;
+        }
+        if (rows >= cols) {
+            const size_t middle = r0 + rows / 2;
+            self(self, r0, middle, c0, c1);
+            self(self, middle + 1, r1, c0, c1);
+            for (size_t j = c0; j < c1; j++) {
+                order.push_back(middle * n + j);
+            }
+        } else {
+            const size_t middle = c0 + cols / 2;
+            self(self, r0, r1, c0, middle);
+            self(self, r0, r1, middle + 1, c1);
+            for (size_t i = r0; i < r1; i++) {
+                order.push_back(i * n + middle);
+            }
+        }
+    };
+    dissect(dissect, 0, m, 0, n);
+    return order;
+}
+
+/**
+ * @class GraphDissection
+ * @brief Nested dissection of the graph of a general symmetric sparse matrix, with level structure separators.
+ *
+ * Each part is split by a breadth-first search from a pseudo-peripheral node, i.e. one of the two ends of a long path
+ * through the part. The levels of the search are layers of nodes that only touch their neighboring layers, so the
+ * middle level separates the levels before it from the levels after it. The nodes of the middle level with no
+ * neighbor in the level after it are moved into the first half, which thins the separator. A part that the search
+ * does not cover is split into the covered component and the rest, with an empty separator.
+ */
+class GraphDissection {
+  public:
+    /**
+     * @brief Builds the adjacency lists of the graph of A + A^T, without self loops.
+     */
+    template <typename T>
+    explicit GraphDissection(const MyBLAS::SparseMatrix<T> &A, const size_t leafSize = DefaultLeafSize)
+        : leaf(std::max<size_t>(leafSize, 1)) {
+        const size_t n = A.getRows();
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        std::vector<size_t> degree(n, 0);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t e = rowPointers[i]; e < rowPointers[i + 1]; e++) {
+                if (columnIndices[e] != i) {
+                    degree[i]++;
+                    degree[columnIndices[e]]++;
+                }
+            }
+        }
+        pointers.assign(n + 1, 0);
+        for (size_t i = 0; i < n; i++) {
+            pointers[i + 1] = pointers[i] + degree[i];
+        }
+        neighbors.resize(pointers[n]);
+        std::vector<size_t> next(pointers.begin(), pointers.end() - 1);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t e = rowPointers[i]; e < rowPointers[i + 1]; e++) {
+                const size_t j = columnIndices[e];
+                if (j != i) {
+                    neighbors[next[i]++] = j;
+                    neighbors[next[j]++] = i;
+                }
+            }
+        }
+        // a symmetric pattern lists every edge twice, so drop the duplicates
+        for (size_t i = 0; i < n; i++) {
+            const auto begin = neighbors.begin() + static_cast<std::ptrdiff_t>(pointers[i]);
+            const auto end = neighbors.begin() + static_cast<std::ptrdiff_t>(pointers[i + 1]);
+            std::sort(begin, end);
+            std::fill(std::unique(begin, end), end, NoNode);
+        }
+    }
+
+    /**
+     * @brief Returns the elimination order.
+     */
+    [[nodiscard]] std::vector<size_t> order() {
+        const size_t n = pointers.size() - 1;
+        part.assign(n, 0);
+        level.assign(n, NoNode);
+        std::vector<size_t> nodes(n);
+        for (size_t i = 0; i < n; i++) {
+            nodes[i] = i;
+        }
+        std::vector<size_t> result;
+        result.reserve(n);
+        parts = 0;
+        dissect(nodes, result);
+        return result;
+    }
+
+  private:
+    static constexpr size_t NoNode = static_cast<size_t>(-1);
+
+    size_t leaf;
+    std::vector<size_t> pointers;  ///< Offsets of each node's neighbors, one per node plus one.
+    std::vector<size_t> neighbors; ///< The neighbors of each node, padded with NoNode where duplicates were removed.
+    std::vector<size_t> part;      ///< The label of the part each node currently belongs to.
+    std::vector<size_t> level;     ///< The breadth-first level of each node, in the latest search.
+    size_t parts = 0;              ///< The number of labels handed out so far.
+
+    template <typename Function>
+    void forEachNeighborInPart(const size_t node, const size_t label, Function &&function) const {
+        for (size_t e = pointers[node]; e < pointers[node + 1]; e++) {
+            const size_t other = neighbors[e];
+            if (other != NoNode && part[other] == label) {
+                function(other);
+            }
+        }
+    }
+
+    /**
+     * @brief Breadth-first search from root over the nodes labelled label, recording the level of each node reached.
+     * @return The nodes reached, in the order they were reached, which is sorted by level.
+     */
+    std::vector<size_t> search(const size_t root, const size_t label) {
+        std::vector<size_t> queue{root};
+        level[root] = 0;
+        for (size_t head = 0; head < queue.size(); head++) {
+            const size_t node = queue[head];
+            forEachNeighborInPart(node, label, [this, &queue, node](const size_t other) {
+                if (level[other] == NoNode) {
+                    level[other] = level[node] + 1;
+                    queue.push_back(other);
+                }
+            });
+        }
+        return queue;
+    }
+
+    void clearLevels(const std::vector<size_t> &nodes) {
+        for (const size_t node : nodes) {
+            level[node] = NoNode;
+        }
+    }
+
+    /**
+     * @brief Orders the nodes of one part, which all carry the same label, and appends them to result.
+     */
+    void dissect(const std::vector<size_t> &nodes, std::vector<size_t> &result) {
+        if (nodes.size() <= leaf) {
+            result.insert(result.end(), nodes.begin(), nodes.end());
+            return;
+        }
+        const size_t label = part[nodes.front()];
+
+        // George and Liu: search again from a node of smallest degree in the last level, until the depth stops growing
+        std::vector<size_t> reached = search(nodes.front(), label);
+        for (size_t attempt = 0; attempt < 8; attempt++) {
+            const size_t depth = level[reached.back()];
+            size_t candidate = reached.back(), smallest = NoNode;
+            for (size_t k = reached.size(); k-- > 0 && level[reached[k]] == depth;) {
+                size_t degree = 0;
+                forEachNeighborInPart(reached[k], label, [&degree](size_t) { degree++; });
+                if (degree < smallest) {
+                    smallest = degree;
+                    candidate = reached[k];
+                }
+            }
+            clearLevels(reached);
+            auto next = search(candidate, label);
+            const bool deeper = level[next.back()] > depth;
+            reached = std::move(next);
+            if (!deeper) {
+                break;
+            }
+        }
+
+        std::vector<size_t> first, second, separator;
+        if (reached.size() < nodes.size()) {
+            // the part is disconnected: the component that was reached is one half, and the rest the other
+            first = reached;
+            for (const size_t node : nodes) {
+                if (level[node] == NoNode) {
+                    second.push_back(node);
+                }
+            }
+        } else {
+            const size_t depth = level[reached.back()];
+            if (depth < 2) {
+                clearLevels(reached);
+                result.insert(result.end(), nodes.begin(), nodes.end());
+                return;
+            }
+            // the first level at which half the nodes have been reached, kept away from both ends
+            size_t middle = level[reached[reached.size() / 2]];
+            middle = std::clamp<size_t>(middle, 1, depth - 1);
+            for (const size_t node : reached) {
+                if (level[node] < middle) {
+                    first.push_back(node);
+                } else if (level[node] > middle) {
+                    second.push_back(node);
+                } else {
+                    bool touchesSecond = false;
+                    forEachNeighborInPart(node, label, [this, middle, &touchesSecond](const size_t other) {
+                        touchesSecond = touchesSecond || level[other] == middle + 1;
+                    });
+                    (touchesSecond ? separator : first).push_back(node);
+                }
+            }
+        }
+        clearLevels(reached);
+
+        const size_t firstLabel = ++parts, secondLabel = ++parts, separatorLabel = ++parts;
+        for (const size_t node : first) {
+            part[node] = firstLabel;
+        }
+        for (const size_t node : second) {
+            part[node] = secondLabel;
+        }
+        for (const size_t node : separator) {
+            part[node] = separatorLabel;
+        }
+        dissect(first, result);
+        dissect(second, result);
+        result.insert(result.end(), separator.begin(), separator.end());
+    }
+};
+
+/**
+ * @brief Graph nested dissection of a symmetric sparse matrix.
+ * @param A The matrix. Only its sparsity pattern is used, symmetrized if it is not already.
+ * @param leafSize The size below which parts are not split.
+ * @return The elimination order.
+ */
+template <typename T>
+std::vector<size_t> nestedDissection(const MyBLAS::SparseMatrix<T> &A, const size_t leafSize = DefaultLeafSize) {
+    return GraphDissection(A, leafSize).order();
+}
+
+} // namespace MyFactorizationMethod::Ordering
+
+#endif // NE591_008_NESTEDDISSECTION_H
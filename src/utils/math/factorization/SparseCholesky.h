@@ -0,0 +1,586 @@
+/**
+ * @file SparseCholesky.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Supernodal multifrontal Cholesky factorization of a sparse symmetric positive definite matrix.
+ *
+ * The factorization runs in three phases.
+ *
+ * 1. Ordering. The unknowns are permuted by nested dissection (see NestedDissection.h), geometrically for the m x n
+ *    diffusion mesh, or on the graph of the matrix otherwise, to keep the fill-in of the factor small.
+ * 2. Symbolic analysis. The elimination tree of the permuted matrix, where parent(j) is the first row below j in
+ *    column j of L, is built and postordered, so that every subtree is a contiguous range of columns. The nonzero rows
+ *    of each column of L are the rows of A in that column merged with the rows of its children. Runs of columns that
+ *    form a chain in the tree and share the same rows below the chain are grouped into supernodes, whose columns are
+ *    stored together as one dense block.
+ * 3. Numeric factorization. Each supernode assembles a dense frontal matrix from its columns of A and the update
+ *    matrices of its children, factorizes its own columns, and passes the Schur complement of the rest up to its
+ *    parent as its update matrix. The Schur complement is a matrix-matrix product, computed with MyBLAS::gemm. Sibling
+ *    subtrees share no data, so the elimination tree is walked with OpenMP tasks, one per large enough subtree.
+ *
+ * Once factorized, each solve is a forward and a backward substitution over the supernodes, which costs about as much
+ * as two products with L, and may run from several threads at once. The factorization is meant to be computed once,
+ * and reused for many right hand sides.
+ */
+
+#ifndef NE591_008_SPARSECHOLESKY_H
+#define NE591_008_SPARSECHOLESKY_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Factorize.h"
+#include "NestedDissection.h"
+#include "math/blas/GEMM.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+
+namespace MyFactorizationMethod {
+
+/**
+ * @brief The number of columns in a subtree of the elimination tree, above which it is factorized as a separate task.
+ */
+constexpr size_t MinTaskColumns = 256;
+
+/**
+ * @class SparseCholesky
+ * @brief The factorization P * A * P^T = L * L^T of a sparse symmetric positive definite matrix.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class SparseCholesky {
+  public:
+    SparseCholesky() = default;
+
+    /**
+     * @brief Factorizes a sparse, dense or stencil matrix, ordered by nested dissection on its graph.
+     * @param A The square, symmetric positive definite matrix.
+     */
+    template <class MatrixType>
+    explicit SparseCholesky(const MatrixType &A) {
+        const auto sparse = toSparse(A);
+        analyze(sparse, Ordering::nestedDissection(sparse));
+        factorize(sparse);
+    }
+
+    /**
+     * @brief Factorizes the matrix of an m x n mesh, with node (i, j) at index i * n + j, ordered by geometric nested
+     * dissection of the mesh.
+     * @param A The square, symmetric positive definite matrix, such as MyPhysics::Diffusion::Matrix.
+     * @param meshRows The number of mesh rows m.
+     * @param meshColumns The number of mesh columns n.
+     */
+    template <class MatrixType>
+    SparseCholesky(const MatrixType &A, const size_t meshRows, const size_t meshColumns) {
+        assert(meshRows * meshColumns == A.getRows());
+        const auto sparse = toSparse(A);
+        analyze(sparse, Ordering::nestedDissection(meshRows, meshColumns));
+        factorize(sparse);
+    }
+
+    /**
+     * @brief Computes the elimination tree, the supernodes and the nonzero structure of L, for the given ordering.
+     * @param A The square, symmetric matrix. Only its sparsity pattern is used.
+     * @param order The elimination order, a permutation of 0 ... n - 1.
+     */
+    void analyze(const MyBLAS::SparseMatrix<T> &A, std::vector<size_t> order) {
+        const size_t n = A.getRows();
+        assert(order.size() == n);
+        _order = std::move(order);
+        invert();
+
+        // renumbering by a postorder of the tree keeps the tree, and makes every subtree contiguous
+        auto parent = eliminationTree(A);
+        const auto post = postorder(parent);
+        std::vector<size_t> relabelled(n);
+        for (size_t k = 0; k < n; k++) {
+            relabelled[k] = _order[post[k]];
+        }
+        _order = std::move(relabelled);
+        invert();
+        parent = eliminationTree(A);
+
+        const auto structure = columnStructure(A, parent);
+        buildSupernodes(parent, structure);
+        analyzed = true;
+        factorized = false;
+    }
+
+    /**
+     * @brief Computes the numeric factor of A, reusing the analysis of a matrix with the same sparsity pattern.
+     * @param A The square, symmetric positive definite matrix.
+     * @return false if a pivot was not positive, i.e. A is not positive definite. The factor is unusable in that case.
+     */
+    bool factorize(const MyBLAS::SparseMatrix<T> &A) {
+        assert(analyzed && A.getRows() == _order.size());
+        const size_t count = supernodes.size();
+        updates.assign(count, {});
+        bool positive = true;
+
+        std::vector<size_t> roots;
+        for (size_t s = 0; s < count; s++) {
+            if (supernodes[s].parent == NoSupernode) {
+                roots.push_back(s);
+            }
+        }
+
+        #pragma omp parallel default(none) shared(A, roots, positive)
+        #pragma omp single
+        for (const size_t root : roots) {
+            #pragma omp task default(none) firstprivate(root) shared(A, positive)
+            factorizeSubtree(A, root, positive);
+        }
+
+        updates.clear();
+        updates.shrink_to_fit();
+        factorized = positive;
+        if (!positive) {
+            std::cerr << "Error: sparse Cholesky factorization met a non-positive pivot, the matrix is not positive "
+                         "definite.\n";
+        }
+        return positive;
+    }
+
+    /**
+     * @brief Solves A * x = b in place, overwriting the right hand side x with the solution.
+     */
+    template <template<typename> class VectorType>
+    void solveInPlace(VectorType<T> &x) const {
+        assert(factorized);
+        const size_t n = _order.size();
+        assert(x.size() == n);
+        std::vector<T> y(n);
+        for (size_t k = 0; k < n; k++) {
+            y[k] = x[_order[k]];
+        }
+
+        // L * z = y, children before parents
+        for (const auto &node : supernodes) {
+            const size_t width = node.last - node.first;
+            const size_t height = node.rows.size();
+            const T *L = node.values.data();
+            T *z = y.data() + node.first;
+            for (size_t j = 0; j < width; j++) {
+                const T *row = L + j * width;
+                T sum = z[j];
+                for (size_t p = 0; p < j; p++) {
+                    sum -= row[p] * z[p];
+                }
+                z[j] = sum / row[j];
+            }
+            for (size_t i = width; i < height; i++) {
+                const T *row = L + i * width;
+                T sum = 0;
+                for (size_t p = 0; p < width; p++) {
+                    sum += row[p] * z[p];
+                }
+                y[node.rows[i]] -= sum;
+            }
+        }
+
+        // L^T * y = z, parents before children
+        for (size_t s = supernodes.size(); s-- > 0;) {
+            const auto &node = supernodes[s];
+            const size_t width = node.last - node.first;
+            const size_t height = node.rows.size();
+            const T *L = node.values.data();
+            T *z = y.data() + node.first;
+            for (size_t j = width; j-- > 0;) {
+                T sum = z[j];
+                for (size_t i = width; i < height; i++) {
+                    sum -= L[i * width + j] * y[node.rows[i]];
+                }
+                for (size_t i = j + 1; i < width; i++) {
+                    sum -= L[i * width + j] * z[i];
+                }
+                z[j] = sum / L[j * width + j];
+            }
+        }
+
+        for (size_t k = 0; k < n; k++) {
+            x[_order[k]] = y[k];
+        }
+    }
+
+    [[nodiscard]] bool isFactorized() const { return factorized; }
+
+    /**
+     * @brief Returns the elimination order: order[k] is the original index of the k-th column of L.
+     */
+    [[nodiscard]] const std::vector<size_t> &getOrder() const { return _order; }
+
+    /**
+     * @brief Returns the number of supernodes.
+     */
+    [[nodiscard]] size_t getSupernodes() const { return supernodes.size(); }
+
+    /**
+     * @brief Returns the number of nonzeros in L, including the diagonal.
+     */
+    [[nodiscard]] size_t getNonZeros() const {
+        size_t count = 0;
+        for (const auto &node : supernodes) {
+            const size_t width = node.last - node.first;
+            count += width * node.rows.size() - width * (width - 1) / 2;
+        }
+        return count;
+    }
+
+  private:
+    static constexpr size_t NoSupernode = static_cast<size_t>(-1);
+
+    /**
+     * @brief A run of columns first ... last - 1 of L with the same nonzero rows below the run.
+     */
+    struct Supernode {
+        size_t first = 0;
+        size_t last = 0;
+        size_t parent = NoSupernode;
+        size_t columns = 0;          ///< The number of columns in the subtree rooted here.
+        std::vector<size_t> children;
+        std::vector<size_t> rows;    ///< The nonzero rows, sorted, starting with first ... last - 1.
+        std::vector<T> values;       ///< The columns of L, as a dense rows.size() x (last - first) row-major block.
+    };
+
+    std::vector<size_t> _order;
+    std::vector<size_t> inverse;   ///< inverse[order[k]] = k.
+    std::vector<Supernode> supernodes;
+    std::vector<std::vector<T>> updates; ///< The update matrix of each supernode, until its parent has assembled it.
+    bool analyzed = false;
+    bool factorized = false;
+
+    template <class MatrixType>
+    static MyBLAS::SparseMatrix<T> toSparse(const MatrixType &A) {
+        if constexpr (std::is_same_v<MatrixType, MyBLAS::SparseMatrix<T>>) {
+            return A;
+        } else {
+            return MyBLAS::SparseMatrix<T>(A);
+        }
+    }
+
+    void invert() {
+        inverse.assign(_order.size(), 0);
+        for (size_t k = 0; k < _order.size(); k++) {
+            inverse[_order[k]] = k;
+        }
+    }
+
+    /**
+     * @brief Liu's algorithm, with path compression, on the permuted pattern of A.
+     */
+    std::vector<size_t> eliminationTree(const MyBLAS::SparseMatrix<T> &A) const {
+        const size_t n = _order.size();
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        std::vector<size_t> parent(n, NoSupernode), ancestor(n, NoSupernode);
+        for (size_t i = 0; i < n; i++) {
+            const size_t original = _order[i];
+            for (size_t e = rowPointers[original]; e < rowPointers[original + 1]; e++) {
+                size_t k = inverse[columnIndices[e]];
+                while (k != NoSupernode && k < i) {
+                    const size_t next = ancestor[k];
+                    ancestor[k] = i;
+                    if (next == NoSupernode) {
+                        parent[k] = i;
+                    }
+                    k = next;
+                }
+            }
+        }
+        return parent;
+    }
+
+    /**
+     * @brief Returns a postorder of the forest, post[k] being the k-th column visited.
+     */
+    static std::vector<size_t> postorder(const std::vector<size_t> &parent) {
+        const size_t n = parent.size();
+        // children as linked lists, in increasing order
+        std::vector<size_t> head(n, NoSupernode), next(n, NoSupernode);
+        for (size_t j = n; j-- > 0;) {
+            if (parent[j] != NoSupernode) {
+                next[j] = head[parent[j]];
+                head[parent[j]] = j;
+            }
+        }
+        std::vector<size_t> post, stack;
+        post.reserve(n);
+        for (size_t root = 0; root < n; root++) {
+            if (parent[root] != NoSupernode) {
+                continue;
+            }
+            stack.push_back(root);
+            while (!stack.empty()) {
+                const size_t node = stack.back();
+                const size_t child = head[node];
+                if (child == NoSupernode) {
+                    post.push_back(node);
+                    stack.pop_back();
+                } else {
+                    head[node] = next[child];
+                    stack.push_back(child);
+                }
+            }
+        }
+        return post;
+    }
+
+    /**
+     * @brief The nonzero rows below the diagonal of each column of L, each merged from the rows of A in that column
+     * and the rows of its children.
+     */
+    std::vector<std::vector<size_t>> columnStructure(const MyBLAS::SparseMatrix<T> &A, const std::vector<size_t> &parent) const {
+        const size_t n = _order.size();
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        std::vector<std::vector<size_t>> structure(n), children(n);
+        for (size_t j = 0; j < n; j++) {
+            if (parent[j] != NoSupernode) {
+                children[parent[j]].push_back(j);
+            }
+        }
+        std::vector<size_t> mark(n, NoSupernode);
+        for (size_t j = 0; j < n; j++) {
+            auto &rows = structure[j];
+            mark[j] = j;
+            const size_t original = _order[j];
+            for (size_t e = rowPointers[original]; e < rowPointers[original + 1]; e++) {
+                const size_t i = inverse[columnIndices[e]];
+                if (i > j && mark[i] != j) {
+                    mark[i] = j;
+                    rows.push_back(i);
+                }
+            }
+            for (const size_t child : children[j]) {
+                for (const size_t i : structure[child]) {
+                    if (i > j && mark[i] != j) {
+                        mark[i] = j;
+                        rows.push_back(i);
+                    }
+                }
+            }
+            std::sort(rows.begin(), rows.end());
+        }
+        return structure;
+    }
+
+    /**
+     * @brief Groups the columns into fundamental supernodes: column j joins the supernode of column j - 1 when j - 1 is
+     * the only child of j, and column j - 1 has exactly the rows of column j below j.
+     */
+    void buildSupernodes(const std::vector<size_t> &parent, const std::vector<std::vector<size_t>> &structure) {
+        const size_t n = _order.size();
+        std::vector<size_t> childCount(n, 0);
+        for (size_t j = 0; j < n; j++) {
+            if (parent[j] != NoSupernode) {
+                childCount[parent[j]]++;
+            }
+        }
+
+        supernodes.clear();
+        std::vector<size_t> owner(n);
+        for (size_t j = 0; j < n; j++) {
+            const bool extends = j > 0 && parent[j - 1] == j && childCount[j] == 1 &&
+                                 structure[j - 1].size() == structure[j].size() + 1;
+            if (!extends) {
+                supernodes.emplace_back();
+                supernodes.back().first = j;
+            }
+            supernodes.back().last = j + 1;
+            owner[j] = supernodes.size() - 1;
+        }
+
+        for (size_t s = 0; s < supernodes.size(); s++) {
+            auto &node = supernodes[s];
+            for (size_t j = node.first; j < node.last; j++) {
+                node.rows.push_back(j);
+            }
+            const auto &below = structure[node.last - 1];
+            node.rows.insert(node.rows.end(), below.begin(), below.end());
+            const size_t top = parent[node.last - 1];
+            if (top != NoSupernode) {
+                node.parent = owner[top];
+                supernodes[node.parent].children.push_back(s);
+            }
+        }
+
+        // children come before their parents in a postorder, so the subtree sizes accumulate in one pass
+        for (auto &node : supernodes) {
+            node.columns += node.last - node.first;
+            if (node.parent != NoSupernode) {
+                supernodes[node.parent].columns += node.columns;
+            }
+        }
+    }
+
+    /**
+     * @brief Factorizes the supernodes of a subtree, spawning a task for every child subtree that is large enough.
+     */
+    void factorizeSubtree(const MyBLAS::SparseMatrix<T> &A, const size_t s, bool &positive) {
+        for (const size_t child : supernodes[s].children) {
+            #pragma omp task default(none) firstprivate(child) shared(A, positive) if(supernodes[child].columns >= MinTaskColumns)
+            factorizeSubtree(A, child, positive);
+        }
+        #pragma omp taskwait
+        // a failed descendant leaves no update matrix to assemble, so the rest of the tree is abandoned
+        bool proceed;
+        #pragma omp atomic read
+        proceed = positive;
+        if (proceed && !factorFront(A, s)) {
+            #pragma omp atomic write
+            positive = false;
+        }
+    }
+
+    /**
+     * @brief Assembles, partially factorizes, and stores the frontal matrix of one supernode.
+     * @return false if a pivot was not positive.
+     */
+    bool factorFront(const MyBLAS::SparseMatrix<T> &A, const size_t s) {
+        auto &node = supernodes[s];
+        const size_t width = node.last - node.first;
+        const size_t height = node.rows.size();
+        const auto &rows = node.rows;
+        std::vector<T> F(height * height, 0);
+
+        // the columns of A, below the diagonal
+        const auto &rowPointers = A.getRowPointers();
+        const auto &columnIndices = A.getColumnIndices();
+        const auto &values = A.getValues();
+        for (size_t c = 0; c < width; c++) {
+            const size_t j = node.first + c;
+            const size_t original = _order[j];
+            for (size_t e = rowPointers[original]; e < rowPointers[original + 1]; e++) {
+                const size_t i = inverse[columnIndices[e]];
+                if (i >= j) {
+                    const size_t position = static_cast<size_t>(std::lower_bound(rows.begin(), rows.end(), i) - rows.begin());
+                    F[position * height + c] += values[e];
+                }
+            }
+        }
+
+        // extend-add the update matrices of the children, whose rows are a sorted subset of this front's rows
+        std::vector<size_t> map;
+        for (const size_t child : node.children) {
+            const auto &childNode = supernodes[child];
+            const size_t skip = childNode.last - childNode.first;
+            const size_t size = childNode.rows.size() - skip;
+            map.resize(size);
+            for (size_t a = 0, position = 0; a < size; a++) {
+                while (rows[position] != childNode.rows[skip + a]) {
+                    position++;
+                }
+                map[a] = position;
+            }
+            const auto &U = updates[child];
+            for (size_t a = 0; a < size; a++) {
+                T *target = F.data() + map[a] * height;
+                const T *source = U.data() + a * size;
+                for (size_t b = 0; b < size; b++) {
+                    target[map[b]] += source[b];
+                }
+            }
+            std::vector<T>().swap(updates[child]);
+        }
+
+        // the supernode's own columns: F11 = L11 * L11^T and L21 = F21 * L11^-T, left-looking by column
+        for (size_t j = 0; j < width; j++) {
+            T *pivotRow = F.data() + j * height;
+            T pivot = pivotRow[j];
+            for (size_t p = 0; p < j; p++) {
+                pivot -= pivotRow[p] * pivotRow[p];
+            }
+            if (!(pivot > static_cast<T>(0))) {
+                return false;
+            }
+            pivot = std::sqrt(pivot);
+            pivotRow[j] = pivot;
+            for (size_t i = j + 1; i < height; i++) {
+                T *row = F.data() + i * height;
+                T sum = row[j];
+                for (size_t p = 0; p < j; p++) {
+                    sum -= row[p] * pivotRow[p];
+                }
+                row[j] = sum / pivot;
+            }
+        }
+
+        // the update matrix F22 - L21 * L21^T, for the parent
+        const size_t below = height - width;
+        if (below > 0) {
+            std::vector<T> transposed(width * below);
+            for (size_t a = 0; a < below; a++) {
+                for (size_t p = 0; p < width; p++) {
+                    transposed[p * below + a] = F[(width + a) * height + p];
+                }
+            }
+            MyBLAS::gemm(below, below, width, static_cast<T>(-1), F.data() + width * height, height, transposed.data(),
+                         below, static_cast<T>(1), F.data() + width * height + width, height);
+            auto &U = updates[s];
+            U.resize(below * below);
+            for (size_t a = 0; a < below; a++) {
+                std::copy_n(F.data() + (width + a) * height + width, below, U.data() + a * below);
+            }
+        }
+
+        node.values.resize(height * width);
+        for (size_t i = 0; i < height; i++) {
+            std::copy_n(F.data() + i * height, width, node.values.data() + i * width);
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Solves A * x = b with the supernodal sparse Cholesky factorization, ordered by graph nested dissection.
+ * @param A The symmetric positive definite sparse, dense or stencil matrix.
+ * @param b The right hand side.
+ * @return A Solution object containing the solution vector, unconverged if A is not positive definite.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applySparseCholesky(const MatrixType<T> &A, const VectorType<T> &b) {
+    const SparseCholesky<T> factor(A);
+    MyBLAS::Solver::Solution<T> results(b.size());
+    results.method = METHOD_SPARSE_CHOLESKY;
+    if (factor.isFactorized()) {
+        results.x = b;
+        factor.solveInPlace(results.x);
+        results.converged = true;
+    }
+    return results;
+}
+
+/**
+ * @brief Solves A * x = b on an m x n mesh with the supernodal sparse Cholesky factorization, ordered by geometric
+ * nested dissection.
+ * @param A The symmetric positive definite matrix of the mesh, with node (i, j) at index i * n + j.
+ * @param b The right hand side.
+ * @param meshRows The number of mesh rows m.
+ * @param meshColumns The number of mesh columns n.
+ * @return A Solution object containing the solution vector, unconverged if A is not positive definite.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applySparseCholesky(const MatrixType<T> &A, const VectorType<T> &b, const size_t meshRows,
+                                                const size_t meshColumns) {
+    const SparseCholesky<T> factor(A, meshRows, meshColumns);
+    MyBLAS::Solver::Solution<T> results(b.size());
+    results.method = METHOD_SPARSE_CHOLESKY;
+    if (factor.isFactorized()) {
+        results.x = b;
+        factor.solveInPlace(results.x);
+        results.converged = true;
+    }
+    return results;
+}
+
+} // namespace MyFactorizationMethod
+
+#endif // NE591_008_SPARSECHOLESKY_H
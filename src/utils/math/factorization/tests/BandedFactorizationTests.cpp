@@ -0,0 +1,192 @@
+/**
+* @file BandedFactorizationTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the band matrix storage, and the banded LU and Cholesky factorizations.
+ */
+
+#include "math/blas/matrix/BandMatrix.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/BandedFactorization.h"
+#include "math/factorization/LUP.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyFactorizationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(BandedFactorizationTests, NumericTypes);
+
+template <typename T>
+class BandedFactorizationTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief The shifted five-point Laplacian in sparse storage, whose bandwidth is the number of mesh columns.
+     */
+    static MyBLAS::SparseMatrix<T> laplacian(const size_t rows, const size_t cols) {
+        return MyBLAS::SparseMatrix<T>(TestProblems::makeLaplacian<T>(rows, cols, static_cast<T>(4.1)));
+    }
+
+    /**
+     * @brief A non-symmetric band matrix with lower bandwidth 3 and upper bandwidth 2, whose small diagonal forces
+     * partial pivoting to interchange rows.
+     */
+    static MyBLAS::Matrix<T> unsymmetric(const size_t n) {
+        return MyBLAS::Matrix<T>(n, n, [](size_t i, size_t j) -> T {
+            if (i == j) {
+                return static_cast<T>(0.01) * static_cast<T>(1 + i % 3);
+            }
+            if (i > j && i - j <= 3) {
+                return static_cast<T>(1 + (i + 2 * j) % 5);
+            }
+            if (j > i && j - i <= 2) {
+                return static_cast<T>(-1) - static_cast<T>((3 * i + j) % 4) / 2;
+            }
+            return 0;
+        });
+    }
+
+    static MyBLAS::Vector<T> makeVector(const size_t size) { return TestProblems::makeSources<T>(size, 7, 3); }
+
+    static T relativeResidual(const MyBLAS::Matrix<T> &A, const MyBLAS::Vector<T> &x, const MyBLAS::Vector<T> &b) {
+        const auto r = b - A * x;
+        return std::sqrt(r * r) / std::sqrt(b * b);
+    }
+};
+
+// The band keeps every entry of the matrix, and nothing outside of it
+TYPED_TEST(BandedFactorizationTests, StorageTest) {
+    const size_t rows = 4, cols = 5;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const auto [lower, upper] = MyBLAS::bandwidths(A);
+    EXPECT_EQ(lower, cols);
+    EXPECT_EQ(upper, cols);
+
+    const MyBLAS::BandMatrix<TypeParam> band(A);
+    EXPECT_EQ(band.getLowerBandwidth(), cols);
+    EXPECT_EQ(band.getUpperBandwidth(), cols);
+    EXPECT_EQ(band.getValues().size(), rows * cols * (2 * cols + 1));
+    for (size_t i = 0; i < A.getRows(); i++) {
+        for (size_t j = 0; j < A.getCols(); j++) {
+            EXPECT_EQ(band(i, j), A(i, j));
+        }
+    }
+
+    const auto x = TestFixture::makeVector(A.getRows());
+    const auto expected = A * x;
+    const auto product = band * x;
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_LE(std::abs(product[i] - expected[i]), 10 * std::numeric_limits<TypeParam>::epsilon());
+    }
+
+    const auto dense = TestFixture::unsymmetric(9);
+    const MyBLAS::BandMatrix<TypeParam> fromDense(dense);
+    EXPECT_EQ(fromDense.getLowerBandwidth(), size_t(3));
+    EXPECT_EQ(fromDense.getUpperBandwidth(), size_t(2));
+    EXPECT_EQ(fromDense(8, 5), dense[8][5]);
+    EXPECT_EQ(fromDense(0, 8), 0);
+}
+
+// On a matrix that needs row interchanges, the banded and dense LUP give the same solution
+TYPED_TEST(BandedFactorizationTests, LUPivotingTest) {
+    const size_t n = 40;
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    const auto A = TestFixture::unsymmetric(n);
+    const auto b = TestFixture::makeVector(n);
+
+    const BandedLU<TypeParam> factors(A);
+    EXPECT_TRUE(factors.isNonsingular());
+    EXPECT_EQ(factors.getFactors().getUpperBandwidth(), size_t(5));
+    size_t interchanges = 0;
+    for (size_t k = 0; k < n; k++) {
+        EXPECT_GE(factors.getPivots()[k], k);
+        EXPECT_LE(factors.getPivots()[k], k + 3);
+        interchanges += (factors.getPivots()[k] != k);
+    }
+    EXPECT_GT(interchanges, size_t(0));
+
+    const auto banded = applyBandedLUP(A, b);
+    EXPECT_TRUE(banded.converged);
+    EXPECT_LE(TestFixture::relativeResidual(A, banded.x, b), tolerance);
+
+    const auto dense = MyBLAS::LUP::applyLUP(A, b);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(banded.x[i] - dense.x[i]), tolerance * (1 + std::abs(dense.x[i])));
+    }
+}
+
+// The banded LU and Cholesky factorizations both solve the diffusion system, and can be reused for new sources
+TYPED_TEST(BandedFactorizationTests, DiffusionTest) {
+    const TypeParam tolerance = 100 * std::numeric_limits<TypeParam>::epsilon();
+    const auto A = TestFixture::laplacian(7, 6);
+    const MyBLAS::Matrix<TypeParam> dense(A.getRows(), A.getCols(), [&A](size_t i, size_t j) { return A(i, j); });
+    const BandedLU<TypeParam> lu(A);
+    const BandedCholesky<TypeParam> cholesky(A);
+    ASSERT_TRUE(lu.isNonsingular());
+    ASSERT_TRUE(cholesky.isFactorized());
+    EXPECT_EQ(cholesky.getFactor().getLowerBandwidth(), size_t(0));
+    EXPECT_EQ(cholesky.getFactor().getUpperBandwidth(), size_t(6));
+
+    for (size_t shift = 0; shift < 3; shift++) {
+        const auto b = MyBLAS::Vector<TypeParam>(A.getRows(), [shift](size_t i) {
+            return static_cast<TypeParam>((i + shift) % 4) - static_cast<TypeParam>(1.5);
+        });
+        auto x = b;
+        lu.solveInPlace(x);
+        EXPECT_LE(TestFixture::relativeResidual(dense, x, b), tolerance);
+        x = b;
+        cholesky.solveInPlace(x);
+        EXPECT_LE(TestFixture::relativeResidual(dense, x, b), tolerance);
+    }
+
+    const auto b = TestFixture::makeVector(A.getRows());
+    const auto solution = applyBandedCholesky(A, b);
+    EXPECT_TRUE(solution.converged);
+    EXPECT_EQ(solution.method, MyBLAS::Solver::Type(METHOD_CHOLESKY));
+    EXPECT_LE(TestFixture::relativeResidual(dense, solution.x, b), tolerance);
+}
+
+// Bands wide enough to spread each elimination step over the threads give the same residuals
+TYPED_TEST(BandedFactorizationTests, WideBandTest) {
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    const auto A = TestFixture::laplacian(8, 96);
+    const MyBLAS::Matrix<TypeParam> dense(A.getRows(), A.getCols(), [&A](size_t i, size_t j) { return A(i, j); });
+    const auto b = TestFixture::makeVector(A.getRows());
+
+    const auto lu = applyBandedLUP(A, b);
+    EXPECT_TRUE(lu.converged);
+    EXPECT_LE(TestFixture::relativeResidual(dense, lu.x, b), tolerance);
+
+    const auto cholesky = applyBandedCholesky(A, b);
+    EXPECT_TRUE(cholesky.converged);
+    EXPECT_LE(TestFixture::relativeResidual(dense, cholesky.x, b), tolerance);
+}
+
+// A matrix that is not positive definite is rejected by Cholesky, and a singular one is reported by LU
+TYPED_TEST(BandedFactorizationTests, BreakdownTest) {
+    const auto indefinite = MyBLAS::Matrix<TypeParam>(6, 6, [](size_t i, size_t j) -> TypeParam {
+        if (i == j) {
+            return (i == 3) ? -1 : 2;
+        }
+        return (i == j + 1 || j == i + 1) ? static_cast<TypeParam>(0.5) : 0;
+    });
+    const BandedCholesky<TypeParam> cholesky(indefinite);
+    EXPECT_FALSE(cholesky.isFactorized());
+    EXPECT_FALSE(applyBandedCholesky(indefinite, TestFixture::makeVector(6)).converged);
+
+    const auto singular = MyBLAS::Matrix<TypeParam>(5, 5, [](size_t i, size_t j) -> TypeParam {
+        return (i == j && i != 2) ? 1 : 0;
+    });
+    const BandedLU<TypeParam> lu(singular);
+    EXPECT_FALSE(lu.isNonsingular());
+}
+
+} // namespace MyFactorizationMethod
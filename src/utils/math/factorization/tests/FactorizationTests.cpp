@@ -0,0 +1,145 @@
+/**
+* @file FactorizationTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the reusable MyFactorizationMethod::Factorization handle.
+ */
+
+#include "math/Random.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/Factorization.h"
+#include "math/relaxation/PowerIteration.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyFactorizationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(FactorizationTests, NumericTypes);
+
+template <typename T>
+class FactorizationTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief A diagonally dominant, non-symmetric random matrix, so that both the pivoted and unpivoted factors exist.
+     */
+    static MyBLAS::Matrix<T> dominant(const size_t n, const size_t seed) {
+        auto A = Random::generate_matrix<T>(n, n, -1, 1, seed);
+        for (size_t i = 0; i < n; i++) {
+            A[i][i] += static_cast<T>(n);
+        }
+        return A;
+    }
+
+    /**
+     * @brief The symmetric tridiagonal matrix with 2 on the diagonal and -1 off it, whose eigenvalues are known.
+     */
+    static MyBLAS::Matrix<T> laplacian(const size_t n) {
+        return MyBLAS::Matrix<T>(n, n, [](size_t i, size_t j) -> T {
+            if (i == j) {
+                return 2;
+            }
+            return (i == j + 1 || j == i + 1) ? -1 : 0;
+        });
+    }
+};
+
+// Test that one factorization solves against several right hand sides, with and without pivoting
+TYPED_TEST(FactorizationTests, SolveManyRightHandSidesTest) {
+    const size_t n = 40;
+    const auto A = TestFixture::dominant(n, 3);
+    const TypeParam tolerance = 100 * std::numeric_limits<TypeParam>::epsilon();
+
+    for (const Type method : {METHOD_LU, METHOD_LUP}) {
+        const Factorization<TypeParam> factorization(A, method);
+        EXPECT_TRUE(factorization.isFactorized());
+        EXPECT_TRUE(factorization.isNonsingular());
+        EXPECT_EQ(factorization.getMethod(), method);
+        EXPECT_EQ(factorization.size(), n);
+
+        for (size_t rhs = 0; rhs < 3; rhs++) {
+            const auto expected = Random::generate_vector<TypeParam>(n, -1, 1, 10 + rhs);
+            const MyBLAS::Vector<TypeParam> b = A * expected;
+            const auto x = factorization.solve(b);
+            MyBLAS::Vector<TypeParam> inPlace = b;
+            factorization.solveInPlace(inPlace);
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_LE(std::abs(x[i] - expected[i]), tolerance);
+                EXPECT_EQ(inPlace[i], x[i]);
+            }
+        }
+    }
+}
+
+// Test that METHOD_LU leaves the rows in place, and that refactorizing replaces the held factors
+TYPED_TEST(FactorizationTests, RefactorizeTest) {
+    const size_t n = 12;
+    Factorization<TypeParam> factorization;
+    EXPECT_FALSE(factorization.isFactorized());
+
+    EXPECT_TRUE(factorization.factorize(TestFixture::dominant(n, 5), METHOD_LU));
+    for (size_t k = 0; k < n; k++) {
+        EXPECT_EQ(factorization.getPivots()[k], k);
+    }
+
+    const MyBLAS::Matrix<TypeParam> singular(n, n, 1);
+    EXPECT_FALSE(factorization.factorize(singular));
+    EXPECT_FALSE(factorization.isNonsingular());
+
+    const auto A = TestFixture::laplacian(n);
+    EXPECT_TRUE(factorization.factorize(A));
+    const MyBLAS::Vector<TypeParam> ones(n, 1);
+    const auto x = factorization.solve(A * ones);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(x[i] - 1), 1000 * std::numeric_limits<TypeParam>::epsilon());
+    }
+}
+
+// Test that inverse power iteration finds the eigenvalue nearest the shift, with a fixed shift and with shift updates
+TYPED_TEST(FactorizationTests, InversePowerIterationTest) {
+    const size_t n = 10;
+    const auto pi = std::acos(static_cast<TypeParam>(-1));
+    const auto eigenvalue = [&](const size_t k) {
+        return 2 - 2 * std::cos(static_cast<TypeParam>(k) * pi / static_cast<TypeParam>(n + 1));
+    };
+
+    MyBLAS::Solver::Parameters<TypeParam> params;
+    params.setSize(n).setMaxIterations(500).setConvergenceThreshold(std::numeric_limits<TypeParam>::epsilon() * 10);
+    params.setCoefficients(TestFixture::laplacian(n)).setEigenvalue(0);
+
+    const auto fixed = MyRelaxationMethod::applyInversePowerIteration<MyBLAS::Matrix, MyBLAS::Vector, TypeParam>(params);
+    EXPECT_TRUE(fixed.converged);
+    EXPECT_GT(fixed.iterations, 1);
+    EXPECT_LE(std::abs(fixed.eigenvalue - eigenvalue(1)), std::sqrt(std::numeric_limits<TypeParam>::epsilon()));
+
+    params.setEigenvalue(static_cast<TypeParam>(0.95) * eigenvalue(3));
+    const auto updated = MyRelaxationMethod::applyInversePowerIteration<MyBLAS::Matrix, MyBLAS::Vector, TypeParam>(params, 2);
+    EXPECT_TRUE(updated.converged);
+    EXPECT_LE(std::abs(updated.eigenvalue - eigenvalue(3)), std::sqrt(std::numeric_limits<TypeParam>::epsilon()));
+}
+
+// Test that a shift that is exactly an eigenvalue is perturbed, instead of dividing by the zero pivot it leaves
+TYPED_TEST(FactorizationTests, SingularShiftTest) {
+    const size_t n = 5;
+    const MyBLAS::Matrix<TypeParam> A(n, n, [](size_t i, size_t j) -> TypeParam {
+        return (i == j) ? static_cast<TypeParam>(i + 1) : 0;
+    });
+
+    MyBLAS::Solver::Parameters<TypeParam> params;
+    params.setSize(n).setMaxIterations(100).setConvergenceThreshold(std::numeric_limits<TypeParam>::epsilon() * 10);
+    params.setCoefficients(A).setEigenvalue(2);
+
+    const auto solution = MyRelaxationMethod::applyInversePowerIteration<MyBLAS::Matrix, MyBLAS::Vector, TypeParam>(params);
+    EXPECT_TRUE(solution.converged);
+    EXPECT_LE(std::abs(solution.eigenvalue - 2), std::sqrt(std::numeric_limits<TypeParam>::epsilon()));
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_TRUE(std::isfinite(solution.x[i]));
+    }
+}
+
+} // namespace MyFactorizationMethod
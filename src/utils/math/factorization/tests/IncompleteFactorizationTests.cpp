@@ -0,0 +1,231 @@
+/**
+* @file IncompleteFactorizationTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the ILU(0) and IC(0) factorizations, their modified variants, and their level scheduled solves.
+ */
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/IncompleteFactorization.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyFactorizationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(IncompleteFactorizationTests, NumericTypes);
+
+template <typename T>
+class IncompleteFactorizationTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief The unshifted five-point Laplacian in sparse storage, an M-matrix on which IC(0) drops fill-in.
+     */
+    static MyBLAS::SparseMatrix<T> laplacian(const size_t rows, const size_t cols) {
+        return MyBLAS::SparseMatrix<T>(TestProblems::makeLaplacian<T>(rows, cols));
+    }
+
+    /**
+     * @brief A non-symmetric tridiagonal matrix, which has no fill-in, so that ILU(0) is its exact LU factorization.
+     */
+    static MyBLAS::SparseMatrix<T> tridiagonal(const size_t n) {
+        return MyBLAS::SparseMatrix<T>(MyBLAS::Matrix<T>(n, n, [](size_t i, size_t j) -> T {
+            if (i == j) {
+                return 3;
+            }
+            if (i == j + 1) {
+                return -1;
+            }
+            return (j == i + 1) ? static_cast<T>(-0.5) : 0;
+        }));
+    }
+
+    static MyBLAS::Vector<T> makeVector(const size_t size) { return TestProblems::makeSources<T>(size, 7, 3); }
+};
+
+// Without fill-in, ILU(0) and IC(0) are complete factorizations, and applying them solves the system
+TYPED_TEST(IncompleteFactorizationTests, ExactWithoutFillInTest) {
+    const size_t n = 50;
+    const TypeParam tolerance = 100 * std::numeric_limits<TypeParam>::epsilon();
+    const auto b = TestFixture::makeVector(n);
+
+    const auto A = TestFixture::tridiagonal(n);
+    const IncompleteLU<TypeParam> ilu(A);
+    EXPECT_TRUE(ilu.isFactorized());
+    MyBLAS::Vector<TypeParam> x(n, 0);
+    ilu.apply(b, x);
+    const auto r = b - A.apply(x);
+    EXPECT_LE(std::sqrt(r * r), tolerance * std::sqrt(b * b));
+
+    const auto S = TestFixture::laplacian(1, n);
+    const IncompleteCholesky<TypeParam> ic(S);
+    EXPECT_TRUE(ic.isFactorized());
+    ic.apply(b, x);
+    const auto s = b - S.apply(x);
+    EXPECT_LE(std::sqrt(s * s), tolerance * std::sqrt(b * b));
+}
+
+// The factors keep the pattern of A, and on a mesh the levels are its anti-diagonals
+TYPED_TEST(IncompleteFactorizationTests, PatternAndLevelsTest) {
+    const size_t rows = 9, cols = 6;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const size_t offDiagonal = A.getNonZeros() - rows * cols;
+
+    const IncompleteLU<TypeParam> ilu(A);
+    EXPECT_EQ(ilu.getL().getNonZeros() + ilu.getU().getNonZeros(), offDiagonal);
+    EXPECT_EQ(ilu.getL().getLevels(), rows + cols - 1);
+    EXPECT_EQ(ilu.getU().getLevels(), rows + cols - 1);
+
+    const IncompleteCholesky<TypeParam> ic(A);
+    EXPECT_EQ(ic.getL().getNonZeros(), offDiagonal / 2);
+    EXPECT_EQ(ic.getL().getLevels(), rows + cols - 1);
+}
+
+// On a symmetric M-matrix, IC(0) and ILU(0) are the same preconditioner, with U = D * L^T
+TYPED_TEST(IncompleteFactorizationTests, CholeskyMatchesLUTest) {
+    const size_t rows = 12, cols = 7;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const auto r = TestFixture::makeVector(rows * cols);
+    const IncompleteLU<TypeParam> ilu(A);
+    const IncompleteCholesky<TypeParam> ic(A);
+
+    MyBLAS::Vector<TypeParam> zLU(r.size(), 0), zIC(r.size(), 0);
+    ilu.apply(r, zLU);
+    ic.apply(r, zIC);
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < r.size(); i++) {
+        EXPECT_LE(std::abs(zLU[i] - zIC[i]), tolerance * std::abs(zLU[i]));
+    }
+
+    // and the preconditioner is positive definite, as conjugate gradient needs
+    EXPECT_GT(r * zIC, 0);
+}
+
+// When IC(0) breaks down on a negative pivot, the replaced pivot is eliminated with, so the preconditioner stays SPD
+TYPED_TEST(IncompleteFactorizationTests, BreakdownStaysSymmetricTest) {
+    const size_t n = 30;
+    const auto A = MyBLAS::SparseMatrix<TypeParam>(MyBLAS::Matrix<TypeParam>(n, n, [](size_t i, size_t j) -> TypeParam {
+        if (i == j) {
+            return (i == 17) ? -1 : 2;
+        }
+        return (i == j + 1 || j == i + 1) ? static_cast<TypeParam>(0.5) : 0;
+    }));
+    IncompleteCholesky<TypeParam> ic;
+    EXPECT_FALSE(ic.factorize(A));
+    ASSERT_TRUE(ic.isFactorized());
+    EXPECT_GE(ic.getReplacedPivots(), 1);
+
+    const auto u = TestFixture::makeVector(n);
+    const MyBLAS::Vector<TypeParam> v(n, [](size_t i) { return static_cast<TypeParam>((i * 5) % 11) - 4; });
+    MyBLAS::Vector<TypeParam> zu(n, 0), zv(n, 0);
+    ic.apply(u, zu);
+    ic.apply(v, zv);
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    EXPECT_LE(std::abs(u * zv - v * zu), tolerance * std::sqrt(u * u) * std::sqrt(zv * zv));
+    EXPECT_GT(u * zu, 0);
+    EXPECT_GT(v * zv, 0);
+}
+
+// A zero pivot whose diagonal entry is a stored zero is replaced by the absolute row sum, so the factors stay finite
+TYPED_TEST(IncompleteFactorizationTests, ZeroDiagonalPivotTest) {
+    // [0 1 0; 1 2 1; 0 1 2], with the zero diagonal entry stored explicitly
+    const MyBLAS::SparseMatrix<TypeParam> A(3, 3, {0, 2, 5, 7}, {0, 1, 0, 1, 2, 1, 2}, {0, 1, 1, 2, 1, 1, 2});
+    IncompleteLU<TypeParam> ilu;
+    EXPECT_FALSE(ilu.factorize(A));
+    ASSERT_TRUE(ilu.isFactorized());
+    EXPECT_EQ(ilu.getReplacedPivots(), 1);
+
+    const auto r = TestFixture::makeVector(3);
+    MyBLAS::Vector<TypeParam> z(3, 0);
+    ilu.apply(r, z);
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(std::isfinite(z[i]));
+    }
+
+    IncompleteLU<TypeParam> exact(TestFixture::tridiagonal(10));
+    EXPECT_EQ(exact.getReplacedPivots(), 0);
+}
+
+// With omega = 1 the dropped fill-in is kept on the diagonal, so L * U has the row sums of A, and maps ones to A * ones
+TYPED_TEST(IncompleteFactorizationTests, ModifiedKeepsRowSumsTest) {
+    const size_t rows = 10, cols = 9, n = rows * cols;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const MyBLAS::Vector<TypeParam> ones(n, 1);
+    const auto rowSums = A.apply(ones);
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+
+    MyBLAS::Vector<TypeParam> z(n, 0);
+    const IncompleteLU<TypeParam> milu(A, 1);
+    milu.apply(rowSums, z);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(z[i] - 1), tolerance);
+    }
+
+    const IncompleteCholesky<TypeParam> mic(A, 1);
+    mic.apply(rowSums, z);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(z[i] - 1), tolerance);
+    }
+
+    // while the unmodified factors do not
+    const IncompleteCholesky<TypeParam> ic(A);
+    ic.apply(rowSums, z);
+    EXPECT_GT(std::abs(z[n / 2 + cols / 2] - 1), tolerance);
+}
+
+// The level scheduled solve visits the rows in a different order from a plain substitution, with the same result
+TYPED_TEST(IncompleteFactorizationTests, LevelScheduleMatchesSubstitutionTest) {
+    const size_t rows = 8, cols = 5, n = rows * cols;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const IncompleteCholesky<TypeParam> ic(A);
+    const auto b = TestFixture::makeVector(n);
+
+    // L * y = b by forward substitution, with L rebuilt from the lower triangle of A using the IC(0) recurrence
+    MyBLAS::Matrix<TypeParam> L(n, n, 0);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t k = 0; k <= i; k++) {
+            if (A(i, k) == 0) {
+                continue;
+            }
+            TypeParam sum = A(i, k);
+            for (size_t j = 0; j < k; j++) {
+                sum -= L[i][j] * L[k][j];
+            }
+            L[i][k] = (i == k) ? std::sqrt(sum) : sum / L[k][k];
+        }
+    }
+    MyBLAS::Vector<TypeParam> y(n, 0);
+    for (size_t i = 0; i < n; i++) {
+        TypeParam sum = b[i];
+        for (size_t j = 0; j < i; j++) {
+            sum -= L[i][j] * y[j];
+        }
+        y[i] = sum / L[i][i];
+    }
+    MyBLAS::Vector<TypeParam> x(n, 0);
+    for (size_t step = 0; step < n; step++) {
+        const size_t i = n - 1 - step;
+        TypeParam sum = y[i];
+        for (size_t j = i + 1; j < n; j++) {
+            sum -= L[j][i] * x[j];
+        }
+        x[i] = sum / L[i][i];
+    }
+
+    MyBLAS::Vector<TypeParam> z(n, 0);
+    ic.apply(b, z);
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(z[i] - x[i]), tolerance * std::abs(x[i]));
+    }
+}
+
+} // namespace MyFactorizationMethod
@@ -0,0 +1,133 @@
+/**
+* @file IterativeRefinementTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the mixed precision LUP and conjugate gradient solvers, which solve in float
+* and refine to the working precision.
+ */
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/solver/IterativeRefinement.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyBLAS::Solver {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(IterativeRefinementTests, NumericTypes);
+
+template <typename T>
+class IterativeRefinementTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief A non-symmetric, diagonally dominant matrix, which is well conditioned in float.
+     */
+    static MyBLAS::Matrix<T> makeMatrix(const size_t n) {
+        return MyBLAS::Matrix<T>(n, n, [n](size_t i, size_t j) -> T {
+            if (i == j) {
+                return static_cast<T>(n);
+            }
+            return static_cast<T>(1) / static_cast<T>(1 + (3 * i + 7 * j) % 11);
+        });
+    }
+
+    static MyBLAS::Vector<T> makeVector(const size_t size) { return TestProblems::makeSources<T>(size, 7, 3); }
+
+    /**
+     * @brief A residual threshold a few rounding errors above what the working precision can reach.
+     */
+    static T threshold(const MyBLAS::Vector<T> &b) {
+        return 1000 * std::numeric_limits<T>::epsilon() * std::sqrt(b * b);
+    }
+
+    static T residualNorm(const MyBLAS::Matrix<T> &A, const MyBLAS::Vector<T> &b, const MyBLAS::Vector<T> &x) {
+        const auto r = b - A * x;
+        return std::sqrt(r * r);
+    }
+};
+
+// LU factors in float, refined in T, reach the same solution as LUP in T
+TYPED_TEST(IterativeRefinementTests, MixedPrecisionLUPMatchesLUPTest) {
+    const size_t n = 60;
+    const auto A = TestFixture::makeMatrix(n);
+    const auto b = TestFixture::makeVector(n);
+    const TypeParam threshold = TestFixture::threshold(b);
+
+    const auto expected = MyBLAS::LUP::applyLUP(A, b);
+    const auto mixed = applyMixedPrecisionLUP<float>(A, b, 20, threshold);
+    EXPECT_TRUE(mixed.converged);
+    EXPECT_EQ(mixed.method, Type(MyFactorizationMethod::METHOD_LUP));
+    EXPECT_GE(mixed.refinements, 1);
+    EXPECT_EQ(mixed.iterations, mixed.refinements);
+    EXPECT_LE(TestFixture::residualNorm(A, b, mixed.x), threshold);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(mixed.x[i] - expected.x[i]), threshold);
+    }
+}
+
+// Refinement recovers the digits that a plain float solve loses
+TYPED_TEST(IterativeRefinementTests, RefinementBeatsLowPrecisionTest) {
+    if constexpr (sizeof(TypeParam) > sizeof(float)) {
+        const size_t n = 60;
+        const auto A = TestFixture::makeMatrix(n);
+        const auto b = TestFixture::makeVector(n);
+
+        const auto single = MyBLAS::LUP::applyLUP(MyBLAS::Matrix<float>(A), MyBLAS::Vector<float>(b));
+        const auto mixed = applyMixedPrecisionLUP<float>(A, b, 20, TestFixture::threshold(b));
+        EXPECT_GT(mixed.refinements, 1);
+        EXPECT_LT(1000 * TestFixture::residualNorm(A, b, mixed.x),
+                  TestFixture::residualNorm(A, b, MyBLAS::Vector<TypeParam>(single.x)));
+    }
+}
+
+// On a matrix too ill-conditioned for float, refinement stops without making the solution worse
+TYPED_TEST(IterativeRefinementTests, StagnationStopsRefinementTest) {
+    if constexpr (sizeof(TypeParam) > sizeof(float)) {
+        const size_t n = 12;
+        const MyBLAS::Matrix<TypeParam> hilbert(n, n, [](size_t i, size_t j) -> TypeParam {
+            return static_cast<TypeParam>(1) / static_cast<TypeParam>(i + j + 1);
+        });
+        const auto b = TestFixture::makeVector(n);
+
+        const auto mixed = applyMixedPrecisionLUP<float>(hilbert, b, 50, TestFixture::threshold(b));
+        EXPECT_FALSE(mixed.converged);
+        EXPECT_LT(mixed.refinements, 50);
+        EXPECT_LE(TestFixture::residualNorm(hilbert, b, mixed.x), std::sqrt(b * b));
+        EXPECT_LE(std::abs(mixed.iterative_error - TestFixture::residualNorm(hilbert, b, mixed.x)),
+                  std::sqrt(std::numeric_limits<TypeParam>::epsilon()) * mixed.iterative_error);
+    }
+}
+
+// Conjugate gradient in float on the diffusion stencil, refined in T, converges to the threshold of T
+TYPED_TEST(IterativeRefinementTests, MixedPrecisionConjugateGradientTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(30, 25);
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(params);
+    const MyPhysics::Diffusion::Matrix<float> ALow{MyPhysics::Diffusion::Params<float>(params)};
+    const auto b = TestFixture::makeVector(A.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto cg = MyRelaxationMethod::applyConjugateGradient(A, b, 2000, threshold);
+    const auto mixed = applyMixedPrecisionConjugateGradient<float>(A, ALow, b, 2000, threshold);
+    EXPECT_TRUE(mixed.converged);
+    EXPECT_EQ(mixed.method, Type(MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT));
+    EXPECT_GE(mixed.refinements, 1);
+    EXPECT_LE(mixed.iterations, 2 * cg.iterations);
+
+    const auto r = b - A * mixed.x;
+    EXPECT_LE(std::sqrt(r * r), threshold);
+    for (size_t i = 0; i < b.size(); i++) {
+        EXPECT_LE(std::abs(mixed.x[i] - cg.x[i]), 2 * threshold);
+    }
+}
+
+} // namespace MyBLAS::Solver
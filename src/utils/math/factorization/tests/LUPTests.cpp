@@ -0,0 +1,160 @@
+/**
+* @file LUPTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the blocked, in-place LU factorization with partial pivoting.
+ */
+
+#include "math/Random.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace MyBLAS {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(LUPTests, NumericTypes);
+
+template <typename T>
+class LUPTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief Checks that the packed factors and pivots reproduce P * A = L * U, to a tolerance relative to max |A|.
+     */
+    static void expectFactors(const Matrix<T> &A, const Matrix<T> &LU, const std::vector<size_t> &pivots) {
+        const size_t n = A.getRows();
+        ASSERT_EQ(pivots.size(), n);
+        Matrix<T> PA = A;
+        T scale = 0;
+        for (size_t k = 0; k < n; k++) {
+            ASSERT_GE(pivots[k], k);
+            ASSERT_LT(pivots[k], n);
+            PA.swapRows(k, pivots[k]);
+            for (size_t j = 0; j < n; j++) {
+                scale = std::max(scale, std::abs(A[k][j]));
+            }
+        }
+        const T tolerance = 4 * static_cast<T>(n) * std::numeric_limits<T>::epsilon() * scale * static_cast<T>(n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                T sum = 0;
+                for (size_t p = 0; p <= std::min(i, j); p++) {
+                    const T l = (p == i) ? static_cast<T>(1) : LU[i][p];
+                    sum += l * LU[p][j];
+                }
+                EXPECT_LE(std::abs(sum - PA[i][j]), tolerance) << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+};
+
+// Test the packed factors over sizes that leave partial panels and partial trailing tiles
+TYPED_TEST(LUPTests, FactorizeInPlaceTest) {
+    size_t seed = 5;
+    for (const size_t n : {1, 2, 7, 16, 33, 70}) {
+        for (const size_t blockSize : {1, 4, 16, 64}) {
+            const auto A = Random::generate_matrix<TypeParam>(n, n, -1, 1, ++seed);
+            Matrix<TypeParam> LU = A;
+            std::vector<size_t> pivots;
+            EXPECT_TRUE(LUP::factorizeInPlace(LU, pivots, blockSize));
+            TestFixture::expectFactors(A, LU, pivots);
+
+            // partial pivoting keeps every multiplier at most one in magnitude
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < i; j++) {
+                    EXPECT_LE(std::abs(LU[i][j]), static_cast<TypeParam>(1));
+                }
+            }
+        }
+    }
+}
+
+// Test that the blocked factorization does not depend on the block size, since it makes the same pivot choices
+TYPED_TEST(LUPTests, BlockSizeIndependenceTest) {
+    const size_t n = 45;
+    const auto A = Random::generate_matrix<TypeParam>(n, n, -1, 1, 17);
+    Matrix<TypeParam> unblocked = A, blocked = A;
+    std::vector<size_t> unblockedPivots, blockedPivots;
+    LUP::factorizeInPlace(unblocked, unblockedPivots, n);
+    LUP::factorizeInPlace(blocked, blockedPivots, 8);
+    EXPECT_EQ(blockedPivots, unblockedPivots);
+    const TypeParam tolerance = 100 * static_cast<TypeParam>(n) * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            EXPECT_LE(std::abs(blocked[i][j] - unblocked[i][j]), tolerance);
+        }
+    }
+}
+
+// Test that a zero leading entry is pivoted around, which the unpivoted factorization cannot do
+TYPED_TEST(LUPTests, ZeroLeadingPivotTest) {
+    const Matrix<TypeParam> A({{0, 2, 1}, {1, 1, 1}, {2, 1, 0}});
+    const Vector<TypeParam> b({3, 3, 3});
+    const auto solution = LUP::applyLUP(A, b);
+    const TypeParam tolerance = 10 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_LE(std::abs(solution.x[i] - static_cast<TypeParam>(1)), tolerance);
+    }
+
+    Matrix<TypeParam> LU = A;
+    std::vector<size_t> pivots;
+    EXPECT_TRUE(LUP::factorizeInPlace(LU, pivots));
+    EXPECT_EQ(pivots, std::vector<size_t>({2, 2, 2}));
+}
+
+// Test that a singular matrix is reported
+TYPED_TEST(LUPTests, SingularMatrixTest) {
+    Matrix<TypeParam> LU({{1, 2, 3}, {2, 4, 6}, {1, 0, 1}});
+    std::vector<size_t> pivots;
+    EXPECT_FALSE(LUP::factorizeInPlace(LU, pivots));
+
+    const auto solution = LUP::applyLUP(Matrix<TypeParam>({{1, 2, 3}, {2, 4, 6}, {1, 0, 1}}), Vector<TypeParam>({1, 2, 3}));
+    EXPECT_FALSE(solution.converged);
+    ASSERT_EQ(solution.x.size(), 3);
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(std::isnan(solution.x[i]));
+    }
+}
+
+// Test the solve against a manufactured solution, and the unpacked L, U and P against the packed factors
+TYPED_TEST(LUPTests, SolveAndUnpackTest) {
+    const size_t n = 50;
+    auto A = Random::generate_matrix<TypeParam>(n, n, -1, 1, 23);
+    for (size_t i = 0; i < n; i++) {
+        A[i][i] += static_cast<TypeParam>(4);
+    }
+    const Vector<TypeParam> expected(n, [](size_t i) { return static_cast<TypeParam>(i % 5) - 2; });
+    const Vector<TypeParam> b = A * expected;
+
+    const auto solution = LUP::applyLUP(A, b);
+    EXPECT_TRUE(solution.converged);
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(solution.x[i] - expected[i]), tolerance);
+    }
+
+    Matrix<TypeParam> L(n, n), U(n, n);
+    const Matrix<TypeParam> P = LUP::factorize(L, U, A);
+    const Matrix<TypeParam> PA = P * A;
+    const Matrix<TypeParam> product = L * U;
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(L[i][i], static_cast<TypeParam>(1));
+        for (size_t j = 0; j < n; j++) {
+            if (j > i) {
+                EXPECT_EQ(L[i][j], static_cast<TypeParam>(0));
+            } else if (j < i) {
+                EXPECT_EQ(U[i][j], static_cast<TypeParam>(0));
+            }
+            EXPECT_LE(std::abs(product[i][j] - PA[i][j]), tolerance);
+        }
+    }
+}
+
+} // namespace MyBLAS
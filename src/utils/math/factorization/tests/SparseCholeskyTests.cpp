@@ -0,0 +1,192 @@
+/**
+* @file SparseCholeskyTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains unit tests for the nested dissection orderings, and the supernodal sparse Cholesky
+* factorization.
+ */
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/system/Circuit.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/NestedDissection.h"
+#include "math/factorization/SparseCholesky.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace MyFactorizationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(SparseCholeskyTests, NumericTypes);
+
+template <typename T>
+class SparseCholeskyTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief The five-point Laplacian, shifted so that it is positive definite on every mesh.
+     */
+    static MyBLAS::Matrix<T> laplacian(const size_t rows, const size_t cols) {
+        return TestProblems::makeLaplacian<T>(rows, cols, static_cast<T>(4.1));
+    }
+
+    /**
+     * @brief A symmetric, diagonally dominant matrix with an irregular sparsity pattern and two disconnected blocks.
+     */
+    static MyBLAS::Matrix<T> irregular(const size_t n) {
+        return MyBLAS::Matrix<T>(n, n, [n](size_t i, size_t j) -> T {
+            if (i == j) {
+                return 8;
+            }
+            if ((i < n / 2) != (j < n / 2)) {
+                return 0;
+            }
+            const size_t a = std::min(i, j), b = std::max(i, j);
+            return ((a * 7 + b * 3) % 11 == 0 || b - a == 1) ? static_cast<T>(-0.75) : 0;
+        });
+    }
+
+    static MyBLAS::Vector<T> makeVector(const size_t size) { return TestProblems::makeSources<T>(size, 7, 3); }
+
+    static T relativeResidual(const MyBLAS::Matrix<T> &A, const MyBLAS::Vector<T> &x, const MyBLAS::Vector<T> &b) {
+        const auto r = b - A * x;
+        return std::sqrt(r * r) / std::sqrt(b * b);
+    }
+
+    static bool isPermutation(const std::vector<size_t> &order, const size_t n) {
+        if (order.size() != n) {
+            return false;
+        }
+        std::vector<bool> seen(n, false);
+        for (const size_t index : order) {
+            if (index >= n || seen[index]) {
+                return false;
+            }
+            seen[index] = true;
+        }
+        return true;
+    }
+};
+
+// Both orderings are permutations, and the geometric one numbers the middle line of the mesh last
+TYPED_TEST(SparseCholeskyTests, OrderingTest) {
+    for (const auto &[rows, cols] : std::vector<std::pair<size_t, size_t>>{{1, 1}, {1, 9}, {7, 3}, {12, 17}}) {
+        const auto order = Ordering::nestedDissection(rows, cols, 4);
+        EXPECT_TRUE(TestFixture::isPermutation(order, rows * cols));
+    }
+    const auto order = Ordering::nestedDissection(9, 5, 4);
+    for (size_t j = 0; j < 5; j++) {
+        EXPECT_EQ(order[order.size() - 5 + j], 4 * 5 + j);
+    }
+
+    const MyBLAS::SparseMatrix<TypeParam> A(TestFixture::laplacian(10, 13));
+    EXPECT_TRUE(TestFixture::isPermutation(Ordering::nestedDissection(A), A.getRows()));
+    const MyBLAS::SparseMatrix<TypeParam> B(TestFixture::irregular(61));
+    EXPECT_TRUE(TestFixture::isPermutation(Ordering::nestedDissection(B, 2), B.getRows()));
+}
+
+// On the mesh, nested dissection fills in less than the band, and the solution matches
+TYPED_TEST(SparseCholeskyTests, MeshTest) {
+    const TypeParam tolerance = 100 * std::numeric_limits<TypeParam>::epsilon();
+    const size_t rows = 24, cols = 20;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const auto b = TestFixture::makeVector(A.getRows());
+
+    const SparseCholesky<TypeParam> geometric(A, rows, cols);
+    ASSERT_TRUE(geometric.isFactorized());
+    EXPECT_TRUE(TestFixture::isPermutation(geometric.getOrder(), A.getRows()));
+    EXPECT_LT(geometric.getSupernodes(), A.getRows());
+    const size_t bandNonZeros = A.getRows() * (cols + 1);
+    EXPECT_LT(geometric.getNonZeros(), bandNonZeros);
+
+    auto x = b;
+    geometric.solveInPlace(x);
+    EXPECT_LE(TestFixture::relativeResidual(A, x, b), tolerance);
+
+    const MyBLAS::SparseMatrix<TypeParam> sparse(A);
+    const SparseCholesky<TypeParam> graph(sparse);
+    ASSERT_TRUE(graph.isFactorized());
+    EXPECT_LT(graph.getNonZeros(), bandNonZeros);
+    x = b;
+    graph.solveInPlace(x);
+    EXPECT_LE(TestFixture::relativeResidual(A, x, b), tolerance);
+
+    const auto solution = applySparseCholesky(A, b, rows, cols);
+    EXPECT_TRUE(solution.converged);
+    EXPECT_EQ(solution.method, MyBLAS::Solver::Type(METHOD_SPARSE_CHOLESKY));
+    EXPECT_LE(TestFixture::relativeResidual(A, solution.x, b), tolerance);
+}
+
+// A large enough mesh to split the elimination tree into parallel tasks, solved for several right hand sides
+TYPED_TEST(SparseCholeskyTests, MultipleSourcesTest) {
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    const size_t rows = 40, cols = 36;
+    const auto A = TestFixture::laplacian(rows, cols);
+    const SparseCholesky<TypeParam> factor(MyBLAS::SparseMatrix<TypeParam>(A), rows, cols);
+    ASSERT_TRUE(factor.isFactorized());
+
+    for (size_t shift = 0; shift < 3; shift++) {
+        const auto b = MyBLAS::Vector<TypeParam>(A.getRows(), [shift](size_t i) {
+            return static_cast<TypeParam>((i + shift) % 4) - static_cast<TypeParam>(1.5);
+        });
+        auto x = b;
+        factor.solveInPlace(x);
+        EXPECT_LE(TestFixture::relativeResidual(A, x, b), tolerance);
+    }
+}
+
+// An irregular, disconnected pattern is ordered on its graph and solved
+TYPED_TEST(SparseCholeskyTests, IrregularTest) {
+    const TypeParam tolerance = 100 * std::numeric_limits<TypeParam>::epsilon();
+    const auto A = TestFixture::irregular(75);
+    const auto b = TestFixture::makeVector(A.getRows());
+    const auto solution = applySparseCholesky(A, b);
+    EXPECT_TRUE(solution.converged);
+    EXPECT_LE(TestFixture::relativeResidual(A, solution.x, b), tolerance);
+}
+
+// The circuit system is ordered on its graph, and its currents are recovered
+TYPED_TEST(SparseCholeskyTests, CircuitTest) {
+    const size_t n = 60;
+    MyBLAS::Matrix<double> circuit;
+    MyBLAS::Vector<double> voltages, currents;
+    MyBLAS::System::Circuit<double>(n, circuit, voltages, currents);
+    const MyBLAS::Matrix<TypeParam> A(n, n, [&circuit](size_t i, size_t j) { return static_cast<TypeParam>(circuit[i][j]); });
+    const MyBLAS::Vector<TypeParam> b(n, [&A, &currents](size_t i) {
+        TypeParam sum = 0;
+        for (size_t j = 0; j < A.getCols(); j++) {
+            sum += A[i][j] * static_cast<TypeParam>(currents[j]);
+        }
+        return sum;
+    });
+
+    const auto solution = applySparseCholesky(A, b);
+    EXPECT_TRUE(solution.converged);
+    EXPECT_LE(TestFixture::relativeResidual(A, solution.x, b), 100 * std::numeric_limits<TypeParam>::epsilon());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(solution.x[i] - static_cast<TypeParam>(currents[i])),
+                  1000 * std::numeric_limits<TypeParam>::epsilon() * (1 + std::abs(static_cast<TypeParam>(currents[i]))));
+    }
+}
+
+// A matrix that is not positive definite is rejected
+TYPED_TEST(SparseCholeskyTests, BreakdownTest) {
+    const auto indefinite = MyBLAS::Matrix<TypeParam>(30, 30, [](size_t i, size_t j) -> TypeParam {
+        if (i == j) {
+            return (i == 17) ? -1 : 2;
+        }
+        return (i == j + 1 || j == i + 1) ? static_cast<TypeParam>(0.5) : 0;
+    });
+    const SparseCholesky<TypeParam> factor(indefinite);
+    EXPECT_FALSE(factor.isFactorized());
+    EXPECT_FALSE(applySparseCholesky(indefinite, TestFixture::makeVector(30)).converged);
+}
+
+} // namespace MyFactorizationMethod
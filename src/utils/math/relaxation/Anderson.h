@@ -0,0 +1,284 @@
+/**
+ * @file Anderson.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains Anderson acceleration for fixed point iterations x = G(x).
+ *
+ * Plain fixed point iteration only uses the latest iterate. Anderson acceleration (type-II) keeps the last m residuals
+ * f = G(x) - x, and picks the combination of the last m steps that best cancels the current residual, in the least
+ * squares sense. The least squares problem is kept as a QR factorization of the residual differences, which is updated
+ * by one Gram-Schmidt column when a step is added, and by Givens rotations when the oldest step is dropped, so each
+ * iteration costs O(n * m) on top of the map itself.
+ */
+
+#ifndef NE591_008_ANDERSON_H
+#define NE591_008_ANDERSON_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "math/blas/Ops.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/RelaxationMethods.h"
+
+namespace MyRelaxationMethod {
+
+/**
+ * @class AndersonAccelerator
+ * @brief Holds the history of an accelerated fixed point iteration, and mixes each new G(x) into the next iterate.
+ * @details With a depth of zero, the mixed iterate is G(x) itself, i.e. plain fixed point iteration, and no history is
+ * allocated.
+ * @tparam T The type of the elements.
+ */
+template <typename T> class AndersonAccelerator {
+
+  public:
+    /**
+     * @param _size The length of the iterates.
+     * @param _depth The number m of previous steps to mix, usually between 3 and 10.
+     * @param _maxCondition The largest condition number of R that is tolerated before the oldest steps are dropped.
+     */
+    AndersonAccelerator(const size_t _size, const size_t _depth,
+                        const T _maxCondition = 1 / std::sqrt(std::numeric_limits<T>::epsilon()))
+        : size(_size), depth(_depth), maxCondition(_maxCondition), R(_depth, std::vector<T>(_depth, 0)),
+          ordered(_depth, nullptr), gamma(_depth, 0), df(_depth ? _size : 0, 0),
+          fPrevious(_depth ? _size : 0, 0), gPrevious(_depth ? _size : 0, 0) {
+        Q.reserve(depth);
+        dG.reserve(depth);
+        for (size_t k = 0; k < depth; k++) {
+            Q.emplace_back(size, 0);
+            dG.emplace_back(size, 0);
+        }
+    }
+
+    [[nodiscard]] size_t getDepth() const { return depth; }
+
+    /**
+     * @brief The number of previous steps currently mixed, at most the depth.
+     */
+    [[nodiscard]] size_t getHistory() const { return history; }
+
+    /**
+     * @brief Forgets all previous steps, e.g. when the map itself changes.
+     */
+    void reset() {
+        history = 0;
+        oldest = 0;
+        primed = false;
+    }
+
+    /**
+     * @brief Computes the next iterate from the current one and its image under the map.
+     *
+     * x_next = G(x) - sum_j gamma_j * (G(x_j+1) - G(x_j)), where gamma minimizes ||f - sum_j gamma_j * (f_j+1 - f_j)||.
+     *
+     * @param x The current iterate.
+     * @param Gx The image of the current iterate, G(x).
+     * @param next The next iterate. It may be the same vector as x or Gx.
+     */
+    template <typename XVector, typename GVector, typename NextVector>
+    void mix(const XVector &x, const GVector &Gx, NextVector &next) {
+        if (depth == 0) {
+            for (size_t i = 0; i < size; i++) {
+                next[i] = Gx[i];
+            }
+            return;
+        }
+
+        // a single pass takes the differences against the previous step, and then replaces it with this one, so
+        // that fPrevious holds f = G(x) - x, and gPrevious holds G(x), from here on
+        if (primed) {
+            if (history == depth) {
+                dropOldest();
+            }
+            auto &dg = dG[slot(history)];
+            for (size_t i = 0; i < size; i++) {
+                const T f = Gx[i] - x[i];
+                df[i] = f - fPrevious[i];
+                dg[i] = Gx[i] - gPrevious[i];
+                fPrevious[i] = f;
+                gPrevious[i] = Gx[i];
+            }
+            append();
+        } else {
+            for (size_t i = 0; i < size; i++) {
+                fPrevious[i] = Gx[i] - x[i];
+                gPrevious[i] = Gx[i];
+            }
+            primed = true;
+        }
+
+        // solve R * gamma = Q^T * f by back substitution
+        std::fill(gamma.begin(), gamma.end(), static_cast<T>(0));
+        for (size_t i = 0; i < size; i++) {
+            for (size_t j = 0; j < history; j++) {
+                gamma[j] += Q[j][i] * fPrevious[i];
+            }
+        }
+        for (size_t j = history; j-- > 0;) {
+            T sum = gamma[j];
+            for (size_t k = j + 1; k < history; k++) {
+                sum -= R[j][k] * gamma[k];
+            }
+            gamma[j] = sum / R[j][j];
+        }
+
+        for (size_t j = 0; j < history; j++) {
+            ordered[j] = &dG[slot(j)];
+        }
+        for (size_t i = 0; i < size; i++) {
+            T value = gPrevious[i];
+            for (size_t j = 0; j < history; j++) {
+                value -= gamma[j] * (*ordered[j])[i];
+            }
+            next[i] = value;
+        }
+    }
+
+  private:
+    size_t size;
+    size_t depth;
+    T maxCondition;
+    size_t history = 0;
+    size_t oldest = 0;
+    bool primed = false;
+
+    std::vector<MyBLAS::Vector<T>> Q;  ///< orthonormal basis of the residual differences, the first history columns
+    std::vector<std::vector<T>> R;    ///< upper triangular, the leading history x history block
+    std::vector<MyBLAS::Vector<T>> dG; ///< the differences of G(x), a ring starting at the oldest
+    std::vector<const MyBLAS::Vector<T> *> ordered; ///< dG, oldest first
+    std::vector<T> gamma;
+
+    MyBLAS::Vector<T> df, fPrevious, gPrevious;
+
+    /**
+     * @brief The position in the ring of the j-th oldest difference of G(x).
+     */
+    [[nodiscard]] size_t slot(const size_t j) const { return (oldest + j) % depth; }
+
+    /**
+     * @brief Adds the column df to the QR factorization. Its difference of G(x) is already in the next ring slot.
+     */
+    void append() {
+        const T dfNorm = std::sqrt(df * df);
+        for (size_t j = 0; j < history; j++) {
+            R[j][history] = Q[j] * df;
+            MyBLAS::axpy(-R[j][history], Q[j], df);
+        }
+        const T norm = std::sqrt(df * df);
+
+        // a step that lies in the span of the previous ones carries no new information
+        if (!(norm > std::numeric_limits<T>::epsilon() * dfNorm)) {
+            return;
+        }
+
+        R[history][history] = norm;
+        for (size_t i = 0; i < size; i++) {
+            Q[history][i] = df[i] / norm;
+        }
+        history++;
+
+        while (history > 1 && condition() > maxCondition) {
+            dropOldest();
+        }
+    }
+
+    /**
+     * @brief Removes the first column of the QR factorization.
+     * @details Without its first column, R is upper Hessenberg. Each subdiagonal entry is zeroed with a Givens rotation
+     * of two rows of R, and the inverse rotation of the same two columns of Q keeps the product unchanged.
+     */
+    void dropOldest() {
+        for (size_t j = 0; j + 1 < history; j++) {
+            const T a = R[j][j + 1];
+            const T b = R[j + 1][j + 1];
+            const T radius = std::hypot(a, b);
+            const T c = a / radius;
+            const T s = b / radius;
+            R[j][j + 1] = radius;
+            R[j + 1][j + 1] = 0;
+            for (size_t k = j + 2; k < history; k++) {
+                const T upper = c * R[j][k] + s * R[j + 1][k];
+                R[j + 1][k] = -s * R[j][k] + c * R[j + 1][k];
+                R[j][k] = upper;
+            }
+            for (size_t i = 0; i < size; i++) {
+                const T left = c * Q[j][i] + s * Q[j + 1][i];
+                Q[j + 1][i] = -s * Q[j][i] + c * Q[j + 1][i];
+                Q[j][i] = left;
+            }
+        }
+        for (size_t j = 0; j + 1 < history; j++) {
+            for (size_t i = 0; i <= j; i++) {
+                R[i][j] = R[i][j + 1];
+            }
+        }
+        oldest = slot(1);
+        history--;
+    }
+
+    /**
+     * @brief A cheap estimate of the condition number of R, the ratio of its largest and smallest diagonal entries.
+     */
+    [[nodiscard]] T condition() const {
+        T largest = 0;
+        T smallest = std::numeric_limits<T>::max();
+        for (size_t j = 0; j < history; j++) {
+            largest = std::max(largest, std::abs(R[j][j]));
+            smallest = std::min(smallest, std::abs(R[j][j]));
+        }
+        return largest / smallest;
+    }
+};
+
+/**
+ * @brief Solves x = G(x) with Anderson accelerated fixed point iteration, starting from an initial guess.
+ *
+ * @param G The fixed point map, called as G(x, Gx) with Gx already sized.
+ * @param initial The initial guess.
+ * @param max_iterations The maximum number of evaluations of G.
+ * @param tolerance The convergence threshold on the largest absolute fixed point residual, max |G(x) - x|.
+ * @param depth The number of previous steps to mix. Zero is plain fixed point iteration.
+ * @return The solution. Its iterations are the evaluations of G, and on convergence x is the last G(x).
+ */
+template <typename T, typename Map>
+MyBLAS::Solver::Solution<T> applyAndersonAcceleration(Map &&G, const MyBLAS::Vector<T> &initial,
+                                                      const size_t max_iterations, const T tolerance,
+                                                      const size_t depth = 5) {
+    const size_t n = initial.size();
+    MyBLAS::Solver::Solution<T> results(n);
+    results.method = METHOD_FIXED_POINT;
+    results.iterative_error = std::numeric_limits<T>::max();
+
+    auto &x = results.x;
+    x = initial;
+    MyBLAS::Vector<T> Gx(n, 0);
+    AndersonAccelerator<T> anderson(n, depth);
+
+    for (results.iterations = 0; results.iterations < max_iterations;) {
+        G(x, Gx);
+        results.iterations++;
+
+        results.iterative_error = 0;
+        for (size_t i = 0; i < n; i++) {
+            results.iterative_error = std::max(results.iterative_error, std::abs(Gx[i] - x[i]));
+        }
+        if (results.iterative_error <= tolerance) {
+            x = Gx;
+            results.converged = true;
+            break;
+        }
+
+        anderson.mix(x, Gx, x);
+    }
+
+    return results;
+}
+
+} // namespace MyRelaxationMethod
+
+#endif // NE591_008_ANDERSON_H
@@ -9,6 +9,7 @@
 #define NE591_008_CONJUGATEGRADIENT_H
 
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
 #include "math/blas/vector/Vector.h"
 #include <cstddef>
 #include <iostream>
@@ -16,11 +17,15 @@
 #include <cmath>
 #include <numeric>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "math/blas/Ops.h"
 
+#include "math/relaxation/Preconditioner.h"
 #include "math/relaxation/RelaxationMethods.h"
 #include "blas/solver/LinearSolver.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyRelaxationMethod
@@ -37,22 +42,25 @@ MyBLAS::Solver::Solution<T> applyConjugateGradient(const MatrixType<T> &A, const
 
     const size_t n = A.getRows();           // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("CG");
 
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // we will compare the squares since this saves us many sqrt ops
 
+    // All work vectors are allocated once, and every update below is done in place
     VectorType<T> x(n, 0);          // Initialize guess
-    VectorType<T> r = b - (A * x);  // Initial residual
+    VectorType<T> r = b;            // Initial residual, b - A * x for the zero guess
     VectorType<T> p = r;            // Initial search direction
+    VectorType<T> Ap(n, 0);         // Matrix-vector product buffer, reused across iterations
 
-    for (size_t iterations = 0; iterations < max_iterations; iterations++) {
+    T r_dot = r * r; // Dot product of the residual with itself, carried over from the previous iteration's fused update
 
-        // place loop-specific variables inside the loop to guide the compiler to know that some parts of the loop
-        // calculation are independent
+    for (size_t iterations = 0; iterations < max_iterations; iterations++) {
 
-        T r_dot = r * r; // Dot product of the residual with itself
-        VectorType<T> Ap = A * p; // Matrix-vector product
+        PROFILE_ZONE_NAMED(matvecZone, "CG matvec");
+        MyBLAS::multiplyInto(A, p, Ap); // Matrix-vector product into the reused buffer
         T pAp = p * Ap; // Dot product for the denominator in alpha calculation
+        PROFILE_ZONE_STOP(matvecZone);
 
         // Check for division by zero
         if (pAp == static_cast<T>(0)) {
@@ -61,27 +69,30 @@ MyBLAS::Solver::Solution<T> applyConjugateGradient(const MatrixType<T> &A, const
             break;
         }
 
-        T alpha = r_dot / pAp; // Step size
-        x = x + alpha * p; // Update the estimate of the solution
-        r = r - alpha * Ap; // Update the residual
+        const T alpha = r_dot / pAp; // Step size
 
-        iterative_error_squared = r * r; // Calculate the square of the L2 norm of the residual
+        PROFILE_ZONE_NAMED(updateZone, "CG update");
+        // Update the solution estimate and the residual, and compute the square of the residual's L2 norm, in one pass
+        iterative_error_squared = MyBLAS::updateSolutionAndResidual(alpha, p, Ap, x, r);
+        PROFILE_ZONE_STOP(updateZone);
         if (iterative_error_squared < tolerance_squared) {
             results.converged = true;
             results.iterations = iterations;
             break; // Convergence achieved
         }
 
-        T r_dot_1 = iterative_error_squared; // Dot product of the new residual with itself
-        T betaK = r_dot_1 / r_dot; // Calculate the beta coefficient
-        p = r + betaK * p; // Update the search direction
+        const T betaK = iterative_error_squared / r_dot; // Calculate the beta coefficient
+        PROFILE_ZONE_NAMED(directionZone, "CG direction");
+        MyBLAS::xpay(r, betaK, p); // Update the search direction, p = r + betaK * p
+        PROFILE_ZONE_STOP(directionZone);
+        r_dot = iterative_error_squared;
     }
 
     results.iterative_error = std::sqrt(iterative_error_squared);
     if (!results.converged) {
         results.iterations = max_iterations;
     }
-    results.x = x;
+    results.x = std::move(x);
     return results;
 }
 
@@ -90,27 +101,33 @@ MyBLAS::Solver::Solution<T> applyJacobiPreconditionedConjugateGradient(const Mat
 
     const size_t n = A.getRows();           // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("Jacobi PCG");
 
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
-    const T tolerance_squared = std::pow(tolerance, 2); // we will compare the squares since this saves us many sqrt ops
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // we will compare the squares since this saves us many sqrt ops
 
+    // All work vectors are allocated once, and every update below is done in place
     VectorType<T> x(n, 0);          // Initialize guess
-    VectorType<T> r = b - (A * x);  // Initial residual
+    VectorType<T> r = b;            // Initial residual, b - A * x for the zero guess
 
     // Create and apply the Jacobi preconditioner
     VectorType<T> M_inv(n); // Vector to store the inverse of the diagonal elements of A
     for (size_t i = 0; i < n; ++i) {
-        M_inv[i] = static_cast<T>(1) / A(i, i); // Assuming A(i, i) is never zero
+        M_inv[i] = static_cast<T>(1) / MyBLAS::diagonalEntry(A, i); // Assuming A(i, i) is never zero
     }
 
     VectorType<T> z = VectorType<T>::elementwiseProduct(r, M_inv); // Apply preconditioner: z = M^-1 * r
     VectorType<T> p = z;         // Initial search direction
+    VectorType<T> Ap(n, 0);      // Matrix-vector product buffer, reused across iterations
+
+    T r_dot = r * z; // Dot product of the residual with the preconditioned residual, carried over between iterations
 
     for (size_t iterations = 0; iterations < max_iterations; iterations++) {
 
-        T r_dot = r * z; // Dot product of the residual with the preconditioned residual
-        VectorType<T> Ap = A * p; // Matrix-vector product
+        PROFILE_ZONE_NAMED(matvecZone, "Jacobi PCG matvec");
+        MyBLAS::multiplyInto(A, p, Ap); // Matrix-vector product into the reused buffer
         T pAp = p * Ap; // Dot product for the denominator in alpha calculation
+        PROFILE_ZONE_STOP(matvecZone);
 
         // Check for division by zero
         if (pAp == static_cast<T>(0)) {
@@ -119,29 +136,210 @@ MyBLAS::Solver::Solution<T> applyJacobiPreconditionedConjugateGradient(const Mat
             break;
         }
 
-        T alpha = r_dot / pAp; // Step size
-        x = x + alpha * p; // Update the estimate of the solution
-        r = r - alpha * Ap; // Update the residual
+        const T alpha = r_dot / pAp; // Step size
 
-        // Apply the preconditioner to the new residual
-        z = VectorType<T>::elementwiseProduct(r, M_inv);
+        PROFILE_ZONE_NAMED(updateZone, "Jacobi PCG update");
+        // Update the solution estimate and the residual, apply the preconditioner to the new residual, and compute the
+        // square of the preconditioned residual's norm, in one pass
+        iterative_error_squared = MyBLAS::updateSolutionAndPreconditionedResidual(alpha, p, Ap, M_inv, x, r, z);
+        PROFILE_ZONE_STOP(updateZone);
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            results.iterations = iterations;
+            break; // Convergence achieved
+        }
 
-        iterative_error_squared = z * r; // Calculate the square of the L2 norm of the preconditioned residual
+        const T betaK = iterative_error_squared / r_dot; // Calculate the beta coefficient using the preconditioned residual
+        PROFILE_ZONE_NAMED(directionZone, "Jacobi PCG direction");
+        MyBLAS::xpay(z, betaK, p); // Update the search direction, p = z + betaK * p
+        PROFILE_ZONE_STOP(directionZone);
+        r_dot = iterative_error_squared;
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    if (!results.converged) {
+        results.iterations = max_iterations;
+    }
+    results.x = std::move(x);
+    return results;
+}
+
+/**
+ * @brief Preconditioned conjugate gradient with any preconditioner M, given as a type with a member apply(r, z) that
+ * writes z = M^-1 * r (see Preconditioner.h).
+ *
+ * Convergence is checked on the L2 norm of the unpreconditioned residual, the same as plain CG, so that iteration
+ * counts can be compared across preconditioners.
+ *
+ * @param A The symmetric positive definite coefficient matrix.
+ * @param b The right hand side.
+ * @param M The preconditioner, whose M^-1 must be symmetric positive definite.
+ * @param max_iterations The maximum number of iterations.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @return A Solution object containing the solution vector, the number of iterations performed, whether the method
+ * converged, and the final residual norm.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T, typename PreconditionerType>
+MyBLAS::Solver::Solution<T> applyPreconditionedConjugateGradient(const MatrixType<T> &A, const VectorType<T> &b, PreconditionerType &&M,
+                                                                 const size_t max_iterations, const T tolerance) {
+    static_assert(is_preconditioner_v<std::remove_reference_t<PreconditionerType>, VectorType<T>>,
+                  "M must have a member apply(r, z) that writes z = M^-1 * r");
+
+    const size_t n = A.getRows();
+    MyBLAS::Solver::Solution<T> results(n);
+    PROFILE_ZONE("PCG");
+    results.method = METHOD_PRECONDITIONED_CONJUGATE_GRADIENT;
+
+    T iterative_error_squared = b * b;
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2));
+
+    // All work vectors are allocated once, and every update below is done in place
+    VectorType<T> x(n, 0);
+    VectorType<T> r = b;
+    VectorType<T> z(n, 0);
+    VectorType<T> Ap(n, 0);
+    M.apply(r, z);
+    VectorType<T> p = z;
+    T r_dot = r * z; // Dot product of the residual with the preconditioned residual, carried over between iterations
+
+    if (iterative_error_squared < tolerance_squared) {
+        results.converged = true;
+        results.iterations = 0;
+    }
+
+    for (size_t iterations = 0; iterations < max_iterations && !results.converged; iterations++) {
+
+        PROFILE_ZONE_NAMED(matvecZone, "PCG matvec");
+        MyBLAS::multiplyInto(A, p, Ap);
+        const T pAp = p * Ap;
+        PROFILE_ZONE_STOP(matvecZone);
+        if (pAp == static_cast<T>(0)) {
+            results.iterations = iterations;
+            break;
+        }
+
+        const T alpha = r_dot / pAp;
+        PROFILE_ZONE_NAMED(updateZone, "PCG update");
+        iterative_error_squared = MyBLAS::updateSolutionAndResidual(alpha, p, Ap, x, r);
+        PROFILE_ZONE_STOP(updateZone);
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            results.iterations = iterations;
+            break;
+        }
+
+        PROFILE_ZONE_NAMED(preconditionerZone, "PCG preconditioner");
+        M.apply(r, z);
+        PROFILE_ZONE_STOP(preconditionerZone);
+        PROFILE_ZONE_NAMED(directionZone, "PCG direction");
+        const T rz = r * z;
+        MyBLAS::xpay(z, rz / r_dot, p); // p = z + beta * p
+        PROFILE_ZONE_STOP(directionZone);
+        r_dot = rz;
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    if (!results.converged) {
+        results.iterations = max_iterations;
+    }
+    results.x = std::move(x);
+    return results;
+}
+
+/**
+ * @brief Pipelined conjugate gradient (Ghysels and Vanroose, 2014), with a single reduction per iteration.
+ *
+ * Standard CG has two dependent reductions per iteration, p * Ap and r * r, each of which is an OpenMP barrier.
+ * The pipelined recurrences also carry w = A * r, s = A * p and z = A * s. That lets r * r and w * r be computed
+ * together in one reduction, which is issued with nowait so that threads move straight on to the product
+ * q = A * w, overlapping it with the reduction. The six vector updates are then fused into a single pass. Each
+ * iteration therefore has two barriers, rather than one per reduction, product and update. The price is three more
+ * work vectors, and a slightly larger drift between the recurred and true residuals than standard CG.
+ *
+ * @param A The symmetric positive definite coefficient matrix.
+ * @param b The constant vector.
+ * @param max_iterations The maximum number of iterations.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applyPipelinedConjugateGradient(const MatrixType<T> &A, const VectorType<T> &b, const size_t max_iterations, const T tolerance) {
+
+    const size_t n = A.getRows();           // Get the number of rows in the matrix A
+    MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("Pipelined CG");
+    results.method = METHOD_PIPELINED_CONJUGATE_GRADIENT;
+
+    T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // we will compare the squares since this saves us many sqrt ops
+
+    // All work vectors are allocated once, and every update below is done in place
+    VectorType<T> x(n, 0);  // Initialize guess
+    VectorType<T> r = b;    // Initial residual, b - A * x for the zero guess
+    VectorType<T> w(n, 0);  // w = A * r
+    VectorType<T> q(n, 0);  // q = A * w
+    VectorType<T> p(n, 0);  // search direction
+    VectorType<T> s(n, 0);  // s = A * p
+    VectorType<T> z(n, 0);  // z = A * s
+    MyBLAS::multiplyInto(A, r, w);
+
+    T alpha = 0, gamma_previous = 0;
+
+    for (size_t iterations = 0; iterations < max_iterations; iterations++) {
+
+        // One merged reduction for gamma = r * r and delta = w * r, overlapped with q = A * w
+        PROFILE_ZONE_NAMED(reductionZone, "Pipelined CG reduction and matvec");
+        T gamma = 0, delta = 0;
+        #pragma omp parallel default(none) shared(A, r, w, q, n) reduction(+:gamma, delta)
+        {
+            #pragma omp for schedule(static) nowait
+            for (size_t i = 0; i < n; i++) {
+                gamma += r[i] * r[i];
+                delta += w[i] * r[i];
+            }
+            #pragma omp for schedule(static)
+            for (size_t row = 0; row < n; row++) {
+                q[row] = MyBLAS::diagonalEntry(A, row) * w[row] + MyBLAS::offDiagonalRowProduct(A, row, w);
+            }
+        }
+        PROFILE_ZONE_STOP(reductionZone);
+
+        iterative_error_squared = gamma; // The square of the L2 norm of the current residual
         if (iterative_error_squared < tolerance_squared) {
             results.converged = true;
             results.iterations = iterations;
             break; // Convergence achieved
         }
 
-        T betaK = (z * r) / r_dot; // Calculate the beta coefficient using the preconditioned residual
-        p = z + betaK * p; // Update the search direction
+        const T beta = (iterations == 0) ? static_cast<T>(0) : gamma / gamma_previous;
+        const T denominator = (iterations == 0) ? delta : delta - beta * gamma / alpha;
+
+        // Check for division by zero
+        if (denominator == static_cast<T>(0)) {
+            results.iterations = iterations;
+            break;
+        }
+        alpha = gamma / denominator;
+        gamma_previous = gamma;
+
+        // Fused update of the search directions, their products with A, the solution and the residual
+        PROFILE_ZONE_NAMED(updateZone, "Pipelined CG update");
+        #pragma omp parallel for simd default(none) shared(alpha, beta, x, r, w, q, p, s, z, n)
+        for (size_t i = 0; i < n; i++) {
+            z[i] = q[i] + beta * z[i];
+            s[i] = w[i] + beta * s[i];
+            p[i] = r[i] + beta * p[i];
+            x[i] += alpha * p[i];
+            r[i] -= alpha * s[i];
+            w[i] -= alpha * z[i];
+        }
+        PROFILE_ZONE_STOP(updateZone);
     }
 
     results.iterative_error = std::sqrt(iterative_error_squared);
     if (!results.converged) {
         results.iterations = max_iterations;
     }
-    results.x = x;
+    results.x = std::move(x);
     return results;
 }
 
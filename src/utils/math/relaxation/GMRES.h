@@ -0,0 +1,139 @@
+/**
+ * @file GMRES.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains the implementation of restarted GMRES for solving non-symmetric systems of linear
+ * equations.
+ */
+
+#ifndef NE591_008_GMRES_H
+#define NE591_008_GMRES_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "math/blas/Ops.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/RelaxationMethods.h"
+
+namespace MyRelaxationMethod {
+
+/**
+ * @brief Solves A * x = b with restarted GMRES(m), starting from a zero guess.
+ *
+ * Each cycle builds an orthonormal basis of the Krylov space span{r, Ar, ..., A^(m-1) r} with modified Gram-Schmidt,
+ * and picks the x in it that minimizes ||b - A * x||. The small Hessenberg least squares problem is reduced with Givens
+ * rotations as the basis grows, so that the residual norm of the current iterate is known at every step without
+ * forming x. Only A * v is needed, so A can be matrix-free, and it does not have to be symmetric.
+ *
+ * @param A The coefficient matrix, any type that MyBLAS::multiplyInto accepts.
+ * @param b The right hand side.
+ * @param max_iterations The maximum number of matrix-vector products, across all restarts.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @param restart The dimension m of the Krylov space, after which GMRES restarts from the current iterate.
+ * @return The solution. Its iterations are the matrix-vector products in the Arnoldi steps.
+ */
+template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
+MyBLAS::Solver::Solution<T> applyGMRES(const MatrixType<T> &A, const VectorType<T> &b, const size_t max_iterations,
+                                       const T tolerance, const size_t restart = 30) {
+    const size_t n = A.getRows();
+    const size_t m = std::max<size_t>(1, std::min(restart, n));
+    MyBLAS::Solver::Solution<T> results(n);
+    results.method = METHOD_GMRES;
+    results.iterations = 0;
+    auto &x = results.x;
+
+    std::vector<VectorType<T>> V;
+    V.reserve(m + 1);
+    for (size_t k = 0; k <= m; k++) {
+        V.emplace_back(n, 0);
+    }
+    std::vector<std::vector<T>> H(m + 1, std::vector<T>(m, 0));
+    std::vector<T> cs(m, 0), sn(m, 0), g(m + 1, 0), y(m, 0);
+
+    VectorType<T> r = b;
+    T beta = std::sqrt(r * r);
+    while (beta > tolerance && results.iterations < max_iterations) {
+        for (size_t i = 0; i < n; i++) {
+            V[0][i] = r[i] / beta;
+        }
+        std::fill(g.begin(), g.end(), static_cast<T>(0));
+        g[0] = beta;
+
+        size_t k = 0;
+        while (k < m && results.iterations < max_iterations) {
+            auto &w = V[k + 1];
+            MyBLAS::multiplyInto(A, V[k], w);
+            results.iterations++;
+
+            // modified Gram-Schmidt against the basis so far
+            for (size_t i = 0; i <= k; i++) {
+                H[i][k] = w * V[i];
+                MyBLAS::axpy(-H[i][k], V[i], w);
+            }
+            H[k + 1][k] = std::sqrt(w * w);
+            const bool breakdown = !(H[k + 1][k] > std::numeric_limits<T>::min());
+            if (!breakdown) {
+                for (size_t i = 0; i < n; i++) {
+                    w[i] /= H[k + 1][k];
+                }
+            }
+
+            // rotate the new column by the previous rotations, then zero its subdiagonal entry
+            for (size_t i = 0; i < k; i++) {
+                const T upper = cs[i] * H[i][k] + sn[i] * H[i + 1][k];
+                H[i + 1][k] = -sn[i] * H[i][k] + cs[i] * H[i + 1][k];
+                H[i][k] = upper;
+            }
+            const T radius = std::hypot(H[k][k], H[k + 1][k]);
+            cs[k] = radius > 0 ? H[k][k] / radius : static_cast<T>(1);
+            sn[k] = radius > 0 ? H[k + 1][k] / radius : static_cast<T>(0);
+            H[k][k] = radius;
+            H[k + 1][k] = 0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+            k++;
+
+            if (std::abs(g[k]) <= tolerance || breakdown) {
+                break;
+            }
+        }
+
+        // back substitution for the least squares coefficients, then x += V * y
+        for (size_t i = k; i-- > 0;) {
+            T sum = g[i];
+            for (size_t j = i + 1; j < k; j++) {
+                sum -= H[i][j] * y[j];
+            }
+            y[i] = H[i][i] != 0 ? sum / H[i][i] : static_cast<T>(0);
+        }
+        for (size_t j = 0; j < k; j++) {
+            MyBLAS::axpy(y[j], V[j], x);
+        }
+
+        // the true residual, since the recurrence drifts from it in finite precision
+        MyBLAS::multiplyInto(A, x, r);
+        for (size_t i = 0; i < n; i++) {
+            r[i] = b[i] - r[i];
+        }
+        const T next = std::sqrt(r * r);
+        if (!(next < beta)) {
+            beta = next;
+            break; // stagnated, a restart would rebuild the same space
+        }
+        beta = next;
+    }
+
+    results.converged = (beta <= tolerance);
+    results.iterative_error = beta;
+    return results;
+}
+
+} // namespace MyRelaxationMethod
+
+#endif // NE591_008_GMRES_H
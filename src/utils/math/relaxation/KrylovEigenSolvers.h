@@ -0,0 +1,884 @@
+/**
+ * @file KrylovEigenSolvers.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains implicitly restarted Arnoldi and Lanczos eigensolvers, which find several eigenpairs at once.
+ *
+ * Power iteration only keeps its latest iterate, so it finds a single eigenpair, and converges at the ratio |l2 / l1|.
+ * Arnoldi keeps an orthonormal basis V of the Krylov space span{v, Av, ..., A^(m-1) v}, with A * V = V * H + f * e_m^T,
+ * and the eigenpairs of the small upper Hessenberg matrix H (the Ritz pairs) approximate the extreme eigenpairs of A.
+ * Once the basis is full, it is compressed back to the wanted Ritz directions by applying the unwanted Ritz values as
+ * exact shifts of the implicit QR algorithm to H. This filters the starting vector with a polynomial that vanishes on the
+ * unwanted part of the spectrum, without any further products with A. Lanczos is the same process for a symmetric A,
+ * where H is tridiagonal and all the Ritz values are real.
+ */
+
+#ifndef NE591_008_KRYLOVEIGENSOLVERS_H
+#define NE591_008_KRYLOVEIGENSOLVERS_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "math/Random.h"
+#include "math/blas/Ops.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/RelaxationMethods.h"
+
+namespace MyRelaxationMethod {
+
+/**
+ * @brief The part of the spectrum that a Krylov eigensolver converges to.
+ */
+enum EigenvalueTarget {
+    TARGET_LARGEST_MAGNITUDE,
+    TARGET_SMALLEST_MAGNITUDE,
+    TARGET_LARGEST_REAL,
+    TARGET_SMALLEST_REAL
+};
+
+/**
+ * @namespace MyRelaxationMethod::Krylov
+ * @brief The dense kernels on the small projected matrix H, and the restarted Arnoldi process shared by the solvers.
+ */
+namespace Krylov {
+
+template <typename T> using Dense = std::vector<std::vector<T>>;
+
+/**
+ * @brief Orders eigenvalues so that the wanted ones come first. Ties are broken so that the two members of a complex
+ * conjugate pair are adjacent, with the positive imaginary part first.
+ */
+template <typename T>
+bool precedes(const std::complex<T> &a, const std::complex<T> &b, const EigenvalueTarget target) {
+    T keyA, keyB;
+    switch (target) {
+    case TARGET_LARGEST_MAGNITUDE:
+        keyA = -std::abs(a);
+        keyB = -std::abs(b);
+        break;
+    case TARGET_SMALLEST_MAGNITUDE:
+        keyA = std::abs(a);
+        keyB = std::abs(b);
+        break;
+    case TARGET_LARGEST_REAL:
+        keyA = -a.real();
+        keyB = -b.real();
+        break;
+    default:
+        keyA = a.real();
+        keyB = b.real();
+        break;
+    }
+    if (keyA != keyB) {
+        return keyA < keyB;
+    }
+    if (a.real() != b.real()) {
+        return a.real() > b.real();
+    }
+    return a.imag() > b.imag();
+}
+
+/**
+ * @brief Computes all the eigenvalues of the leading m x m block of an upper Hessenberg matrix with the Francis double
+ * shift QR algorithm (hqr, as in EISPACK and Numerical Recipes). Complex eigenvalues come out in conjugate pairs.
+ * @return False if some eigenvalue did not converge within the iteration limit.
+ */
+template <typename T> bool hessenbergEigenvalues(const Dense<T> &H, const size_t m, std::vector<std::complex<T>> &w) {
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    // a 1-based copy, so that the indexing follows the reference algorithm
+    Dense<T> a(m + 1, std::vector<T>(m + 1, 0));
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = (i > 0 ? i - 1 : 0); j < m; j++) {
+            a[i + 1][j + 1] = H[i][j];
+        }
+    }
+    std::vector<T> wr(m + 1, 0), wi(m + 1, 0);
+
+    T anorm = 0;
+    for (size_t i = 1; i <= m; i++) {
+        for (size_t j = std::max<size_t>(i - 1, 1); j <= m; j++) {
+            anorm += std::abs(a[i][j]);
+        }
+    }
+
+    long nn = static_cast<long>(m);
+    long l = 1;
+    T t = 0;
+    while (nn >= 1) {
+        size_t its = 0;
+        do {
+            for (l = nn; l >= 2; l--) {
+                T s = std::abs(a[l - 1][l - 1]) + std::abs(a[l][l]);
+                if (s == 0) {
+                    s = anorm;
+                }
+                if (std::abs(a[l][l - 1]) <= eps * s) {
+                    a[l][l - 1] = 0;
+                    break;
+                }
+            }
+            T x = a[nn][nn];
+            if (l == nn) { // one root found
+                wr[nn] = x + t;
+                wi[nn--] = 0;
+            } else {
+                T y = a[nn - 1][nn - 1];
+                T w2 = a[nn][nn - 1] * a[nn - 1][nn];
+                if (l == nn - 1) { // two roots found
+                    const T p = static_cast<T>(0.5) * (y - x);
+                    const T q = p * p + w2;
+                    T z = std::sqrt(std::abs(q));
+                    x += t;
+                    if (q >= 0) {
+                        z = p + (p >= 0 ? std::abs(z) : -std::abs(z));
+                        wr[nn - 1] = wr[nn] = x + z;
+                        if (z != 0) {
+                            wr[nn] = x - w2 / z;
+                        }
+                        wi[nn - 1] = wi[nn] = 0;
+                    } else {
+                        wr[nn - 1] = wr[nn] = x + p;
+                        wi[nn - 1] = -(wi[nn] = z);
+                    }
+                    nn -= 2;
+                } else { // no roots found yet, continue the iteration
+                    if (its == 60) {
+                        return false;
+                    }
+                    if (its == 10 || its == 20) { // exceptional shift
+                        t += x;
+                        for (long i = 1; i <= nn; i++) {
+                            a[i][i] -= x;
+                        }
+                        const T s = std::abs(a[nn][nn - 1]) + std::abs(a[nn - 1][nn - 2]);
+                        y = x = static_cast<T>(0.75) * s;
+                        w2 = static_cast<T>(-0.4375) * s * s;
+                    }
+                    ++its;
+                    long mm;
+                    T p = 0, q = 0, r = 0, z = 0;
+                    for (mm = nn - 2; mm >= l; mm--) {
+                        z = a[mm][mm];
+                        r = x - z;
+                        T s = y - z;
+                        p = (r * s - w2) / a[mm + 1][mm] + a[mm][mm + 1];
+                        q = a[mm + 1][mm + 1] - z - r - s;
+                        r = a[mm + 2][mm + 1];
+                        s = std::abs(p) + std::abs(q) + std::abs(r);
+                        p /= s;
+                        q /= s;
+                        r /= s;
+                        if (mm == l) {
+                            break;
+                        }
+                        const T u = std::abs(a[mm][mm - 1]) * (std::abs(q) + std::abs(r));
+                        const T v = std::abs(p) * (std::abs(a[mm - 1][mm - 1]) + std::abs(z) + std::abs(a[mm + 1][mm + 1]));
+                        if (u <= eps * v) {
+                            break;
+                        }
+                    }
+                    for (long i = mm + 2; i <= nn; i++) {
+                        a[i][i - 2] = 0;
+                        if (i != mm + 2) {
+                            a[i][i - 3] = 0;
+                        }
+                    }
+                    for (long k = mm; k <= nn - 1; k++) {
+                        if (k != mm) {
+                            p = a[k][k - 1];
+                            q = a[k + 1][k - 1];
+                            r = 0;
+                            if (k != nn - 1) {
+                                r = a[k + 2][k - 1];
+                            }
+                            if ((x = std::abs(p) + std::abs(q) + std::abs(r)) != 0) {
+                                p /= x;
+                                q /= x;
+                                r /= x;
+                            }
+                        }
+                        const T norm = std::sqrt(p * p + q * q + r * r);
+                        const T s = p >= 0 ? norm : -norm;
+                        if (s != 0) {
+                            if (k == mm) {
+                                if (l != mm) {
+                                    a[k][k - 1] = -a[k][k - 1];
+                                }
+                            } else {
+                                a[k][k - 1] = -s * x;
+                            }
+                            p += s;
+                            x = p / s;
+                            y = q / s;
+                            z = r / s;
+                            q /= p;
+                            r /= p;
+                            for (long j = k; j <= nn; j++) {
+                                p = a[k][j] + q * a[k + 1][j];
+                                if (k != nn - 1) {
+                                    p += r * a[k + 2][j];
+                                    a[k + 2][j] -= p * z;
+                                }
+                                a[k + 1][j] -= p * y;
+                                a[k][j] -= p * x;
+                            }
+                            const long last = std::min(nn, k + 3);
+                            for (long i = l; i <= last; i++) {
+                                p = x * a[i][k] + y * a[i][k + 1];
+                                if (k != nn - 1) {
+                                    p += z * a[i][k + 2];
+                                    a[i][k + 2] -= p * r;
+                                }
+                                a[i][k + 1] -= p * q;
+                                a[i][k] -= p;
+                            }
+                        }
+                    }
+                }
+            }
+        } while (l < nn - 1);
+    }
+
+    w.resize(m);
+    for (size_t i = 0; i < m; i++) {
+        w[i] = std::complex<T>(wr[i + 1], wi[i + 1]);
+    }
+    return true;
+}
+
+/**
+ * @brief Computes the eigenvector of the leading m x m block of H for an eigenvalue theta, by two steps of inverse
+ * iteration with a slightly perturbed shift, in complex arithmetic.
+ * @return The eigenvector, with unit L2 norm.
+ */
+template <typename T>
+std::vector<std::complex<T>> hessenbergEigenvector(const Dense<T> &H, const size_t m, const std::complex<T> &theta) {
+    using Complex = std::complex<T>;
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    T norm = 0;
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < m; j++) {
+            norm = std::max(norm, std::abs(H[i][j]));
+        }
+    }
+    norm = std::max(norm, std::numeric_limits<T>::min());
+    const Complex shift = theta + Complex(eps * norm, 0);
+
+    // LU factorization of (H - shift * I) with partial pivoting, where tiny pivots are replaced so that the solve
+    // produces a large multiple of the eigenvector instead of failing
+    Dense<Complex> M(m, std::vector<Complex>(m, 0));
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < m; j++) {
+            M[i][j] = H[i][j];
+        }
+        M[i][i] -= shift;
+    }
+    std::vector<size_t> pivots(m, 0);
+    for (size_t k = 0; k < m; k++) {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < m; i++) {
+            if (std::abs(M[i][k]) > std::abs(M[pivot][k])) {
+                pivot = i;
+            }
+        }
+        pivots[k] = pivot;
+        std::swap(M[k], M[pivot]);
+        if (std::abs(M[k][k]) < eps * norm) {
+            M[k][k] = eps * norm;
+        }
+        for (size_t i = k + 1; i < m; i++) {
+            M[i][k] /= M[k][k];
+            for (size_t j = k + 1; j < m; j++) {
+                M[i][j] -= M[i][k] * M[k][j];
+            }
+        }
+    }
+
+    std::vector<Complex> y(m, Complex(1, 0));
+    for (size_t step = 0; step < 2; step++) {
+        for (size_t k = 0; k < m; k++) {
+            std::swap(y[k], y[pivots[k]]);
+            for (size_t i = k + 1; i < m; i++) {
+                y[i] -= M[i][k] * y[k];
+            }
+        }
+        for (size_t k = m; k-- > 0;) {
+            for (size_t j = k + 1; j < m; j++) {
+                y[k] -= M[k][j] * y[j];
+            }
+            y[k] /= M[k][k];
+        }
+        T yNorm = 0;
+        for (const auto &value : y) {
+            yNorm += std::norm(value);
+        }
+        yNorm = std::sqrt(yNorm);
+        for (auto &value : y) {
+            value /= yNorm;
+        }
+    }
+    return y;
+}
+
+/**
+ * @brief Computes all the eigenpairs of the leading m x m block of a symmetric tridiagonal matrix with the implicit QL
+ * algorithm (tqli, as in EISPACK and Numerical Recipes).
+ * @param H The matrix, of which only the diagonal and the subdiagonal are read.
+ * @param d The eigenvalues.
+ * @param z The eigenvectors, stored as columns.
+ * @return False if some eigenvalue did not converge within the iteration limit.
+ */
+template <typename T> bool tridiagonalEigenpairs(const Dense<T> &H, const size_t m, std::vector<T> &d, Dense<T> &z) {
+    const T eps = std::numeric_limits<T>::epsilon();
+    d.assign(m, 0);
+    std::vector<T> e(m, 0);
+    z.assign(m, std::vector<T>(m, 0));
+    for (size_t i = 0; i < m; i++) {
+        d[i] = H[i][i];
+        e[i] = i + 1 < m ? H[i + 1][i] : 0;
+        z[i][i] = 1;
+    }
+
+    const long n = static_cast<long>(m);
+    for (long l = 0; l < n; l++) {
+        size_t its = 0;
+        long mm;
+        do {
+            // look for a negligible subdiagonal entry, which splits the matrix
+            for (mm = l; mm + 1 < n; mm++) {
+                const T dd = std::abs(d[mm]) + std::abs(d[mm + 1]);
+                if (std::abs(e[mm]) <= eps * dd) {
+                    break;
+                }
+            }
+            if (mm != l) {
+                if (its++ == 60) {
+                    return false;
+                }
+                // the Wilkinson shift, chased from the bottom of the unreduced block up with plane rotations
+                T g = (d[l + 1] - d[l]) / (2 * e[l]);
+                T r = std::hypot(g, static_cast<T>(1));
+                g = d[mm] - d[l] + e[l] / (g + (g >= 0 ? r : -r));
+                T s = 1, c = 1, p = 0;
+                long i;
+                for (i = mm - 1; i >= l; i--) {
+                    const T f = s * e[i];
+                    const T b = c * e[i];
+                    e[i + 1] = (r = std::hypot(f, g));
+                    if (r == 0) {
+                        d[i + 1] -= p;
+                        e[mm] = 0;
+                        break;
+                    }
+                    s = f / r;
+                    c = g / r;
+                    g = d[i + 1] - p;
+                    r = (d[i] - g) * s + 2 * c * b;
+                    d[i + 1] = g + (p = s * r);
+                    g = c * r - b;
+                    for (size_t k = 0; k < m; k++) {
+                        const T zk = z[k][i + 1];
+                        z[k][i + 1] = s * z[k][i] + c * zk;
+                        z[k][i] = c * z[k][i] - s * zk;
+                    }
+                }
+                if (r == 0 && i >= l) {
+                    continue;
+                }
+                d[l] -= p;
+                e[l] = g;
+                e[mm] = 0;
+            }
+        } while (mm != l);
+    }
+    return true;
+}
+
+/**
+ * @brief Applies the Householder reflector that maps x onto a multiple of e_1 to rows and columns [row, row + length) of
+ * H, and to the same columns of Q.
+ */
+template <typename T>
+void reflect(Dense<T> &H, Dense<T> &Q, const size_t m, const size_t row, const std::array<T, 3> &x,
+             const size_t length) {
+    T norm = 0;
+    for (size_t i = 0; i < length; i++) {
+        norm += x[i] * x[i];
+    }
+    norm = std::sqrt(norm);
+    if (!(norm > 0)) {
+        return;
+    }
+    std::array<T, 3> v = x;
+    v[0] += x[0] >= 0 ? norm : -norm;
+    T vv = 0;
+    for (size_t i = 0; i < length; i++) {
+        vv += v[i] * v[i];
+    }
+    const T scale = 2 / vv;
+
+    for (size_t j = 0; j < m; j++) {
+        T sum = 0;
+        for (size_t i = 0; i < length; i++) {
+            sum += v[i] * H[row + i][j];
+        }
+        sum *= scale;
+        for (size_t i = 0; i < length; i++) {
+            H[row + i][j] -= sum * v[i];
+        }
+    }
+    for (auto *matrix : {&H, &Q}) {
+        for (size_t i = 0; i < m; i++) {
+            auto &rowI = (*matrix)[i];
+            T sum = 0;
+            for (size_t l = 0; l < length; l++) {
+                sum += rowI[row + l] * v[l];
+            }
+            sum *= scale;
+            for (size_t l = 0; l < length; l++) {
+                rowI[row + l] -= sum * v[l];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Applies one implicit QR step with the shift mu to the leading m x m block of the upper Hessenberg H, so that
+ * H <- Q_s^T * H * Q_s, and accumulates Q <- Q * Q_s. A complex mu is applied together with its conjugate, as a Francis
+ * double shift step, which keeps everything real.
+ */
+template <typename T> void applyShift(Dense<T> &H, Dense<T> &Q, const size_t m, const std::complex<T> &mu) {
+    if (m < 2) {
+        return;
+    }
+    const bool pair = mu.imag() != 0 && m >= 3;
+    const size_t length = pair ? 3 : 2;
+
+    // the first column of (H - mu * I) or of (H - mu * I) * (H - conj(mu) * I), which has 2 or 3 non-zeros
+    std::array<T, 3> x{};
+    if (pair) {
+        const T s = 2 * mu.real();
+        const T t = std::norm(mu);
+        x[0] = H[0][0] * H[0][0] + H[0][1] * H[1][0] - s * H[0][0] + t;
+        x[1] = H[1][0] * (H[0][0] + H[1][1] - s);
+        x[2] = H[1][0] * H[2][1];
+    } else {
+        x[0] = H[0][0] - mu.real();
+        x[1] = H[1][0];
+    }
+    reflect(H, Q, m, 0, x, length);
+
+    // chase the bulge below the subdiagonal down and off the matrix
+    for (size_t column = 0; column + 2 < m; column++) {
+        const size_t rows = std::min(length, m - column - 1);
+        for (size_t l = 0; l < rows; l++) {
+            x[l] = H[column + 1 + l][column];
+        }
+        reflect(H, Q, m, column + 1, x, rows);
+        for (size_t i = column + 2; i < column + 1 + rows; i++) {
+            H[i][column] = 0;
+        }
+    }
+}
+
+/**
+ * @brief The implicitly restarted Arnoldi process behind applyArnoldi and applyLanczos.
+ * @details Converged Ritz pairs are not locked or deflated. Every restart filters the whole basis, and only the number of
+ * kept Ritz directions grows with the number of converged ones, so that they are not filtered out again.
+ * If the eigenvalues of H fail to converge, the iteration stops, and the Ritz values of the last pass that
+ * succeeded are returned as unconverged, without eigenvectors, since V has been restarted since.
+ * @param symmetric Whether A is symmetric, in which case H is kept tridiagonal and its eigenpairs are found with the
+ * implicit QL algorithm.
+ */
+template <template<typename> class MatrixType, typename T>
+std::vector<MyBLAS::Solver::Solution<T>> applyRestartedArnoldi(const MatrixType<T> &A, const size_t nev,
+                                                               const size_t max_iterations, const T tolerance,
+                                                               const EigenvalueTarget target, const size_t ncv,
+                                                               const size_t seed, const bool symmetric) {
+    using Complex = std::complex<T>;
+    const T eps = std::numeric_limits<T>::epsilon();
+    const T smallest = std::pow(eps, static_cast<T>(2) / 3);
+
+    const size_t n = A.getRows();
+    const size_t k = std::min(nev, n);
+    if (k == 0) {
+        return {};
+    }
+    const size_t m = std::min(n, std::max(ncv > 0 ? ncv : std::max<size_t>(2 * k + 1, 20), k + 2));
+
+    std::vector<MyBLAS::Vector<T>> V;
+    V.reserve(m);
+    for (size_t j = 0; j < m; j++) {
+        V.emplace_back(n, 0);
+    }
+    MyBLAS::Vector<T> f(n, 0), w(n, 0);
+    Dense<T> H(m, std::vector<T>(m, 0)), Q;
+    std::vector<T> h(m, 0), row(m, 0), combined(m, 0);
+
+    size_t matvecs = 0;
+    size_t draws = 0;
+    T beta = 0;
+
+    // orthogonalizes w against the first j basis vectors with classical Gram-Schmidt, h = V^T * w then w -= V * h,
+    // each in one pass, and repeats the pass once when it cancels most of w (DGKS)
+    const auto orthogonalize = [&](const size_t j) {
+        std::fill(h.begin(), h.end(), static_cast<T>(0));
+        const T original = std::sqrt(w * w);
+        T before = original;
+        T after = original;
+        for (size_t pass = 0; pass < 2; pass++) {
+            for (size_t l = 0; l < j; l++) {
+                const auto &v = V[l];
+                T sum = 0;
+                for (size_t i = 0; i < n; i++) {
+                    sum += v[i] * w[i];
+                }
+                combined[l] = sum;
+                h[l] += sum;
+            }
+            for (size_t i = 0; i < n; i++) {
+                T sum = 0;
+                for (size_t l = 0; l < j; l++) {
+                    sum += combined[l] * V[l][i];
+                }
+                w[i] -= sum;
+            }
+            after = std::sqrt(w * w);
+            if (after > static_cast<T>(0.717) * before) {
+                break;
+            }
+            before = after;
+        }
+        return std::make_pair(after, original);
+    };
+
+    // a fresh random direction orthogonal to the first j basis vectors, for when the Krylov space is invariant
+    const auto redraw = [&](const size_t j) {
+        w = Random::generate_vector<T>(n, -1, 1, seed + ++draws);
+        orthogonalize(j);
+        orthogonalize(j);
+        const T norm = std::sqrt(w * w);
+        for (size_t i = 0; i < n; i++) {
+            V[j][i] = w[i] / norm;
+        }
+    };
+
+    // extends the Arnoldi factorization from j0 to m columns
+    const auto extend = [&](const size_t j0) {
+        for (size_t j = j0; j < m; j++) {
+            MyBLAS::multiplyInto(A, V[j], w);
+            matvecs++;
+            const auto [norm, scale] = orthogonalize(j + 1);
+            for (size_t i = 0; i <= j; i++) {
+                H[i][j] = h[i];
+            }
+            const bool breakdown = !(norm > static_cast<T>(n) * eps * scale);
+            if (symmetric) {
+                for (size_t i = 0; i + 1 < j; i++) {
+                    H[i][j] = 0;
+                }
+                if (j > 0) {
+                    H[j - 1][j] = H[j][j - 1];
+                }
+            }
+            if (j + 1 == m) {
+                beta = breakdown ? 0 : norm;
+                for (size_t i = 0; i < n; i++) {
+                    f[i] = breakdown ? 0 : w[i];
+                }
+            } else if (breakdown) {
+                H[j + 1][j] = 0;
+                redraw(j + 1);
+            } else {
+                H[j + 1][j] = norm;
+                for (size_t i = 0; i < n; i++) {
+                    V[j + 1][i] = w[i] / norm;
+                }
+            }
+        }
+    };
+
+    w = Random::generate_vector<T>(n, -1, 1, seed);
+    {
+        const T norm = std::sqrt(w * w);
+        for (size_t i = 0; i < n; i++) {
+            V[0][i] = w[i] / norm;
+        }
+    }
+    extend(0);
+
+    std::vector<Complex> theta(m), ritz(m);
+    std::vector<size_t> order(m);
+    std::vector<std::vector<Complex>> Y(m);
+    std::vector<T> estimates(m, 0);
+    std::vector<T> eigenvalues;
+    Dense<T> Z;
+    size_t wanted = k;
+    size_t passes = 0;
+    bool stalled = false;
+
+    while (true) {
+        // the Ritz values, ordered with the wanted ones first
+        const bool found = symmetric ? tridiagonalEigenpairs(H, m, eigenvalues, Z) : hessenbergEigenvalues(H, m, ritz);
+        if (!found) {
+            std::cerr << "Warning: Ritz values did not converge, stopping the Krylov iteration early\n";
+            stalled = true;
+            break;
+        }
+        for (size_t i = 0; i < m; i++) {
+            theta[i] = symmetric ? Complex(eigenvalues[i], 0) : ritz[i];
+        }
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&theta, target](size_t a, size_t b) { return precedes(theta[a], theta[b], target); });
+
+        // keep both members of a conjugate pair in the wanted set
+        wanted = k;
+        if (wanted < m && theta[order[wanted - 1]].imag() > 0) {
+            wanted++;
+        }
+
+        // the Ritz estimates, ||A * x - theta * x|| = beta * |e_m^T * y|, of the wanted Ritz pairs
+        size_t converged = 0;
+        for (size_t i = 0; i < wanted; i++) {
+            const size_t index = order[i];
+            if (symmetric) {
+                Y[i].assign(m, Complex(0, 0));
+                for (size_t j = 0; j < m; j++) {
+                    Y[i][j] = Z[j][index];
+                }
+            } else {
+                Y[i] = hessenbergEigenvector(H, m, theta[index]);
+            }
+            estimates[i] = beta * std::abs(Y[i][m - 1]);
+            if (estimates[i] <= tolerance * std::max(std::abs(theta[index]), smallest)) {
+                converged++;
+            }
+        }
+        passes++;
+
+        if (converged >= wanted || !(beta > 0) || matvecs >= max_iterations || wanted + 1 >= m) {
+            break;
+        }
+
+        // keep a few more than the wanted directions, more so as they converge, without splitting a conjugate pair. The
+        // converged directions are kept, not locked, so the shifts below still act on them
+        size_t kept = std::min(wanted + std::min(converged, (m - wanted) / 2), m - 1);
+        if (theta[order[kept - 1]].imag() > 0) {
+            kept = kept + 1 < m ? kept + 1 : kept - 1;
+        }
+
+        // the unwanted Ritz values are the exact shifts, each conjugate pair applied once as a double shift
+        Q.assign(m, std::vector<T>(m, 0));
+        for (size_t i = 0; i < m; i++) {
+            Q[i][i] = 1;
+        }
+        for (size_t i = kept; i < m; i++) {
+            const Complex &mu = theta[order[i]];
+            if (mu.imag() >= 0) {
+                applyShift(H, Q, m, mu);
+            }
+        }
+        if (symmetric) {
+            for (size_t i = 0; i < m; i++) {
+                for (size_t j = 0; j < m; j++) {
+                    if (i > j + 1 || j > i + 1) {
+                        H[i][j] = 0;
+                    }
+                }
+                if (i + 1 < m) {
+                    H[i][i + 1] = H[i + 1][i] = (H[i][i + 1] + H[i + 1][i]) / 2;
+                }
+            }
+        }
+
+        // V <- V * Q, keeping the first kept columns, and the new residual f <- V * q_kept * H(kept, kept-1) + f * Q(m-1,
+        // kept-1), both in one pass over the rows of V
+        const T subdiagonal = H[kept][kept - 1];
+        const T tail = Q[m - 1][kept - 1];
+        for (size_t i = 0; i < n; i++) {
+            for (size_t l = 0; l < m; l++) {
+                row[l] = V[l][i];
+            }
+            for (size_t j = 0; j <= kept; j++) {
+                T sum = 0;
+                for (size_t l = 0; l < m; l++) {
+                    sum += row[l] * Q[l][j];
+                }
+                combined[j] = sum;
+            }
+            for (size_t j = 0; j < kept; j++) {
+                V[j][i] = combined[j];
+            }
+            f[i] = combined[kept] * subdiagonal + f[i] * tail;
+        }
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < m; j++) {
+                if (i >= kept || j >= kept) {
+                    H[i][j] = 0;
+                }
+            }
+        }
+
+        const T norm = std::sqrt(f * f);
+        if (norm > eps * std::abs(subdiagonal) && norm > std::numeric_limits<T>::min()) {
+            H[kept][kept - 1] = norm;
+            for (size_t i = 0; i < n; i++) {
+                V[kept][i] = f[i] / norm;
+            }
+        } else {
+            redraw(kept);
+        }
+        extend(kept);
+    }
+
+    std::vector<MyBLAS::Solver::Solution<T>> solutions;
+    solutions.reserve(k);
+
+    // the last Ritz values, if any pass found them, without their vectors
+    if (stalled) {
+        for (size_t i = 0; i < k; i++) {
+            MyBLAS::Solver::Solution<T> solution(n);
+            solution.method = symmetric ? METHOD_LANCZOS : METHOD_ARNOLDI;
+            solution.iterations = matvecs;
+            if (passes > 0 && i < wanted) {
+                const Complex &lambda = theta[order[i]];
+                solution.eigenvalue = lambda.real();
+                if (lambda.imag() != 0) {
+                    solution.eigenvalue_imaginary = lambda.imag();
+                }
+                solution.eigenvalue_iterative_error = estimates[i];
+            }
+            solutions.push_back(std::move(solution));
+        }
+        return solutions;
+    }
+
+    // the Ritz vectors x = V * y, with the phase chosen so that their largest component is real
+    MyBLAS::Vector<T> imaginary(n, 0), Ax(n, 0), Ay(n, 0);
+    for (size_t i = 0; i < k && i < wanted; i++) {
+        const Complex &lambda = theta[order[i]];
+        MyBLAS::Solver::Solution<T> solution(n);
+        solution.method = symmetric ? METHOD_LANCZOS : METHOD_ARNOLDI;
+        solution.iterations = matvecs;
+        solution.eigenvalue = lambda.real();
+        if (lambda.imag() != 0) {
+            solution.eigenvalue_imaginary = lambda.imag();
+        }
+        solution.eigenvalue_iterative_error = estimates[i];
+        solution.iterative_error = estimates[i] / std::max(std::abs(lambda), smallest);
+        solution.converged = solution.iterative_error <= tolerance;
+
+        auto &x = solution.x;
+        std::fill(imaginary.begin(), imaginary.end(), static_cast<T>(0));
+        for (size_t j = 0; j < m; j++) {
+            MyBLAS::axpy(Y[i][j].real(), V[j], x);
+            MyBLAS::axpy(Y[i][j].imag(), V[j], imaginary);
+        }
+        size_t largest = 0;
+        T largestModulus = 0;
+        for (size_t j = 0; j < n; j++) {
+            const T modulus = std::hypot(x[j], imaginary[j]);
+            if (modulus > largestModulus) {
+                largestModulus = modulus;
+                largest = j;
+            }
+        }
+        if (largestModulus > 0) {
+            const Complex phase = std::conj(Complex(x[largest], imaginary[largest])) / largestModulus;
+            for (size_t j = 0; j < n; j++) {
+                const Complex value = Complex(x[j], imaginary[j]) * phase;
+                x[j] = value.real();
+                imaginary[j] = value.imag();
+            }
+        }
+
+        // the residual of the complex Ritz pair, (A - lambda * I) * (x + i * y), whose real part is kept
+        MyBLAS::multiplyInto(A, x, Ax);
+        solution.residual = MyBLAS::Vector<T>(n, 0);
+        solution.residual_infinite_norm = 0;
+        if (lambda.imag() == 0) {
+            const T norm = std::sqrt(x * x);
+            for (size_t j = 0; j < n; j++) {
+                x[j] /= norm;
+                solution.residual[j] = Ax[j] / norm - lambda.real() * x[j];
+                solution.residual_infinite_norm = std::max(solution.residual_infinite_norm, std::abs(solution.residual[j]));
+            }
+        } else {
+            MyBLAS::multiplyInto(A, imaginary, Ay);
+            for (size_t j = 0; j < n; j++) {
+                solution.residual[j] = Ax[j] - lambda.real() * x[j] + lambda.imag() * imaginary[j];
+                const T residualImaginary = Ay[j] - lambda.real() * imaginary[j] - lambda.imag() * x[j];
+                solution.residual_infinite_norm = std::max(solution.residual_infinite_norm,
+                                                           std::hypot(solution.residual[j], residualImaginary));
+            }
+        }
+        solutions.push_back(std::move(solution));
+    }
+    return solutions;
+}
+
+} // namespace Krylov
+
+/**
+ * @brief Finds k eigenpairs of a general square matrix with the implicitly restarted Arnoldi method.
+ *
+ * Complex eigenvalues come in conjugate pairs. For these, the eigenvalue holds the real part and eigenvalue_imaginary
+ * the imaginary part, x holds the real part of the eigenvector (scaled so that its largest component is real), and the
+ * residual infinite norm is that of the complex residual.
+ *
+ * @param A The matrix, any type that MyBLAS::multiplyInto accepts, so dense, lazy, sparse and matrix-free all work.
+ * @param k The number of eigenpairs.
+ * @param max_iterations The maximum number of matrix-vector products, checked before each restart.
+ * @param tolerance The convergence threshold on the Ritz estimate of each residual norm, relative to |eigenvalue|.
+ * @param target The part of the spectrum to converge to. The smallest eigenvalues converge more slowly than the largest.
+ * @param ncv The dimension of the Krylov space, at least k + 2. The default is max(2k + 1, 20).
+ * @param seed The seed of the random starting vector.
+ * @return The k eigenpairs in target order. Their iterations are the matrix-vector products in the Arnoldi process,
+ * their eigenvalue iterative error is the Ritz estimate, and their residuals are computed from A.
+ */
+template <template<typename> class MatrixType, typename T>
+std::vector<MyBLAS::Solver::Solution<T>> applyArnoldi(const MatrixType<T> &A, const size_t k,
+                                                      const size_t max_iterations, const T tolerance,
+                                                      const EigenvalueTarget target = TARGET_LARGEST_MAGNITUDE,
+                                                      const size_t ncv = 0, const size_t seed = 372) {
+    return Krylov::applyRestartedArnoldi(A, k, max_iterations, tolerance, target, ncv, seed, false);
+}
+
+/**
+ * @brief Finds k eigenpairs of a symmetric matrix with the implicitly restarted Lanczos method.
+ *
+ * The basis is kept fully orthogonal, so that no spurious copies of converged eigenvalues appear. All eigenvalues and
+ * eigenvectors are real.
+ *
+ * @param A The symmetric matrix, any type that MyBLAS::multiplyInto accepts.
+ * @param k The number of eigenpairs.
+ * @param max_iterations The maximum number of matrix-vector products, checked before each restart.
+ * @param tolerance The convergence threshold on the Ritz estimate of each residual norm, relative to |eigenvalue|.
+ * @param target The part of the spectrum to converge to.
+ * @param ncv The dimension of the Krylov space, at least k + 2. The default is max(2k + 1, 20).
+ * @param seed The seed of the random starting vector.
+ * @return The k eigenpairs in target order, as for applyArnoldi.
+ */
+template <template<typename> class MatrixType, typename T>
+std::vector<MyBLAS::Solver::Solution<T>> applyLanczos(const MatrixType<T> &A, const size_t k,
+                                                      const size_t max_iterations, const T tolerance,
+                                                      const EigenvalueTarget target = TARGET_LARGEST_MAGNITUDE,
+                                                      const size_t ncv = 0, const size_t seed = 372) {
+    return Krylov::applyRestartedArnoldi(A, k, max_iterations, tolerance, target, ncv, seed, true);
+}
+
+} // namespace MyRelaxationMethod
+
+#endif // NE591_008_KRYLOVEIGENSOLVERS_H
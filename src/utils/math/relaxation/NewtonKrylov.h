@@ -0,0 +1,181 @@
+/**
+ * @file NewtonKrylov.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief This file contains a Jacobian-free Newton-Krylov solver for systems of nonlinear equations F(u) = 0.
+ *
+ * Each Newton step solves J(u) * s = -F(u) with GMRES, where the Jacobian is never formed. GMRES only needs J * v,
+ * which is approximated by a forward difference of F along v. The linear solves are inexact, with the Eisenstat-Walker
+ * forcing terms, so that early Newton steps, which are far from the root, are cheap, and the solve tightens as the
+ * convergence of Newton becomes superlinear. A backtracking line search on ||F|| keeps the steps from overshooting.
+ */
+
+#ifndef NE591_008_NEWTONKRYLOV_H
+#define NE591_008_NEWTONKRYLOV_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "math/blas/solver/LinearSolver.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/GMRES.h"
+#include "math/relaxation/RelaxationMethods.h"
+
+namespace MyRelaxationMethod {
+
+/**
+ * @class JacobianOperator
+ * @brief The Jacobian of F at u, as a matrix-free operator, with J(u) * v = (F(u + e * v) - F(u)) / e.
+ * @details The difference step e = sqrt(eps) * (1 + ||u||) / ||v|| balances the truncation error of the difference
+ * against the rounding error in F. The operator keeps references to u and F(u), which must outlive it.
+ * @tparam T The type of the elements.
+ */
+template <typename T> class JacobianOperator {
+
+  public:
+    using Residual = std::function<void(const MyBLAS::Vector<T> &, MyBLAS::Vector<T> &)>;
+
+    /**
+     * @param _F The residual function, called as F(u, Fu).
+     * @param _u The point the Jacobian is taken at.
+     * @param _Fu The residual F(u), already evaluated.
+     */
+    JacobianOperator(Residual _F, const MyBLAS::Vector<T> &_u, const MyBLAS::Vector<T> &_Fu)
+        : F(std::move(_F)), u(_u), Fu(_Fu), uNorm(std::sqrt(_u * _u)), shifted(_u.size(), 0) {}
+
+    [[nodiscard]] size_t getRows() const { return u.size(); }
+
+    [[nodiscard]] size_t getCols() const { return u.size(); }
+
+    /**
+     * @brief y = J(u) * v, at the cost of one evaluation of F.
+     */
+    void apply(const MyBLAS::Vector<T> &v, MyBLAS::Vector<T> &y) const {
+        const size_t n = u.size();
+        const T vNorm = std::sqrt(v * v);
+        if (!(vNorm > 0)) {
+            for (size_t i = 0; i < n; i++) {
+                y[i] = 0;
+            }
+            return;
+        }
+        const T e = std::sqrt(std::numeric_limits<T>::epsilon()) * (1 + uNorm) / vNorm;
+        for (size_t i = 0; i < n; i++) {
+            shifted[i] = u[i] + e * v[i];
+        }
+        F(shifted, y);
+        for (size_t i = 0; i < n; i++) {
+            y[i] = (y[i] - Fu[i]) / e;
+        }
+    }
+
+  private:
+    Residual F;
+    const MyBLAS::Vector<T> &u;
+    const MyBLAS::Vector<T> &Fu;
+    T uNorm;
+    mutable MyBLAS::Vector<T> shifted;
+};
+
+/**
+ * @brief Solves F(u) = 0 with Jacobian-free Newton-Krylov, starting from an initial guess.
+ *
+ * The forcing term is Eisenstat-Walker choice 2, eta_k = 0.9 * (||F_k|| / ||F_k-1||)^2, safeguarded so that it does not
+ * drop too fast while the convergence is still linear, capped at 0.9, and kept above 0.5 * tolerance / ||F_k|| so that
+ * the last step does not oversolve. The line search backtracks with a safeguarded quadratic model of ||F||^2 until
+ * ||F|| decreases by the Armijo condition.
+ *
+ * @param F The residual function, called as F(u, Fu) with Fu already sized.
+ * @param initial The initial guess.
+ * @param max_iterations The maximum number of Newton steps.
+ * @param tolerance The convergence threshold on the largest absolute residual.
+ * @param max_linear_iterations The maximum number of GMRES iterations per Newton step.
+ * @param restart The restart length of GMRES.
+ * @return The solution. Its iterations are the Newton steps, and its iterative error is the largest absolute residual.
+ */
+template <typename T, typename Residual>
+MyBLAS::Solver::Solution<T> applyNewtonKrylov(Residual &&F, const MyBLAS::Vector<T> &initial,
+                                              const size_t max_iterations, const T tolerance,
+                                              const size_t max_linear_iterations = 1000, const size_t restart = 30) {
+    const size_t n = initial.size();
+    MyBLAS::Solver::Solution<T> results(n);
+    results.method = METHOD_NEWTON;
+    results.iterations = 0;
+    auto &u = results.x;
+    u = initial;
+
+    const auto maxNorm = [n](const MyBLAS::Vector<T> &v) {
+        T value = 0;
+        for (size_t i = 0; i < n; i++) {
+            value = std::max(value, std::abs(v[i]));
+        }
+        return value;
+    };
+
+    const T etaMax = static_cast<T>(0.9);
+    const T gamma = static_cast<T>(0.9);
+    const T armijo = static_cast<T>(1e-4);
+    const size_t max_backtracks = 20;
+
+    MyBLAS::Vector<T> Fu(n, 0), minusFu(n, 0), trial(n, 0), Ftrial(n, 0);
+    F(u, Fu);
+    T norm = std::sqrt(Fu * Fu);
+    T eta = static_cast<T>(0.5);
+
+    while (maxNorm(Fu) > tolerance && results.iterations < max_iterations) {
+        for (size_t i = 0; i < n; i++) {
+            minusFu[i] = -Fu[i];
+        }
+        const JacobianOperator<T> J(F, u, Fu);
+        const auto step = applyGMRES(J, minusFu, max_linear_iterations, eta * norm, restart);
+        const auto &s = step.x;
+
+        // backtrack along s until ||F|| has dropped enough
+        T lambda = 1;
+        T trialNorm = norm;
+        bool accepted = false;
+        for (size_t backtracks = 0; backtracks <= max_backtracks; backtracks++) {
+            for (size_t i = 0; i < n; i++) {
+                trial[i] = u[i] + lambda * s[i];
+            }
+            F(trial, Ftrial);
+            trialNorm = std::sqrt(Ftrial * Ftrial);
+            if (trialNorm <= (1 - armijo * lambda * (1 - eta)) * norm) {
+                accepted = true;
+                break;
+            }
+            // minimizer of the quadratic through ||F(u)||^2, its slope -2||F(u)||^2, and ||F(u + lambda s)||^2
+            const T f0 = norm * norm;
+            const T model = f0 * lambda * lambda / (trialNorm * trialNorm - f0 + 2 * f0 * lambda);
+            lambda = std::clamp(model, lambda / 10, lambda / 2);
+        }
+        if (!accepted) {
+            break;
+        }
+
+        u = trial;
+        Fu = Ftrial;
+        results.iterations++;
+
+        // Eisenstat-Walker choice 2, with its safeguards
+        const T previousEta = eta;
+        eta = gamma * (trialNorm / norm) * (trialNorm / norm);
+        if (gamma * previousEta * previousEta > static_cast<T>(0.1)) {
+            eta = std::max(eta, gamma * previousEta * previousEta);
+        }
+        eta = std::min(etaMax, std::max(eta, tolerance / (2 * trialNorm)));
+        norm = trialNorm;
+    }
+
+    results.iterative_error = maxNorm(Fu);
+    results.converged = (results.iterative_error <= tolerance);
+    return results;
+}
+
+} // namespace MyRelaxationMethod
+
+#endif // NE591_008_NEWTONKRYLOV_H
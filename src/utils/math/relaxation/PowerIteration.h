@@ -20,8 +20,12 @@
 #include "math/blas/Ops.h"
 
 #include "blas/solver/LinearSolver.h"
+#include "math/blas/solver/LinearSolverParams.h"
+#include "math/Random.h"
+#include "factorization/Factorization.h"
 #include "factorization/LUP.h"
 #include "math/relaxation/RelaxationMethods.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyRelaxationMethod
@@ -39,6 +43,7 @@ MyBLAS::Solver::Solution<T> applyPowerIteration(const MatrixType<T> &A, const si
     const size_t n = A.getRows();           // Get the number of rows in the matrix A
 
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("Power iteration");
 
     // Initialize x with a randomly sampled uniform dist between [-1, 1]
     results.x = Random::generate_vector(n, static_cast<T>(-1), static_cast<T>(1), seed);
@@ -50,17 +55,20 @@ MyBLAS::Solver::Solution<T> applyPowerIteration(const MatrixType<T> &A, const si
 
     for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
         // Calculate the matrix-by-vector product A * b_k
+        PROFILE_ZONE_NAMED(matvecZone, "Power iteration matvec");
         VectorType<T> b_k1 = A * results.x;
+        PROFILE_ZONE_STOP(matvecZone);
+
+        // Estimate the eigenvalue using the Rayleigh Quotient (bk)^T * A * bk, reusing A * bk before it is normalized
+        T new_eigenvalue = results.x * b_k1;
 
         // Calculate the norm of the new vector
+        PROFILE_ZONE_NAMED(normalizeZone, "Power iteration normalize");
         norm = std::sqrt(b_k1 * b_k1);
 
         // Normalize the vector
         b_k1 = b_k1 * (static_cast<T>(1) / norm);
-
-        // Estimate the eigenvalue using the Rayleigh Quotient
-        // T new_eigenvalue_1 = results.x * b_k1;
-        T new_eigenvalue = results.x * (A * results.x);  // Compute (bk)^T * A * bk
+        PROFILE_ZONE_STOP(normalizeZone);
 
         // Check for convergence
         results.iterative_error = std::abs(new_eigenvalue - results.eigenvalue);
@@ -82,12 +90,13 @@ MyBLAS::Solver::Solution<T> applyPowerIteration(const MatrixType<T> &A, const si
 }
 
 template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
-MyBLAS::Solver::Solution<T> applyDirectPowerIteration(const MyBLAS::Solver::Parameters<T> &params) {
+MyBLAS::Solver::Solution<T> applyDirectPowerIteration(const MyBLAS::Solver::TemplatedParameters<MatrixType, VectorType, T> &params) {
 
     const size_t n = params.coefficients.getRows();           // Get the number of rows in the matrix A
 
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
     results.method = METHOD_DIRECT_POWER_ITERATION;
+    PROFILE_ZONE("Direct power iteration");
 
     // Initialize x with a randomly sampled uniform dist between [-1, 1]
     results.x = params.initial_guess;
@@ -96,13 +105,17 @@ MyBLAS::Solver::Solution<T> applyDirectPowerIteration(const MyBLAS::Solver::Para
 
     for (results.iterations = 0; results.iterations < params.max_iterations; ++(results.iterations)) {
         // Calculate the matrix-by-vector product A * x
+        PROFILE_ZONE_NAMED(matvecZone, "Direct power iteration matvec");
         const VectorType<T> y = params.coefficients * results.x;
+        PROFILE_ZONE_STOP(matvecZone);
 
         // Calculate the norm of the new vector
+        PROFILE_ZONE_NAMED(normalizeZone, "Direct power iteration normalize");
         const T norm = std::sqrt(y * y);
 
         // Normalize and update the vector
         results.x = y * (static_cast<T>(1) / norm);
+        PROFILE_ZONE_STOP(normalizeZone);
 
         // Estimate the eigenvalue using the direct method
         const T new_eigenvalue = norm;
@@ -124,6 +137,7 @@ MyBLAS::Solver::Solution<T> applyDirectPowerIteration(const MyBLAS::Solver::Para
     }
 
     // Calculate the residual
+    PROFILE_ZONE("Power iteration residual");
     results.residual = params.coefficients * results.x - results.eigenvalue * results.x;
 
     // Calculate the infinity norm of the residual
@@ -135,30 +149,37 @@ MyBLAS::Solver::Solution<T> applyDirectPowerIteration(const MyBLAS::Solver::Para
 }
 
 template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
-MyBLAS::Solver::Solution<T> applyRayleighQuotientPowerIteration(const MyBLAS::Solver::Parameters<T> &params) {
+MyBLAS::Solver::Solution<T> applyRayleighQuotientPowerIteration(const MyBLAS::Solver::TemplatedParameters<MatrixType, VectorType, T> &params) {
 
     const size_t n = params.coefficients.getRows();           // Get the number of rows in the matrix A
 
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
     results.method = METHOD_RAYLEIGH_QUOTIENT_POWER_ITERATION;
+    PROFILE_ZONE("Rayleigh quotient power iteration");
 
     // Initialize x with a randomly sampled uniform dist between [-1, 1]
     results.x = params.initial_guess;
     results.converged = false;
     results.iterative_error = std::numeric_limits<T>::max(); // Initialize the error as the maximum
 
-    for (results.iterations = 0; results.iterations < params.max_iterations; ++(results.iterations)) {
-        // Calculate the matrix-by-vector product A * x
-        const VectorType<T> y = params.coefficients * results.x;
+    // The matrix-by-vector product A * x, which is carried over from the Rayleigh quotient of one iteration to the
+    // power step of the next, so that each iteration costs a single product
+    VectorType<T> y = params.coefficients * results.x;
 
+    for (results.iterations = 0; results.iterations < params.max_iterations; ++(results.iterations)) {
         // Calculate the norm of the new vector
+        PROFILE_ZONE_NAMED(normalizeZone, "Rayleigh quotient power iteration normalize");
         const T norm = std::sqrt(y * y);
 
         // Normalize and update the vector
         results.x = y * (static_cast<T>(1) / norm);
+        PROFILE_ZONE_STOP(normalizeZone);
 
         // Estimate the eigenvalue using the Rayleigh Quotient
-        const T new_eigenvalue = results.x * (params.coefficients * results.x); // Compute (x)^T * A * x
+        PROFILE_ZONE_NAMED(matvecZone, "Rayleigh quotient power iteration matvec");
+        y = params.coefficients * results.x;
+        const T new_eigenvalue = results.x * y; // Compute (x)^T * A * x
+        PROFILE_ZONE_STOP(matvecZone);
 
         // compute the change in eigenvalue
         results.eigenvalue_iterative_error = std::abs(new_eigenvalue - results.eigenvalue);
@@ -176,8 +197,8 @@ MyBLAS::Solver::Solution<T> applyRayleighQuotientPowerIteration(const MyBLAS::So
         }
     }
 
-    // Calculate the residual
-    results.residual = params.coefficients * results.x - results.eigenvalue * results.x;
+    // Calculate the residual, where y already holds A * x
+    results.residual = y - results.eigenvalue * results.x;
 
     // Calculate the infinity norm of the residual
     results.residual_infinite_norm = std::abs(*std::max_element(results.residual.begin(), results.residual.end(), [](T a, T b) {
@@ -187,43 +208,105 @@ MyBLAS::Solver::Solution<T> applyRayleighQuotientPowerIteration(const MyBLAS::So
     return results;
 }
 
+/**
+ * @brief The number of times a singular shift is perturbed before the inverse power iteration gives up.
+ */
+constexpr size_t MaxShiftPerturbations = 3;
+
+/**
+ * @brief Shifted inverse power iteration, converging to the eigenpair whose eigenvalue is closest to the shift.
+ *
+ * The shifted matrix (A - mu * I) is factorized once, so each iteration is a pair of O(n^2) triangular solves against
+ * the held factors rather than a fresh O(n^3) factorization. The shift starts at the parameters' eigenvalue guess.
+ *
+ * If the shifted matrix is singular, the shift is perturbed by a relative sqrt(epsilon) up to MaxShiftPerturbations
+ * times. If it is still singular, the returned solution is not converged, and holds the initial guess.
+ *
+ * @param params The coefficients, eigenvalue guess (the initial shift), threshold and iteration limit.
+ * @param shiftUpdateInterval If non-zero, the shift is moved to the current Rayleigh quotient every this many
+ * iterations and the shifted matrix is refactorized. With the default of zero the shift stays fixed and the matrix
+ * is factorized exactly once.
+ */
 template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
-MyBLAS::Solver::Solution<T> applyInversePowerIteration(const MyBLAS::Solver::Parameters<T> &params) {
-    const auto A = params.getCoefficients();
+MyBLAS::Solver::Solution<T> applyInversePowerIteration(const MyBLAS::Solver::Parameters<T> &params, const size_t shiftUpdateInterval = 0) {
+    const auto &A = params.getCoefficients();
     const size_t n = A.getRows(); // Assuming A is square
     MyBLAS::Solver::Solution<T> results(n);
+    results.method = METHOD_INVERSE_POWER_ITERATION;
+    PROFILE_ZONE("Inverse power iteration");
     results.x = VectorType<T>(n, 1); // Initialize x with ones
     results.eigenvalue = params.getEigenValue();
     results.converged = false;
+    results.iterative_error = std::numeric_limits<T>::max(); // Initialize the error as the maximum
 
-    MatrixType<T> I = MatrixType<T>::eye(n); // Create an identity matrix of the same size as A
-
+    // Factorize (A - mu * I) in place of a copy of A, without forming the identity
+    const auto shifted = [&A, n](const T mu) {
+        MyBLAS::Matrix<T> A_shifted(A);
+        for (size_t i = 0; i < n; i++) {
+            A_shifted[i][i] -= mu;
+        }
+        return A_shifted;
+    };
+    MyFactorizationMethod::Factorization<T> factorization;
+    PROFILE_ZONE_NAMED(factorizeZone, "Inverse power iteration factorize");
+    // A shift that is exactly an eigenvalue makes the shifted matrix singular, so it is nudged away from it a few times,
+    // which still converges to the eigenpair closest to the guess
+    const T perturbation = std::sqrt(std::numeric_limits<T>::epsilon()) * std::max(std::abs(results.eigenvalue), static_cast<T>(1));
+    bool nonsingular = factorization.factorize(shifted(results.eigenvalue));
+    for (size_t attempt = 1; !nonsingular && attempt <= MaxShiftPerturbations; attempt++) {
+        nonsingular = factorization.factorize(shifted(results.eigenvalue + static_cast<T>(attempt) * perturbation));
+    }
+    PROFILE_ZONE_STOP(factorizeZone);
+    if (!nonsingular) {
+        std::cerr << "Inverse power iteration: the shifted matrix is singular, even with a perturbed shift\n";
+        results.iterations = 0;
+        return results;
+    }
 
     for (results.iterations = 0; results.iterations < params.max_iterations; ++(results.iterations)) {
-        // Shift the matrix A by mu
-        MatrixType<T> A_shifted = A - I * results.eigenvalue;
-
-        // Solve (A - mu * I) * y = bk for y
-        VectorType<T> y = MyBLAS::LUP::applyLUP(A_shifted, results.x, params.convergence_threshold).x;
+        // Solve (A - mu * I) * y = x for y, overwriting x
+        PROFILE_ZONE_NAMED(solveZone, "Inverse power iteration solve");
+        factorization.solveInPlace(results.x);
+        PROFILE_ZONE_STOP(solveZone);
+
+        // Normalize y to obtain the next iterate
+        PROFILE_ZONE_NAMED(normalizeZone, "Inverse power iteration normalize");
+        const T norm = std::sqrt(results.x * results.x);
+        results.x = results.x * (static_cast<T>(1) / norm);
+        PROFILE_ZONE_STOP(normalizeZone);
+
+        // Update the eigenvalue estimate to the Rayleigh quotient of the normalized iterate with respect to A
+        PROFILE_ZONE_NAMED(matvecZone, "Inverse power iteration matvec");
+        const T new_eigenvalue = results.x * (A * results.x);
+        PROFILE_ZONE_STOP(matvecZone);
 
-        // Normalize y to obtain the next iterate bk+1
-        const T norm = std::sqrt(y * y);
-        VectorType<T> bk_next = y * (1.0 / norm);
+        // compute the change in eigenvalue
+        results.eigenvalue_iterative_error = std::abs(new_eigenvalue - results.eigenvalue);
 
-        // Update mu to the Rayleigh quotient of bk+1 with respect to A
-        const T mu_next = (bk_next * (A * bk_next)) / (bk_next * bk_next);
+        // Update the eigenvalue
+        results.eigenvalue = new_eigenvalue;
 
-        results.x = bk_next;
-        results.eigenvalue = mu_next;
+        // compute the relative change (by normalizing)
+        results.iterative_error = (results.eigenvalue != static_cast<T>(0)) ? results.eigenvalue_iterative_error / std::abs(results.eigenvalue) : std::numeric_limits<T>::max();
 
-        // Check for convergence
-        if (std::abs(mu_next - results.eigenvalue) < params.convergence_threshold) {
+        // check for convergence against the set threshold
+        if (results.iterative_error < params.convergence_threshold) {
             results.converged = true;
             break;
         }
+
+        // Optionally move the shift to the Rayleigh quotient, keeping the old factors if the new shift is singular
+        if (shiftUpdateInterval != 0 && (results.iterations + 1) % shiftUpdateInterval == 0) {
+            PROFILE_ZONE("Inverse power iteration refactorize");
+            MyFactorizationMethod::Factorization<T> refactored;
+            if (refactored.factorize(shifted(results.eigenvalue))) {
+                factorization = std::move(refactored);
+            }
+        }
     }
 
     // Calculate the residual
+    PROFILE_ZONE("Power iteration residual");
     results.residual = params.coefficients * results.x - results.eigenvalue * results.x;
 
     // Calculate the infinity norm of the residual
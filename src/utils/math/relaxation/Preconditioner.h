@@ -0,0 +1,87 @@
+/**
+ * @file Preconditioner.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Detection trait for preconditioners, and the identity and Jacobi preconditioners.
+ * @details A preconditioner is any type M with a member apply(r, z), which writes an approximation of A^-1 * r into
+ * the caller-owned vector z. The preconditioned solvers accept any such type, so the diagonal preconditioner below,
+ * MyFactorizationMethod::IncompleteLU, MyFactorizationMethod::IncompleteCholesky, and a multigrid cycle are all
+ * interchangeable. For conjugate gradient, M^-1 must also be symmetric positive definite.
+ */
+
+#ifndef NE591_008_PRECONDITIONER_H
+#define NE591_008_PRECONDITIONER_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/vector/Vector.h"
+
+namespace MyRelaxationMethod {
+
+/**
+ * @brief Detects whether PreconditionerType can be applied to a VectorType residual, through a member apply(r, z).
+ * @tparam PreconditionerType The preconditioner type to inspect.
+ * @tparam VectorType The vector type of r and z.
+ */
+template <typename PreconditionerType, typename VectorType, typename = void>
+struct is_preconditioner : std::false_type {};
+
+template <typename PreconditionerType, typename VectorType>
+struct is_preconditioner<PreconditionerType, VectorType, std::void_t<decltype(std::declval<PreconditionerType &>().apply(std::declval<const VectorType &>(), std::declval<VectorType &>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Convenience variable template for is_preconditioner.
+ */
+template <typename PreconditionerType, typename VectorType>
+inline constexpr bool is_preconditioner_v = is_preconditioner<PreconditionerType, VectorType>::value;
+
+/**
+ * @class IdentityPreconditioner
+ * @brief z = r, with which preconditioned CG reduces to plain CG.
+ */
+template <typename T>
+struct IdentityPreconditioner {
+    template <template<typename> class VectorType>
+    void apply(const VectorType<T> &r, VectorType<T> &z) const {
+        z = r;
+    }
+};
+
+/**
+ * @class JacobiPreconditioner
+ * @brief z = D^-1 * r, where D is the diagonal of A.
+ * @details This only helps when the diagonal varies across the rows. For the diffusion matrix, whose diagonal is
+ * constant, it just rescales the residual.
+ */
+template <typename T>
+class JacobiPreconditioner {
+  public:
+    template <template<typename> class MatrixType>
+    explicit JacobiPreconditioner(const MatrixType<T> &A) : inverseDiagonal(A.getRows(), 0) {
+        const size_t n = A.getRows();
+        for (size_t i = 0; i < n; i++) {
+            inverseDiagonal[i] = static_cast<T>(1) / MyBLAS::diagonalEntry(A, i);
+        }
+    }
+
+    template <template<typename> class VectorType>
+    void apply(const VectorType<T> &r, VectorType<T> &z) const {
+        const size_t n = r.size();
+        const auto &d = inverseDiagonal;
+        #pragma omp parallel for simd default(none) shared(r, z, d, n)
+        for (size_t i = 0; i < n; i++) {
+            z[i] = d[i] * r[i];
+        }
+    }
+
+  private:
+    MyBLAS::Vector<T> inverseDiagonal;
+};
+
+} // namespace MyRelaxationMethod
+
+#endif // NE591_008_PRECONDITIONER_H
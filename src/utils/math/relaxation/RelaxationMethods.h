@@ -27,11 +27,19 @@ enum Type {
     METHOD_SSOR,
     METHOD_CONJUGATE_GRADIENT,
     METHOD_PRECONDITIONED_CONJUGATE_GRADIENT,
+    METHOD_PIPELINED_CONJUGATE_GRADIENT,
+    METHOD_MULTIGRID,
+    METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT,
+    METHOD_INCOMPLETE_CHOLESKY_CONJUGATE_GRADIENT,
+    METHOD_INCOMPLETE_LU_CONJUGATE_GRADIENT,
     METHOD_DIRECT_POWER_ITERATION,
     METHOD_RAYLEIGH_QUOTIENT_POWER_ITERATION,
     METHOD_INVERSE_POWER_ITERATION,
     METHOD_FIXED_POINT,
-    METHOD_NEWTON
+    METHOD_NEWTON,
+    METHOD_GMRES,
+    METHOD_LANCZOS,
+    METHOD_ARNOLDI
 };
 
 /**
@@ -42,7 +50,7 @@ enum Type {
  * @param value The value of the Type enum.
  * @return The key of the relaxation method type as a string.
  */
-const char *TypeKey(MyRelaxationMethod::Type value) {
+inline const char *TypeKey(MyRelaxationMethod::Type value) {
     static const char *relaxationMethodTypeKeys[] = {
         "point-jacobi",
         "SORPJ",
@@ -52,11 +60,19 @@ const char *TypeKey(MyRelaxationMethod::Type value) {
         "SSOR",
         "conjugate-gradient",
         "preconditioned-conjugate-gradient",
+        "pipelined-conjugate-gradient",
+        "multigrid",
+        "multigrid-preconditioned-conjugate-gradient",
+        "incomplete-cholesky-conjugate-gradient",
+        "incomplete-LU-conjugate-gradient",
         "direct-eigenvalue-power-iteration",
         "rayleigh-eigenvalue-power-iteration",
         "inverse-power-iteration",
         "fixed-point",
-        "newton"
+        "newton",
+        "GMRES",
+        "lanczos",
+        "arnoldi"
     };
     return relaxationMethodTypeKeys[static_cast<int>(value)];
 }
@@ -12,8 +12,10 @@
 #include "math/blas/BLAS.h"
 #include "math/blas/Ops.h"
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
 #include "math/blas/vector/Vector.h"
 #include "utils/math/blas/solver/LinearSolver.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyRelaxationMethod
@@ -38,6 +40,7 @@ MyBLAS::Solver::Solution<T> applySORSerial(const MatrixType<T> &A, const VectorT
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("SOR");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
@@ -45,7 +48,9 @@ MyBLAS::Solver::Solution<T> applySORSerial(const MatrixType<T> &A, const VectorT
     // Start the iteration
     for (results.iterations = 0; results.iterations < max_iterations; (results.iterations)++) {
 
+        PROFILE_ZONE_NAMED(copyZone, "SOR copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -53,21 +58,19 @@ MyBLAS::Solver::Solution<T> applySORSerial(const MatrixType<T> &A, const VectorT
             break;
         }
 
+        PROFILE_ZONE_NAMED(sweepZone, "SOR sweep");
         // For each row in the matrix
         for (size_t row = 0; row < n; row++) {
-            // subtract the contribution from the diagonal term, since it should not be counted.
-            T sum = -(A[row][row] * results.x[row]);
-            // For each column in the matrix, add the product of the matrix element and corresponding element in the
-            // solution vector to the sum
-            for (size_t col = 0; col < n; col++) {
-                sum += A[row][col] * results.x[col];
-            }
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
             // Update the solution vector with the new value, including the relaxation factor
-            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
+        PROFILE_ZONE_STOP(sweepZone);
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "SOR L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
     }
 
     // Calculate the final error as the square root of the squared error
@@ -81,13 +84,16 @@ MyBLAS::Solver::Solution<T> applySOR(const MatrixType<T> &A, const VectorType<T>
                                              const T relaxation_factor = 1, const size_t threads = 1) {
     const size_t n = A.getRows(); // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("SOR red-black");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
 
     // Start the iteration
     for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        PROFILE_ZONE_NAMED(copyZone, "SOR red-black copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -95,38 +101,46 @@ MyBLAS::Solver::Solution<T> applySOR(const MatrixType<T> &A, const VectorType<T>
             break;
         }
 
+        PROFILE_ZONE_NAMED(redZone, "SOR red-black red sweep");
         // Update red elements
-        #pragma omp parallel for num_threads(threads) default(none) shared(results, A, b, old_x)
+        #pragma omp parallel for num_threads(threads) default(none) shared(results, A, b, old_x, n, relaxation_factor)
         for (size_t row = 0; row < n; row++) {
             T sum = T();
-            for (size_t col = 0; col < n; col++) {
+            MyBLAS::forEachNonZeroInRow(A, row, [&](const size_t col, const T value) {
                 if ((row + col) % 2 == 0) { // Red elements when row+col is even
-                    sum += A[row][col] * old_x[col];
+                    sum += value * old_x[col];
                 }
-            }
+            });
             if ((row + row) % 2 == 0) { // Update only red elements
+                const T diagonal = MyBLAS::diagonalEntry(A, row);
                 results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] +
-                                 (relaxation_factor / A[row][row]) * (b[row] - sum + A[row][row] * old_x[row]);
+                                 (relaxation_factor / diagonal) * (b[row] - sum + diagonal * old_x[row]);
             }
         }
+        PROFILE_ZONE_STOP(redZone);
 
+        PROFILE_ZONE_NAMED(blackZone, "SOR red-black black sweep");
         // Update black elements
-        #pragma omp parallel for num_threads(threads) default(none) shared(results, A, b, old_x)
+        #pragma omp parallel for num_threads(threads) default(none) shared(results, A, b, old_x, n, relaxation_factor)
         for (size_t row = 0; row < n; row++) {
             T sum = T();
-            for (size_t col = 0; col < n; col++) {
+            MyBLAS::forEachNonZeroInRow(A, row, [&](const size_t col, const T value) {
                 if ((row + col) % 2 == 1) { // Black elements when row+col is odd
-                    sum += A[row][col] * results.x[col]; // Use updated red elements
+                    sum += value * results.x[col]; // Use updated red elements
                 }
-            }
+            });
             if ((row + row) % 2 == 1) { // Update only black elements
+                const T diagonal = MyBLAS::diagonalEntry(A, row);
                 results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] +
-                                 (relaxation_factor / A[row][row]) * (b[row] - sum + A[row][row] * old_x[row]);
+                                 (relaxation_factor / diagonal) * (b[row] - sum + diagonal * old_x[row]);
             }
         }
+        PROFILE_ZONE_STOP(blackZone);
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "SOR red-black L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
     }
 
     // Calculate the final error as the square root of the squared error
@@ -141,6 +155,7 @@ MyBLAS::Solver::Solution<T> applySORBlockParallel(const MatrixType<T> &A, const
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n);        // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("SOR block");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max();          // Initialize the squared error as the maximum
@@ -149,7 +164,9 @@ MyBLAS::Solver::Solution<T> applySORBlockParallel(const MatrixType<T> &A, const
     for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
 
         //std::cout<<results.iterations<<" of "<<max_iterations<<" :: "<<iterative_error_squared<<" : "<<tolerance_squared<<std::endl;
+        PROFILE_ZONE_NAMED(copyZone, "SOR block copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -157,25 +174,23 @@ MyBLAS::Solver::Solution<T> applySORBlockParallel(const MatrixType<T> &A, const
             break;
         }
 
+        PROFILE_ZONE_NAMED(sweepZone, "SOR block sweep");
         // Parallel block-wise update
-        #pragma omp parallel num_threads(threads) default(none) shared(A, b, results, old_x)
+        #pragma omp parallel num_threads(threads) default(none) shared(A, b, results, old_x, n, relaxation_factor)
         {
             #pragma omp for schedule(static)
             for (size_t row = 0; row < n; row++) {
-                // subtract the contribution from the diagonal term, since it should not be counted.
-                T sum = -(A[row][row] * results.x[row]);
-                // For each column in the matrix, add the product of the matrix element and corresponding element in the
-                // solution vector to the sum
-                for (size_t col = 0; col < n; col++) {
-                    sum += A[row][col] * results.x[col];
-                }
+                const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
                 // Update the solution vector with the new value, including the relaxation factor
-                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
             }
         }
+        PROFILE_ZONE_STOP(sweepZone);
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "SOR block L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
     }
 
     // Calculate the final error as the square root of the squared error
@@ -189,6 +204,7 @@ MyBLAS::Solver::Solution<T> applyPSOR(const MatrixType<T> &A, const VectorType<T
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("PSOR");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
@@ -196,17 +212,16 @@ MyBLAS::Solver::Solution<T> applyPSOR(const MatrixType<T> &A, const VectorType<T
     // Start the iteration
     for (results.iterations = 0; results.iterations < max_iterations; (results.iterations)++) {
 
+        PROFILE_ZONE_NAMED(copyZone, "PSOR copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
 // Update red points
 #pragma omp parallel for schedule(static)
         for (size_t row = 0; row < n; row++) {
             if ((row % 2) == 0) { // Red points: row index is even
-                T sum = -(A[row][row] * results.x[row]);
-                for (size_t col = 0; col < n; col++) {
-                    sum += A[row][col] * results.x[col];
-                }
-                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+                const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
+                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
             }
         }
 
@@ -216,16 +231,15 @@ MyBLAS::Solver::Solution<T> applyPSOR(const MatrixType<T> &A, const VectorType<T
 #pragma omp parallel for schedule(static)
         for (size_t row = 0; row < n; row++) {
             if ((row % 2) == 1) { // Black points: row index is odd
-                T sum = -(A[row][row] * results.x[row]);
-                for (size_t col = 0; col < n; col++) {
-                    sum += A[row][col] * results.x[col];
-                }
-                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+                const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
+                results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
             }
         }
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "PSOR L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -245,6 +259,7 @@ MyBLAS::Solver::Solution<T> applyP2SOR(const MatrixType<T> &A, const VectorType<
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("P2SOR");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
@@ -252,18 +267,15 @@ MyBLAS::Solver::Solution<T> applyP2SOR(const MatrixType<T> &A, const VectorType<
     // Start the iteration
     for (results.iterations = 0; results.iterations < max_iterations; (results.iterations)++) {
 
+        PROFILE_ZONE_NAMED(copyZone, "P2SOR copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
 // Update the "red" points
 #pragma omp parallel for
         for (size_t row = 0; row < n; row += 2) { // Assuming red points are even-indexed
-            T sum = 0;
-            for (size_t col = 0; col < n; col++) {
-                if (col != row) {
-                    sum += A[row][col] * old_x[col];
-                }
-            }
-            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, old_x);
+            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
 
 // Synchronize after updating red points
@@ -272,17 +284,14 @@ MyBLAS::Solver::Solution<T> applyP2SOR(const MatrixType<T> &A, const VectorType<
 // Update the "black" points
 #pragma omp parallel for
         for (size_t row = 1; row < n; row += 2) { // Assuming black points are odd-indexed
-            T sum = 0;
-            for (size_t col = 0; col < n; col++) {
-                if (col != row) {
-                    sum += A[row][col] * results.x[col]; // Use the updated red values
-                }
-            }
-            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x); // Use the updated red values
+            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "P2SOR L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
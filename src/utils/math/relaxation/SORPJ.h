@@ -10,13 +10,16 @@
 
 #include <omp.h>
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
 #include "math/blas/vector/Vector.h"
 #include <cstddef>
 
 #include "math/blas/Ops.h"
 
+#include "math/relaxation/Anderson.h"
 #include "math/relaxation/RelaxationMethods.h"
 #include "utils/math/blas/solver/LinearSolver.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyRelaxationMethod
@@ -42,6 +45,9 @@ namespace MyRelaxationMethod {
  *        than 1, the new estimate is "dampened", or reduced, which can improve stability but may slow convergence.
  *        If the relaxation factor is greater than 1, the new estimate is "amplified", or increased, which can speed
  *        up convergence but may also cause the method to diverge if the factor is too large.
+ * @param threads The number of OpenMP threads for the sweep.
+ * @param anderson_depth If non-zero, each sweep is mixed with this many previous ones by Anderson acceleration, which
+ *        usually takes several times fewer sweeps, for O(n * anderson_depth) extra work per sweep.
  *
  * @return A Solution object containing the solution vector, the number of iterations performed, whether the method
  * converged, and the final error.
@@ -53,21 +59,26 @@ namespace MyRelaxationMethod {
 template <template<typename> class MatrixType, template<typename> class VectorType, typename T>
 MyBLAS::Solver::Solution<T> applyPointJacobi(const MatrixType<T> &A, const VectorType<T> &b,
                                                     const size_t max_iterations, const T tolerance,
-                                                    const T relaxation_factor = 1, const size_t threads = 1) {
+                                                    const T relaxation_factor = 1, const size_t threads = 1,
+                                                    const size_t anderson_depth = 0) {
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("Point Jacobi");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum
 
     VectorType<T> new_x(n, 0); // Initialize a new vector for the updated solution
+    AndersonAccelerator<T> anderson(n, anderson_depth);
 
     // Start the Point-Jacobi iteration
     for (results.iterations = 0; results.iterations < max_iterations; (results.iterations)++) {
 //        std::cout<<results.iterations<<" of "<<max_iterations<<" :: "<<iterative_error_squared<<" : "<<tolerance_squared<<std::endl;
         // Update the solution vector with the new values for this iteration step
+        PROFILE_ZONE_NAMED(copyZone, "Point Jacobi copy x");
         results.x = new_x;
+        PROFILE_ZONE_STOP(copyZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -75,21 +86,24 @@ MyBLAS::Solver::Solution<T> applyPointJacobi(const MatrixType<T> &A, const Vecto
             break;
         }
 
-        #pragma omp parallel for num_threads(threads) default(none) shared(results, new_x, A, b)
+        PROFILE_ZONE_NAMED(sweepZone, "Point Jacobi sweep");
+        #pragma omp parallel for num_threads(threads) default(none) shared(results, new_x, A, b, n, relaxation_factor)
         for (size_t row = 0; row < n; row++) {
-            // subtract the contribution from the diagonal term, since it should not be counted.
-            T sum = -(A[row][row] * results.x[row]);
-
-            // For each column in the matrix, add the product of the matrix element and corresponding element in the
-            // solution vector to the sum
-            for (size_t col = 0; col < n; col++) {
-                sum += A[row][col] * results.x[col];
-            }
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
             // Update the solution vector with the new value
-            new_x[row] = (static_cast<T>(1) - relaxation_factor) * results.x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            new_x[row] = (static_cast<T>(1) - relaxation_factor) * results.x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
+        PROFILE_ZONE_STOP(sweepZone);
 
+        PROFILE_ZONE_NAMED(checkZone, "Point Jacobi L2 check");
         iterative_error_squared = MyBLAS::L2(new_x, results.x, n);
+        PROFILE_ZONE_STOP(checkZone);
+
+        // Mix in the previous sweeps
+        if (anderson_depth > 0) {
+            PROFILE_ZONE("Point Jacobi Anderson mix");
+            anderson.mix(results.x, new_x, new_x);
+        }
     }
 
     // Calculate the final error as the square root of the squared error
@@ -12,8 +12,10 @@
 #include "math/blas/BLAS.h"
 #include "math/blas/Ops.h"
 #include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
 #include "math/blas/vector/Vector.h"
 #include "utils/math/blas/solver/LinearSolver.h"
+#include "utils/profiler/Zones.h"
 
 /**
  * @namespace MyRelaxationMethod
@@ -42,41 +44,38 @@ MyBLAS::Solver::Solution<T> applySSOR(const MatrixType<T> &A, const VectorType<T
 
     const size_t n = A.getRows();                  // Get the number of rows in the matrix A
     MyBLAS::Solver::Solution<T> results(n); // Initialize the results object with the size of the matrix
+    PROFILE_ZONE("SSOR");
 
     const T tolerance_squared = std::pow(tolerance, static_cast<T>(2)); // Calculate the square of the tolerance
     T iterative_error_squared = std::numeric_limits<T>::max(); // Initialize the squared error as the maximum possible value
 
     // Start the iteration
     for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        PROFILE_ZONE_NAMED(copyZone, "SSOR copy old_x");
         VectorType<T> old_x = results.x; // Save the old solution vector
+        PROFILE_ZONE_STOP(copyZone);
 
+        PROFILE_ZONE_NAMED(forwardZone, "SSOR forward sweep");
         // Forward sweep (like weighted Gauss-Seidel)
         for (size_t row = 0; row < n; row++) {
-            // subtract the contribution from the diagonal term, since it should not be counted.
-            T sum = -(A[row][row] * results.x[row]);
-            // For each column in the matrix, add the product of the matrix element and corresponding element in the
-            // solution vector to the sum
-            for (size_t col = 0; col < n; col++) {
-                sum += A[row][col] * results.x[col];
-            }
-            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
+            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
+        PROFILE_ZONE_STOP(forwardZone);
 
+        PROFILE_ZONE_NAMED(backwardZone, "SSOR backward sweep");
         // Backward sweep (like weighted Gauss-Seidel, but in reverse order)
         for (size_t rowPlusOne = n; rowPlusOne > 0; rowPlusOne--) {
             const size_t row = rowPlusOne - 1;
-            // subtract the contribution from the diagonal term, since it should not be counted.
-            T sum = -(A[row][row] * results.x[row]);
-            // For each column in the matrix, add the product of the matrix element and corresponding element in the
-            // solution vector to the sum
-            for (size_t col = 0; col < n; col++) {
-                sum += A[row][col] * results.x[col];
-            }
-            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / A[row][row]) * (b[row] - sum);
+            const T sum = MyBLAS::offDiagonalRowProduct(A, row, results.x);
+            results.x[row] = (static_cast<T>(1) - relaxation_factor) * old_x[row] + (relaxation_factor / MyBLAS::diagonalEntry(A, row)) * (b[row] - sum);
         }
+        PROFILE_ZONE_STOP(backwardZone);
 
         // Calculate the L2 norm of the difference between the new and old solution vectors
+        PROFILE_ZONE_NAMED(checkZone, "SSOR L2 check");
         iterative_error_squared = MyBLAS::L2(results.x, old_x, n);
+        PROFILE_ZONE_STOP(checkZone);
 
         // If the squared error is less than the squared tolerance, set the convergence flag to true and break the loop
         if (iterative_error_squared < tolerance_squared) {
@@ -0,0 +1,121 @@
+/**
+* @file AndersonTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for Anderson accelerated fixed point iteration, on its own and within Point
+* Jacobi.
+*/
+
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/Anderson.h"
+#include "math/relaxation/SORPJ.h"
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyRelaxationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(AndersonTests, NumericTypes);
+
+template <typename T>
+class AndersonTests : public ::testing::Test {
+  protected:
+    static MyPhysics::Diffusion::Params<T> makeParams() { return TestProblems::makeParams<T>(20, 15); }
+
+    static T tolerance() { return std::sqrt(std::numeric_limits<T>::epsilon()); }
+
+    /**
+     * @brief A contraction with a slowly decaying mode: x_i = (cos(x_i) / 10 + x_i-1 + x_i+1) / 2.1, with zero at the
+     * ends.
+     */
+    static void map(const MyBLAS::Vector<T> &x, MyBLAS::Vector<T> &Gx) {
+        const size_t n = x.size();
+        for (size_t i = 0; i < n; i++) {
+            const T left = i > 0 ? x[i - 1] : static_cast<T>(0);
+            const T right = i + 1 < n ? x[i + 1] : static_cast<T>(0);
+            Gx[i] = (std::cos(x[i]) / 10 + left + right) / static_cast<T>(2.1);
+        }
+    }
+};
+
+// With a depth of zero, the accelerated iteration is plain fixed point iteration, step for step
+TYPED_TEST(AndersonTests, ZeroDepthIsPicardTest) {
+    const size_t n = 40;
+    const MyBLAS::Vector<TypeParam> initial(n, 0);
+    const auto anderson = applyAndersonAcceleration(TestFixture::map, initial, 10000, TestFixture::tolerance(), 0);
+
+    MyBLAS::Vector<TypeParam> x = initial;
+    MyBLAS::Vector<TypeParam> Gx(n, 0);
+    size_t iterations = 0;
+    TypeParam error = std::numeric_limits<TypeParam>::max();
+    while (error > TestFixture::tolerance() && iterations < 10000) {
+        TestFixture::map(x, Gx);
+        iterations++;
+        error = 0;
+        for (size_t i = 0; i < n; i++) {
+            error = std::max(error, std::abs(Gx[i] - x[i]));
+        }
+        x = Gx;
+    }
+
+    EXPECT_TRUE(anderson.converged);
+    EXPECT_EQ(anderson.iterations, iterations);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(anderson.x[i], x[i]);
+    }
+}
+
+// Mixing the last few steps reaches the same fixed point in a fraction of the evaluations of the map
+TYPED_TEST(AndersonTests, NonlinearMapTest) {
+    const size_t n = 40;
+    const MyBLAS::Vector<TypeParam> initial(n, 0);
+    const auto picard = applyAndersonAcceleration(TestFixture::map, initial, 10000, TestFixture::tolerance(), 0);
+
+    for (const size_t depth : {3, 5, 10}) {
+        const auto anderson = applyAndersonAcceleration(TestFixture::map, initial, 10000, TestFixture::tolerance(), depth);
+        EXPECT_TRUE(anderson.converged);
+        EXPECT_EQ(anderson.method, MyBLAS::Solver::Type(METHOD_FIXED_POINT));
+        EXPECT_LE(2 * anderson.iterations, picard.iterations);
+
+        MyBLAS::Vector<TypeParam> Gx(n, 0);
+        TestFixture::map(anderson.x, Gx);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_LE(std::abs(Gx[i] - anderson.x[i]), TestFixture::tolerance());
+            // each stops up to tolerance / (1 - contraction) away from the fixed point, and the contraction is ~0.95
+            EXPECT_LE(std::abs(anderson.x[i] - picard.x[i]), 50 * TestFixture::tolerance());
+        }
+    }
+}
+
+// Point Jacobi on the diffusion stencil stops just as close to the solution, in several times fewer sweeps
+TYPED_TEST(AndersonTests, PointJacobiTest) {
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(TestFixture::makeParams());
+    const MyBLAS::Vector<TypeParam> b(A.getRows(), 1);
+    const TypeParam threshold = TestFixture::tolerance();
+
+    const auto jacobi = applyPointJacobi(A, b, 100000, threshold);
+    const auto anderson = applyPointJacobi(A, b, 100000, threshold, static_cast<TypeParam>(1), 1, 5);
+    EXPECT_TRUE(jacobi.converged);
+    EXPECT_TRUE(anderson.converged);
+    EXPECT_LE(3 * anderson.iterations, jacobi.iterations);
+
+    const auto largestResidual = [&A, &b](const MyBLAS::Vector<TypeParam> &x) {
+        const auto r = b - A * x;
+        TypeParam largest = 0;
+        for (size_t i = 0; i < r.size(); i++) {
+            largest = std::max(largest, std::abs(r[i]));
+        }
+        return largest;
+    };
+    EXPECT_LE(largestResidual(anderson.x), 2 * largestResidual(jacobi.x));
+}
+
+} // namespace MyRelaxationMethod
@@ -0,0 +1,182 @@
+/**
+* @file KrylovEigenSolverTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for the implicitly restarted Lanczos and Arnoldi eigensolvers.
+*/
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/solver/LinearSolverParams.h"
+#include "math/blas/system/Circuit.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/KrylovEigenSolvers.h"
+#include "math/relaxation/PowerIteration.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyRelaxationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(KrylovEigenSolverTests, NumericTypes);
+
+template <typename T>
+class KrylovEigenSolverTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief The tridiagonal Toeplitz matrix with diagonal a, subdiagonal b and superdiagonal c, whose eigenvalues are
+     * a + 2 * sqrt(b * c) * cos(j * pi / (n + 1)), for j = 1...n.
+     */
+    static MyBLAS::Matrix<T> makeToeplitz(const size_t n, const T a, const T b, const T c) {
+        return MyBLAS::Matrix<T>(n, n, [a, b, c](size_t i, size_t j) -> T {
+            if (i == j) {
+                return a;
+            }
+            if (j + 1 == i) {
+                return b;
+            }
+            if (i + 1 == j) {
+                return c;
+            }
+            return 0;
+        });
+    }
+
+    static T toeplitzEigenvalue(const size_t n, const size_t j, const T a, const T b, const T c) {
+        return a + 2 * std::sqrt(b * c) * static_cast<T>(std::cos(static_cast<long double>(j) * M_PIl / static_cast<long double>(n + 1)));
+    }
+
+    static T tolerance() { return std::sqrt(std::numeric_limits<T>::epsilon()); }
+};
+
+// Lanczos finds the largest eigenvalues of the 1D Laplacian, each with a small residual, on dense and sparse storage
+TYPED_TEST(KrylovEigenSolverTests, LanczosLaplacianTest) {
+    const size_t n = 100;
+    const size_t k = 4;
+    const auto A = TestFixture::makeToeplitz(n, 2, -1, -1);
+    const MyBLAS::SparseMatrix<TypeParam> sparse(A);
+    const TypeParam tolerance = TestFixture::tolerance();
+
+    const auto dense = applyLanczos(A, k, 5000, tolerance);
+    const auto compressed = applyLanczos(sparse, k, 5000, tolerance);
+    ASSERT_EQ(dense.size(), k);
+    ASSERT_EQ(compressed.size(), k);
+    for (size_t j = 0; j < k; j++) {
+        const TypeParam exact = TestFixture::toeplitzEigenvalue(n, j + 1, 2, -1, -1);
+        EXPECT_TRUE(dense[j].converged);
+        EXPECT_EQ(dense[j].method, MyBLAS::Solver::Type(METHOD_LANCZOS));
+        EXPECT_LE(std::abs(dense[j].eigenvalue - exact), 10 * tolerance * exact);
+        EXPECT_LE(dense[j].residual_infinite_norm, 10 * tolerance * exact);
+        EXPECT_LE(std::abs(compressed[j].eigenvalue - dense[j].eigenvalue), 10 * tolerance * exact);
+    }
+}
+
+// The smallest eigenvalues of the SPD Laplacian are found too, although they take more restarts
+TYPED_TEST(KrylovEigenSolverTests, LanczosSmallestTest) {
+    const size_t n = 40;
+    const size_t k = 3;
+    const auto A = TestFixture::makeToeplitz(n, 2, -1, -1);
+    const TypeParam tolerance = TestFixture::tolerance();
+
+    const auto eigenpairs = applyLanczos(A, k, 10000, tolerance, TARGET_SMALLEST_REAL);
+    ASSERT_EQ(eigenpairs.size(), k);
+    for (size_t j = 0; j < k; j++) {
+        const TypeParam exact = TestFixture::toeplitzEigenvalue(n, n - j, 2, -1, -1);
+        EXPECT_TRUE(eigenpairs[j].converged);
+        EXPECT_LE(std::abs(eigenpairs[j].eigenvalue - exact), 10 * tolerance * 4);
+    }
+}
+
+// Arnoldi finds the largest real eigenvalues of a non-symmetric tridiagonal matrix
+TYPED_TEST(KrylovEigenSolverTests, ArnoldiNonSymmetricTest) {
+    const size_t n = 30;
+    const size_t k = 3;
+    const auto b = static_cast<TypeParam>(-1.1);
+    const auto c = static_cast<TypeParam>(-0.9);
+    const auto A = TestFixture::makeToeplitz(n, 2, b, c);
+    const TypeParam tolerance = TestFixture::tolerance();
+
+    const auto eigenpairs = applyArnoldi(A, k, 5000, tolerance, TARGET_LARGEST_REAL);
+    ASSERT_EQ(eigenpairs.size(), k);
+    for (size_t j = 0; j < k; j++) {
+        const TypeParam exact = TestFixture::toeplitzEigenvalue(n, j + 1, 2, b, c);
+        EXPECT_TRUE(eigenpairs[j].converged);
+        EXPECT_EQ(eigenpairs[j].method, MyBLAS::Solver::Type(METHOD_ARNOLDI));
+        EXPECT_TRUE(std::isnan(eigenpairs[j].eigenvalue_imaginary));
+        EXPECT_LE(std::abs(eigenpairs[j].eigenvalue - exact), 100 * tolerance * exact);
+        EXPECT_LE(eigenpairs[j].residual_infinite_norm, 100 * tolerance * exact);
+    }
+}
+
+// A dominant complex conjugate pair is found together, with a small complex residual
+TYPED_TEST(KrylovEigenSolverTests, ArnoldiComplexPairTest) {
+    const size_t n = 40;
+    // a 2 x 2 block with eigenvalues 5 +/- 2i, followed by a diagonal of real eigenvalues in (0, 4]
+    const MyBLAS::Matrix<TypeParam> A(n, n, [](size_t i, size_t j) -> TypeParam {
+        if (i < 2 && j < 2) {
+            return i == j ? 5 : (i < j ? 2 : -2);
+        }
+        if (i == j) {
+            return 4 * static_cast<TypeParam>(n - i) / static_cast<TypeParam>(n - 2);
+        }
+        // couple each real mode to its neighbour, so that the matrix is not block diagonal
+        return (j == i + 1 && i >= 2) ? static_cast<TypeParam>(0.1) : 0;
+    });
+    const TypeParam tolerance = TestFixture::tolerance();
+
+    const auto eigenpairs = applyArnoldi(A, 2, 5000, tolerance);
+    ASSERT_EQ(eigenpairs.size(), 2);
+    for (const auto &eigenpair : eigenpairs) {
+        EXPECT_TRUE(eigenpair.converged);
+        EXPECT_LE(std::abs(eigenpair.eigenvalue - 5), 100 * tolerance * 5);
+        EXPECT_LE(std::abs(std::abs(eigenpair.eigenvalue_imaginary) - 2), 100 * tolerance * 5);
+        EXPECT_LE(eigenpair.residual_infinite_norm, 100 * tolerance * 5);
+    }
+    EXPECT_GT(eigenpairs[0].eigenvalue_imaginary, 0);
+    EXPECT_LT(eigenpairs[1].eigenvalue_imaginary, 0);
+}
+
+// On a circuit matrix, Lanczos agrees with the Rayleigh quotient power iteration, in far fewer matrix-vector products
+TYPED_TEST(KrylovEigenSolverTests, CircuitTest) {
+    const size_t n = 100;
+    MyBLAS::Matrix<double> circuit;
+    MyBLAS::Vector<double> b, x;
+    MyBLAS::System::Circuit<double>(n, circuit, b, x);
+    const MyBLAS::Matrix<TypeParam> A(n, n, [&circuit](size_t i, size_t j) { return static_cast<TypeParam>(circuit[i][j]); });
+    const TypeParam tolerance = TestFixture::tolerance();
+
+    MyBLAS::Solver::Parameters<TypeParam> params;
+    params.setSize(n).setMaxIterations(100000).setConvergenceThreshold(std::numeric_limits<TypeParam>::epsilon());
+    params.setCoefficients(A).setInitialGuess(MyBLAS::Vector<TypeParam>(n, 1));
+    const auto power = applyRayleighQuotientPowerIteration<MyBLAS::Matrix, MyBLAS::Vector, TypeParam>(params);
+
+    const auto lanczos = applyLanczos(A, 1, 5000, tolerance);
+    ASSERT_EQ(lanczos.size(), 1);
+    EXPECT_TRUE(lanczos[0].converged);
+    EXPECT_LE(std::abs(lanczos[0].eigenvalue - power.eigenvalue), 10 * tolerance * std::abs(power.eigenvalue));
+    EXPECT_LE(lanczos[0].iterations, 100);
+    EXPECT_LT(lanczos[0].iterations, power.iterations);
+}
+
+// When the Ritz values cannot be found, every eigenpair is returned unconverged, without forming an eigenvector
+TYPED_TEST(KrylovEigenSolverTests, RitzFailureTest) {
+    const size_t n = 30, k = 3;
+    auto A = TestFixture::makeToeplitz(n, 2, -1, -1);
+    A[7][7] = std::numeric_limits<TypeParam>::quiet_NaN();
+    for (const auto &eigenpairs : {applyLanczos(A, k, 1000, TestFixture::tolerance()), applyArnoldi(A, k, 1000, TestFixture::tolerance())}) {
+        ASSERT_EQ(eigenpairs.size(), k);
+        for (const auto &eigenpair : eigenpairs) {
+            EXPECT_FALSE(eigenpair.converged);
+            EXPECT_EQ(eigenpair.x.size(), n);
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_EQ(eigenpair.x[i], 0);
+            }
+        }
+    }
+}
+
+} // namespace MyRelaxationMethod
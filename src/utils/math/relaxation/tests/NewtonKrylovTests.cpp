@@ -0,0 +1,129 @@
+/**
+* @file NewtonKrylovTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for restarted GMRES, and for the Jacobian-free Newton-Krylov solver built on it.
+*/
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+#include "math/relaxation/GMRES.h"
+#include "math/relaxation/NewtonKrylov.h"
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyRelaxationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(NewtonKrylovTests, NumericTypes);
+
+template <typename T>
+class NewtonKrylovTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief A 1D convection-diffusion matrix, which is non-symmetric, so that CG does not apply.
+     */
+    static MyBLAS::Matrix<T> makeConvectionDiffusion(const size_t n) {
+        return MyBLAS::Matrix<T>(n, n, [](size_t i, size_t j) -> T {
+            if (i == j) {
+                return 2;
+            }
+            if (j + 1 == i) {
+                return static_cast<T>(-1.4);
+            }
+            if (i + 1 == j) {
+                return static_cast<T>(-0.6);
+            }
+            return 0;
+        });
+    }
+
+    static MyPhysics::Diffusion::Params<T> makeParams() { return TestProblems::makeParams<T>(20, 15); }
+};
+
+// GMRES solves a non-symmetric system to the threshold, and agrees with LUP to within the accuracy that implies
+TYPED_TEST(NewtonKrylovTests, GMRESNonSymmetricTest) {
+    const size_t n = 80;
+    const auto A = TestFixture::makeConvectionDiffusion(n);
+    const auto b = TestProblems::makeSources<TypeParam>(n);
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto gmres = applyGMRES(A, b, 2000, threshold, 20);
+    EXPECT_TRUE(gmres.converged);
+    EXPECT_EQ(gmres.method, MyBLAS::Solver::Type(METHOD_GMRES));
+    const auto r = b - A * gmres.x;
+    EXPECT_LE(std::sqrt(r * r), threshold);
+
+    const auto lup = MyBLAS::LUP::applyLUP(A, b);
+    const TypeParam scale = std::sqrt(lup.x * lup.x);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(gmres.x[i] - lup.x[i]), std::sqrt(std::numeric_limits<TypeParam>::epsilon()) * scale);
+    }
+}
+
+// Without restarts, GMRES on the SPD diffusion stencil takes no more steps than CG, since it minimizes the residual
+TYPED_TEST(NewtonKrylovTests, GMRESMatchesConjugateGradientTest) {
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(TestFixture::makeParams());
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto gmres = applyGMRES(A, b, 1000, threshold, 1000);
+    EXPECT_TRUE(gmres.converged);
+    EXPECT_LE(gmres.iterations, 70);
+    const auto r = b - A * gmres.x;
+    EXPECT_LE(std::sqrt(r * r), threshold);
+}
+
+// On a diagonal nonlinear system, Newton converges from afar, and the line search keeps it from overshooting zero
+TYPED_TEST(NewtonKrylovTests, NewtonSquareRootsTest) {
+    const size_t n = 10;
+    const auto F = [](const MyBLAS::Vector<TypeParam> &u, MyBLAS::Vector<TypeParam> &Fu) {
+        for (size_t i = 0; i < u.size(); i++) {
+            Fu[i] = u[i] * u[i] - static_cast<TypeParam>(i + 1);
+        }
+    };
+    const MyBLAS::Vector<TypeParam> initial(n, 10);
+    const TypeParam tolerance = 100 * std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+
+    const auto newton = applyNewtonKrylov(F, initial, 50, tolerance);
+    EXPECT_TRUE(newton.converged);
+    EXPECT_EQ(newton.method, MyBLAS::Solver::Type(METHOD_NEWTON));
+    EXPECT_LE(newton.iterations, 12);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_LE(std::abs(newton.x[i] - std::sqrt(static_cast<TypeParam>(i + 1))), tolerance);
+    }
+}
+
+// The diffusion stencil with a cubic removal term, A u + u^3 = b, converges in a handful of Newton steps
+TYPED_TEST(NewtonKrylovTests, NewtonNonlinearDiffusionTest) {
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(TestFixture::makeParams());
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const auto F = [&A, &b](const MyBLAS::Vector<TypeParam> &u, MyBLAS::Vector<TypeParam> &Fu) {
+        A.apply(u, Fu);
+        for (size_t i = 0; i < u.size(); i++) {
+            Fu[i] += u[i] * u[i] * u[i] - b[i];
+        }
+    };
+    const MyBLAS::Vector<TypeParam> initial(A.getRows(), 0);
+    const TypeParam tolerance = 100 * std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+
+    const auto newton = applyNewtonKrylov(F, initial, 50, tolerance);
+    EXPECT_TRUE(newton.converged);
+    EXPECT_LE(newton.iterations, 8);
+    MyBLAS::Vector<TypeParam> Fu(A.getRows(), 0);
+    F(newton.x, Fu);
+    for (size_t i = 0; i < Fu.size(); i++) {
+        EXPECT_LE(std::abs(Fu[i]), tolerance);
+    }
+}
+
+} // namespace MyRelaxationMethod
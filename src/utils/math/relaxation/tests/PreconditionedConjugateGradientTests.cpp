@@ -0,0 +1,135 @@
+/**
+* @file PreconditionedConjugateGradientTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for preconditioned conjugate gradient with the Jacobi, ILU(0), IC(0) and MIC(0)
+* preconditioners, on the diffusion stencil and on a sparse circuit-like system.
+*/
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/IncompleteFactorization.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/Preconditioner.h"
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyRelaxationMethod {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> NumericTypes;
+TYPED_TEST_SUITE(PreconditionedConjugateGradientTests, NumericTypes);
+
+template <typename T>
+class PreconditionedConjugateGradientTests : public ::testing::Test {
+  protected:
+    static MyPhysics::Diffusion::Params<T> makeParams() { return TestProblems::makeParams<T>(40, 30); }
+
+    /**
+     * @brief A sparse, symmetric, diagonally dominant conductance matrix, for a ring of nodes with a few random chords,
+     * where every node is also tied to ground. Its diagonal varies from row to row.
+     */
+    static MyBLAS::SparseMatrix<T> makeCircuit(const size_t nodes) {
+        MyBLAS::Matrix<T> G(nodes, nodes, 0);
+        const auto connect = [&G](const size_t i, const size_t j, const T conductance) {
+            G[i][j] -= conductance;
+            G[j][i] -= conductance;
+            G[i][i] += conductance;
+            G[j][j] += conductance;
+        };
+        for (size_t i = 0; i < nodes; i++) {
+            connect(i, (i + 1) % nodes, static_cast<T>(1 + (7 * i) % 10));
+            connect(i, (i * 37 + 11) % nodes == i ? (i + 2) % nodes : (i * 37 + 11) % nodes, static_cast<T>(0.5));
+            G[i][i] += static_cast<T>(0.01) * static_cast<T>(1 + i % 3);
+        }
+        return MyBLAS::SparseMatrix<T>(G);
+    }
+
+    /**
+     * @brief Checks that x solves A * x = b to the threshold.
+     */
+    template <template<typename> class MatrixType>
+    static void expectSolves(const MatrixType<T> &A, const MyBLAS::Vector<T> &b, const MyBLAS::Solver::Solution<T> &solution) {
+        EXPECT_TRUE(solution.converged);
+        const auto r = b - A * solution.x;
+        EXPECT_LE(std::sqrt(r * r), 2 * TestProblems::threshold(b));
+    }
+};
+
+// The preconditioners all satisfy the trait that the PCG template checks, which only looks for apply(r, z)
+TYPED_TEST(PreconditionedConjugateGradientTests, PreconditionerTraitTest) {
+    using Vector = MyBLAS::Vector<TypeParam>;
+    EXPECT_TRUE((is_preconditioner_v<IdentityPreconditioner<TypeParam>, Vector>));
+    EXPECT_TRUE((is_preconditioner_v<JacobiPreconditioner<TypeParam>, Vector>));
+    EXPECT_TRUE((is_preconditioner_v<MyFactorizationMethod::IncompleteLU<TypeParam>, Vector>));
+    EXPECT_TRUE((is_preconditioner_v<MyFactorizationMethod::IncompleteCholesky<TypeParam>, Vector>));
+    EXPECT_FALSE((is_preconditioner_v<Vector, Vector>));
+}
+
+// With the identity preconditioner, PCG takes the same steps as plain CG
+TYPED_TEST(PreconditionedConjugateGradientTests, IdentityMatchesConjugateGradientTest) {
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(TestFixture::makeParams());
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto cg = applyConjugateGradient(A, b, 2000, threshold);
+    const auto pcg = applyPreconditionedConjugateGradient(A, b, IdentityPreconditioner<TypeParam>(), 2000, threshold);
+    EXPECT_EQ(pcg.method, MyBLAS::Solver::Type(METHOD_PRECONDITIONED_CONJUGATE_GRADIENT));
+    EXPECT_LE(pcg.iterations, cg.iterations + 1);
+    EXPECT_GE(pcg.iterations + 1, cg.iterations);
+    TestFixture::expectSolves(A, b, pcg);
+}
+
+// On the diffusion stencil the diagonal is constant, so Jacobi does not help, while IC(0) and ILU(0) do
+TYPED_TEST(PreconditionedConjugateGradientTests, DiffusionIncompleteFactorizationTest) {
+    const MyPhysics::Diffusion::Matrix<TypeParam> A(TestFixture::makeParams());
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto cg = applyConjugateGradient(A, b, 2000, threshold);
+    const auto jacobi = applyPreconditionedConjugateGradient(A, b, JacobiPreconditioner<TypeParam>(A), 2000, threshold);
+    const MyFactorizationMethod::IncompleteCholesky<TypeParam> ic(A);
+    const auto icpcg = applyPreconditionedConjugateGradient(A, b, ic, 2000, threshold);
+    const auto ilupcg = applyPreconditionedConjugateGradient(A, b, MyFactorizationMethod::IncompleteLU<TypeParam>(A), 2000, threshold);
+
+    TestFixture::expectSolves(A, b, jacobi);
+    TestFixture::expectSolves(A, b, icpcg);
+    TestFixture::expectSolves(A, b, ilupcg);
+    EXPECT_GE(jacobi.iterations + 1, cg.iterations);
+    EXPECT_LT(2 * icpcg.iterations, cg.iterations);
+    EXPECT_LT(2 * ilupcg.iterations, cg.iterations);
+
+    // and keeping the dropped fill-in on the diagonal, MIC(0), helps more still
+    const MyFactorizationMethod::IncompleteCholesky<TypeParam> mic(A, 1);
+    const auto micpcg = applyPreconditionedConjugateGradient(A, b, mic, 2000, threshold);
+    TestFixture::expectSolves(A, b, micpcg);
+    EXPECT_LT(3 * micpcg.iterations, cg.iterations);
+    EXPECT_LT(micpcg.iterations, icpcg.iterations);
+}
+
+// On a sparse matrix with a varying diagonal, Jacobi helps, and IC(0) helps more
+TYPED_TEST(PreconditionedConjugateGradientTests, SparseCircuitTest) {
+    const auto G = TestFixture::makeCircuit(400);
+    const auto b = TestProblems::makeSources<TypeParam>(G.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto cg = applyConjugateGradient(G, b, 4000, threshold);
+    const auto jacobi = applyPreconditionedConjugateGradient(G, b, JacobiPreconditioner<TypeParam>(G), 4000, threshold);
+    const auto icpcg = applyPreconditionedConjugateGradient(G, b, MyFactorizationMethod::IncompleteCholesky<TypeParam>(G), 4000, threshold);
+
+    TestFixture::expectSolves(G, b, cg);
+    TestFixture::expectSolves(G, b, jacobi);
+    TestFixture::expectSolves(G, b, icpcg);
+    EXPECT_LT(jacobi.iterations, cg.iterations);
+    EXPECT_LT(icpcg.iterations, jacobi.iterations);
+}
+
+} // namespace MyRelaxationMethod
@@ -0,0 +1,336 @@
+/**
+ * @file CartesianDecomposition.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Partitions an m x n mesh into 2D blocks over a Cartesian grid of MPI ranks, and stores each rank's block with
+ * a one-cell ghost layer that is filled in from its neighbors.
+ */
+
+#ifndef NE591_008_CARTESIANDECOMPOSITION_H
+#define NE591_008_CARTESIANDECOMPOSITION_H
+
+#include <mpi.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "math/blas/vector/Vector.h"
+
+/**
+ * @namespace MyMPI
+ * @brief This namespace contains the distributed memory building blocks used on top of MPIProject.
+ */
+namespace MyMPI {
+
+/**
+ * @brief Maps a floating point type to the matching MPI datatype.
+ */
+template <typename T> struct DataType;
+
+template <> struct DataType<float> {
+    static MPI_Datatype value() { return MPI_FLOAT; }
+};
+
+template <> struct DataType<double> {
+    static MPI_Datatype value() { return MPI_DOUBLE; }
+};
+
+template <> struct DataType<long double> {
+    static MPI_Datatype value() { return MPI_LONG_DOUBLE; }
+};
+
+/**
+ * @brief The four faces of a block, in the order used for the neighbor ranks and the halo messages.
+ * @details North is towards mesh row 0, and west is towards mesh column 0.
+ */
+enum Face : size_t {
+    FACE_NORTH = 0,
+    FACE_SOUTH = 1,
+    FACE_WEST = 2,
+    FACE_EAST = 3,
+};
+
+/**
+ * @class CartesianDecomposition
+ * @brief Splits the m x n mesh over a px x py grid of ranks, chosen by MPI_Dims_create to be as square as possible.
+ * @details The rank at grid coordinates (p, q) owns mesh rows [m * p / px, m * (p + 1) / px) and mesh columns
+ * [n * q / py, n * (q + 1) / py), so block sizes differ by at most one row or column. The Cartesian communicator is not
+ * periodic, so the neighbors across the outer boundary of the mesh are MPI_PROC_NULL, and messages to them are no-ops.
+ * @note The communicator is freed in the destructor, so the decomposition must go out of scope before MPI_Finalize.
+ */
+class CartesianDecomposition {
+
+  public:
+    /**
+     * @brief Builds the process grid and this rank's block.
+     * @param m The number of mesh rows.
+     * @param n The number of mesh columns.
+     * @param comm The communicator to decompose over. It is duplicated, not consumed.
+     */
+    CartesianDecomposition(const size_t m, const size_t n, MPI_Comm comm = MPI_COMM_WORLD) : _m(m), _n(n) {
+        int size;
+        MPI_Comm_size(comm, &size);
+        MPI_Dims_create(size, 2, _dims.data());
+
+        const std::array<int, 2> periodic = {0, 0};
+        MPI_Cart_create(comm, 2, _dims.data(), periodic.data(), 0, &_comm);
+        MPI_Comm_rank(_comm, &_rank);
+        MPI_Comm_size(_comm, &_size);
+        MPI_Cart_coords(_comm, _rank, 2, _coords.data());
+
+        MPI_Cart_shift(_comm, 0, 1, &_neighbors[FACE_NORTH], &_neighbors[FACE_SOUTH]);
+        MPI_Cart_shift(_comm, 1, 1, &_neighbors[FACE_WEST], &_neighbors[FACE_EAST]);
+
+        _firstRow = blockStart(_m, _dims[0], _coords[0]);
+        _rows = blockStart(_m, _dims[0], _coords[0] + 1) - _firstRow;
+        _firstCol = blockStart(_n, _dims[1], _coords[1]);
+        _cols = blockStart(_n, _dims[1], _coords[1] + 1) - _firstCol;
+    }
+
+    ~CartesianDecomposition() {
+        if (_comm != MPI_COMM_NULL) {
+            MPI_Comm_free(&_comm);
+        }
+    }
+
+    CartesianDecomposition(const CartesianDecomposition &) = delete;
+    CartesianDecomposition &operator=(const CartesianDecomposition &) = delete;
+
+    /**
+     * @brief The first index of block number part, when extent items are split into parts nearly equal blocks.
+     */
+    static size_t blockStart(const size_t extent, const int parts, const int part) {
+        return extent * static_cast<size_t>(part) / static_cast<size_t>(parts);
+    }
+
+    [[nodiscard]] MPI_Comm getComm() const { return _comm; }
+    [[nodiscard]] int getRank() const { return _rank; }
+    [[nodiscard]] int getSize() const { return _size; }
+    [[nodiscard]] const std::array<int, 2> &getDims() const { return _dims; }
+    [[nodiscard]] const std::array<int, 2> &getCoords() const { return _coords; }
+    [[nodiscard]] int getNeighbor(const Face face) const { return _neighbors[face]; }
+
+    /**
+     * @brief The size of the global mesh.
+     */
+    [[nodiscard]] size_t getM() const { return _m; }
+    [[nodiscard]] size_t getN() const { return _n; }
+
+    /**
+     * @brief The mesh rows and columns owned by this rank, excluding the ghost layer.
+     */
+    [[nodiscard]] size_t getFirstRow() const { return _firstRow; }
+    [[nodiscard]] size_t getFirstCol() const { return _firstCol; }
+    [[nodiscard]] size_t getRows() const { return _rows; }
+    [[nodiscard]] size_t getCols() const { return _cols; }
+
+  private:
+    size_t _m;
+    size_t _n;
+    MPI_Comm _comm = MPI_COMM_NULL;
+    int _rank = 0;
+    int _size = 1;
+    std::array<int, 2> _dims = {0, 0};
+    std::array<int, 2> _coords = {0, 0};
+    std::array<int, 4> _neighbors = {MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL};
+    size_t _firstRow = 0;
+    size_t _firstCol = 0;
+    size_t _rows = 0;
+    size_t _cols = 0;
+};
+
+/**
+ * @class HaloField
+ * @brief One rank's block of a mesh field, stored row-major with a one-cell ghost layer on every side.
+ * @details Interior node (i, j), for 0 <= i < getRows() and 0 <= j < getCols(), is mesh node
+ * (getFirstRow() + i, getFirstCol() + j). The ghost cells hold copies of the neighboring ranks' edge nodes after an
+ * exchange, and stay zero along the outer boundary of the mesh, which is the zero flux boundary condition of the
+ * diffusion problem. The north and south edges are contiguous and are sent in place, while the west and east edges
+ * are packed into buffers that are kept between exchanges.
+ * @tparam T The type of the field values.
+ */
+template <typename T>
+class HaloField {
+
+  public:
+    /**
+     * @brief Allocates the block and its ghost layer, filled with value.
+     */
+    explicit HaloField(const CartesianDecomposition &decomposition, const T value = 0)
+        : _decomposition(&decomposition), _rows(decomposition.getRows()), _cols(decomposition.getCols()),
+          _stride(decomposition.getCols() + 2), _data((decomposition.getRows() + 2) * (decomposition.getCols() + 2), value) {
+        for (auto &buffer : _sendBuffers) {
+            buffer.resize(_rows, 0);
+        }
+        for (auto &buffer : _receiveBuffers) {
+            buffer.resize(_rows, 0);
+        }
+        // The ghost layer along the outer boundary is never written by an exchange, so it must start out at zero
+        for (size_t i = 0; i < _rows + 2; i++) {
+            for (size_t j = 0; j < _cols + 2; j++) {
+                if (i == 0 || j == 0 || i == _rows + 1 || j == _cols + 1) {
+                    _data[i * _stride + j] = 0;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief The storage index of interior node (i, j). The neighbors are at +/- 1 and +/- getStride().
+     */
+    [[nodiscard]] size_t index(const size_t i, const size_t j) const { return (i + 1) * _stride + (j + 1); }
+
+    T &operator()(const size_t i, const size_t j) { return _data[index(i, j)]; }
+    const T &operator()(const size_t i, const size_t j) const { return _data[index(i, j)]; }
+
+    T &operator[](const size_t idx) { return _data[idx]; }
+    const T &operator[](const size_t idx) const { return _data[idx]; }
+
+    [[nodiscard]] size_t getRows() const { return _rows; }
+    [[nodiscard]] size_t getCols() const { return _cols; }
+    [[nodiscard]] size_t getStride() const { return _stride; }
+    [[nodiscard]] const CartesianDecomposition &getDecomposition() const { return *_decomposition; }
+
+    /**
+     * @brief Posts the nonblocking receives into the ghost layer and the sends of the edge nodes.
+     * @details The interior can be updated while the messages are in flight, as long as the edge nodes are not
+     * modified and the ghost cells are not read until finishExchange() returns.
+     */
+    void beginExchange() {
+        const MPI_Comm comm = _decomposition->getComm();
+        const MPI_Datatype type = DataType<T>::value();
+        const int rowCount = static_cast<int>(_cols);
+        const int colCount = static_cast<int>(_rows);
+
+        for (size_t i = 0; i < _rows; i++) {
+            _sendBuffers[0][i] = _data[index(i, 0)];
+            _sendBuffers[1][i] = _data[index(i, _cols - 1)];
+        }
+
+        // Each message is tagged with the direction it travels in, so the two messages between a pair of ranks never mix
+        auto *requests = _requests.data();
+        MPI_Irecv(&_data[1], rowCount, type, _decomposition->getNeighbor(FACE_NORTH), FACE_SOUTH, comm, requests++);
+        MPI_Irecv(&_data[(_rows + 1) * _stride + 1], rowCount, type, _decomposition->getNeighbor(FACE_SOUTH), FACE_NORTH, comm, requests++);
+        MPI_Irecv(_receiveBuffers[0].data(), colCount, type, _decomposition->getNeighbor(FACE_WEST), FACE_EAST, comm, requests++);
+        MPI_Irecv(_receiveBuffers[1].data(), colCount, type, _decomposition->getNeighbor(FACE_EAST), FACE_WEST, comm, requests++);
+        MPI_Isend(&_data[index(0, 0)], rowCount, type, _decomposition->getNeighbor(FACE_NORTH), FACE_NORTH, comm, requests++);
+        MPI_Isend(&_data[_rows * _stride + 1], rowCount, type, _decomposition->getNeighbor(FACE_SOUTH), FACE_SOUTH, comm, requests++);
+        MPI_Isend(_sendBuffers[0].data(), colCount, type, _decomposition->getNeighbor(FACE_WEST), FACE_WEST, comm, requests++);
+        MPI_Isend(_sendBuffers[1].data(), colCount, type, _decomposition->getNeighbor(FACE_EAST), FACE_EAST, comm, requests);
+    }
+
+    /**
+     * @brief Waits for the messages posted by beginExchange(), and unpacks the west and east ghost columns.
+     */
+    void finishExchange() {
+        MPI_Waitall(static_cast<int>(_requests.size()), _requests.data(), MPI_STATUSES_IGNORE);
+        if (_decomposition->getNeighbor(FACE_WEST) != MPI_PROC_NULL) {
+            for (size_t i = 0; i < _rows; i++) {
+                _data[index(i, 0) - 1] = _receiveBuffers[0][i];
+            }
+        }
+        if (_decomposition->getNeighbor(FACE_EAST) != MPI_PROC_NULL) {
+            for (size_t i = 0; i < _rows; i++) {
+                _data[index(i, _cols - 1) + 1] = _receiveBuffers[1][i];
+            }
+        }
+    }
+
+    /**
+     * @brief Fills the ghost layer from the neighboring ranks.
+     */
+    void exchange() {
+        beginExchange();
+        finishExchange();
+    }
+
+    /**
+     * @brief Collects the interior of every rank's block into the global mesh vector on root.
+     * @return The m * n vector, with mesh node (i, j) at index i * n + j, on root, and an empty vector elsewhere.
+     */
+    [[nodiscard]] MyBLAS::Vector<T> gather(const int root = 0) const {
+        const CartesianDecomposition &decomposition = *_decomposition;
+        const MPI_Comm comm = decomposition.getComm();
+        const MPI_Datatype type = DataType<T>::value();
+
+        std::vector<T> packed(_rows * _cols);
+        for (size_t i = 0; i < _rows; i++) {
+            for (size_t j = 0; j < _cols; j++) {
+                packed[i * _cols + j] = _data[index(i, j)];
+            }
+        }
+
+        const bool isRoot = decomposition.getRank() == root;
+        const auto ranks = static_cast<size_t>(decomposition.getSize());
+        std::vector<int> counts(isRoot ? ranks : 0);
+        std::vector<int> displacements(isRoot ? ranks : 0);
+        if (isRoot) {
+            int offset = 0;
+            for (size_t rank = 0; rank < ranks; rank++) {
+                const Block block = blockOf(static_cast<int>(rank));
+                counts[rank] = static_cast<int>(block.rows * block.cols);
+                displacements[rank] = offset;
+                offset += counts[rank];
+            }
+        }
+
+        std::vector<T> received(isRoot ? decomposition.getM() * decomposition.getN() : 0);
+        MPI_Gatherv(packed.data(), static_cast<int>(packed.size()), type, received.data(), counts.data(),
+                    displacements.data(), type, root, comm);
+
+        if (!isRoot) {
+            return MyBLAS::Vector<T>();
+        }
+
+        const size_t n = decomposition.getN();
+        MyBLAS::Vector<T> global(decomposition.getM() * n, 0);
+        for (size_t rank = 0; rank < ranks; rank++) {
+            const Block block = blockOf(static_cast<int>(rank));
+            const T *source = received.data() + displacements[rank];
+            for (size_t i = 0; i < block.rows; i++) {
+                for (size_t j = 0; j < block.cols; j++) {
+                    global[(block.firstRow + i) * n + block.firstCol + j] = source[i * block.cols + j];
+                }
+            }
+        }
+        return global;
+    }
+
+  private:
+    const CartesianDecomposition *_decomposition;
+    size_t _rows;
+    size_t _cols;
+    size_t _stride;
+    std::vector<T> _data;
+    std::array<std::vector<T>, 2> _sendBuffers;
+    std::array<std::vector<T>, 2> _receiveBuffers;
+    std::array<MPI_Request, 8> _requests{};
+
+    struct Block {
+        size_t firstRow, firstCol, rows, cols;
+    };
+
+    /**
+     * @brief The mesh block owned by another rank of the decomposition.
+     */
+    [[nodiscard]] Block blockOf(const int rank) const {
+        const CartesianDecomposition &decomposition = *_decomposition;
+        std::array<int, 2> coords{};
+        MPI_Cart_coords(decomposition.getComm(), rank, 2, coords.data());
+        const auto &dims = decomposition.getDims();
+        const size_t firstRow = CartesianDecomposition::blockStart(decomposition.getM(), dims[0], coords[0]);
+        const size_t firstCol = CartesianDecomposition::blockStart(decomposition.getN(), dims[1], coords[1]);
+        return {
+            firstRow,
+            firstCol,
+            CartesianDecomposition::blockStart(decomposition.getM(), dims[0], coords[0] + 1) - firstRow,
+            CartesianDecomposition::blockStart(decomposition.getN(), dims[1], coords[1] + 1) - firstCol,
+        };
+    }
+};
+
+} // namespace MyMPI
+
+#endif // NE591_008_CARTESIANDECOMPOSITION_H
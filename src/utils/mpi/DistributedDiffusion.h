@@ -0,0 +1,333 @@
+/**
+ * @file DistributedDiffusion.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Jacobi, red-black SOR and conjugate gradient solvers for the diffusion equation on a mesh that is split into
+ * 2D blocks over MPI ranks.
+ *
+ * Every rank applies the five-point stencil of MyPhysics::Diffusion::Matrix to its own block, reading the nodes of the
+ * neighboring blocks from the one-cell ghost layer of a MyMPI::HaloField. The ghost layers are refreshed with
+ * nonblocking point-to-point messages, and the norms and dot products are summed over all ranks with MPI_Allreduce.
+ * The stencil, the update formulas and the convergence checks are the same as in the shared memory solvers, so a run on
+ * any number of ranks follows the same iterates as MyRelaxationMethod::applyPointJacobi, applyRedBlackSOR and
+ * applyConjugateGradient on the full mesh, up to the order in which the global sums are added.
+ */
+
+#ifndef NE591_008_DISTRIBUTEDDIFFUSION_H
+#define NE591_008_DISTRIBUTEDDIFFUSION_H
+
+#include <mpi.h>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "CartesianDecomposition.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/relaxation/RedBlackSOR.h"
+#include "math/relaxation/RelaxationMethods.h"
+#include "physics/diffusion/DiffusionConstants.h"
+#include "physics/diffusion/DiffusionParams.h"
+#include "utils/math/blas/solver/LinearSolver.h"
+
+namespace MyMPI::Diffusion {
+
+/**
+ * @brief Calls function(idx) for every node of the block that has no neighbor in the ghost layer.
+ */
+template <typename T, typename Function>
+void forEachInnerNode(const HaloField<T> &x, Function &&function) {
+    for (size_t i = 1; i + 1 < x.getRows(); i++) {
+        for (size_t j = 1; j + 1 < x.getCols(); j++) {
+            function(x.index(i, j));
+        }
+    }
+}
+
+/**
+ * @brief Calls function(idx) once for every node on the edges of the block.
+ */
+template <typename T, typename Function>
+void forEachEdgeNode(const HaloField<T> &x, Function &&function) {
+    const size_t rows = x.getRows();
+    const size_t cols = x.getCols();
+    for (size_t i = 0; i < rows; i++) {
+        if (i == 0 || i + 1 == rows) {
+            for (size_t j = 0; j < cols; j++) {
+                function(x.index(i, j));
+            }
+        } else if (cols > 0) {
+            function(x.index(i, 0));
+            if (cols > 1) {
+                function(x.index(i, cols - 1));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Calls function(idx) for every node of the block, with the ghost layer of x filled in.
+ * @details The inner nodes are visited while the exchange is in flight, so function must not write to x.
+ */
+template <typename T, typename Function>
+void overlapExchange(HaloField<T> &x, Function &&function) {
+    x.beginExchange();
+    forEachInnerNode(x, function);
+    x.finishExchange();
+    forEachEdgeNode(x, function);
+}
+
+/**
+ * @class Operator
+ * @brief The five-point diffusion stencil, applied to one rank's block of the mesh.
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class Operator {
+
+  public:
+    explicit Operator(const MyPhysics::Diffusion::Params<T> &params)
+        : _constants(MyPhysics::Diffusion::Constants<T>::compute(params)) {}
+
+    [[nodiscard]] T getDiagonal() const { return _constants.diagonal; }
+
+    /**
+     * @brief The sum of the four neighbor terms of the node at storage index idx.
+     * @details The neighbors are added in the order (i-1, j), (i, j-1), (i, j+1), (i+1, j), as in
+     * MyPhysics::Diffusion::Matrix::forEachNeighbor. Neighbors outside the mesh read a zero ghost cell.
+     */
+    [[nodiscard]] T offDiagonalProduct(const HaloField<T> &x, const size_t idx) const {
+        const size_t stride = x.getStride();
+        T sum = 0;
+        sum += _constants.minus_D_over_delta_squared * x[idx - stride];
+        sum += _constants.minus_D_over_gamma_squared * x[idx - 1];
+        sum += _constants.minus_D_over_gamma_squared * x[idx + 1];
+        sum += _constants.minus_D_over_delta_squared * x[idx + stride];
+        return sum;
+    }
+
+    /**
+     * @brief y = A * x on this rank's block.
+     * @details The interior of the block is computed while the ghost layer of x is in flight, and the nodes along the
+     * block edges are computed once it has arrived.
+     */
+    void apply(HaloField<T> &x, HaloField<T> &y) const {
+        overlapExchange(x, [this, &x, &y](const size_t idx) {
+            y[idx] = _constants.diagonal * x[idx] + offDiagonalProduct(x, idx);
+        });
+    }
+
+  private:
+    MyPhysics::Diffusion::Constants<T> _constants;
+};
+
+/**
+ * @brief Sums a value over all ranks of the decomposition.
+ */
+template <typename T>
+T allreduceSum(T value, const CartesianDecomposition &decomposition) {
+    MPI_Allreduce(MPI_IN_PLACE, &value, 1, DataType<T>::value(), MPI_SUM, decomposition.getComm());
+    return value;
+}
+
+/**
+ * @brief The global dot product of two fields, over the interior nodes only.
+ */
+template <typename T>
+T dot(const HaloField<T> &x, const HaloField<T> &y) {
+    T sum = 0;
+    for (size_t i = 0; i < x.getRows(); i++) {
+        for (size_t j = 0; j < x.getCols(); j++) {
+            sum += x(i, j) * y(i, j);
+        }
+    }
+    return allreduceSum(sum, x.getDecomposition());
+}
+
+/**
+ * @brief Copies this rank's block out of the full m x n source matrix, which every rank holds after the inputs are
+ * broadcast by MPIProject.
+ */
+template <typename T>
+HaloField<T> localBlock(const CartesianDecomposition &decomposition, const MyBLAS::Matrix<T> &global) {
+    HaloField<T> block(decomposition);
+    for (size_t i = 0; i < block.getRows(); i++) {
+        for (size_t j = 0; j < block.getCols(); j++) {
+            block(i, j) = global[decomposition.getFirstRow() + i][decomposition.getFirstCol() + j];
+        }
+    }
+    return block;
+}
+
+/**
+ * @brief The residual b - A * x on this rank's block.
+ */
+template <typename T>
+HaloField<T> residual(const Operator<T> &A, const HaloField<T> &b, HaloField<T> &x) {
+    HaloField<T> r(x.getDecomposition());
+    A.apply(x, r);
+    forEachInnerNode(r, [&r, &b](const size_t idx) { r[idx] = b[idx] - r[idx]; });
+    forEachEdgeNode(r, [&r, &b](const size_t idx) { r[idx] = b[idx] - r[idx]; });
+    return r;
+}
+
+/**
+ * @brief Weighted point Jacobi on the distributed mesh.
+ * @details The update of the inner nodes overlaps the ghost layer exchange, since Jacobi only writes to the new
+ * iterate. The convergence measure is the L2 norm of the change over one iteration, as in
+ * MyRelaxationMethod::applyPointJacobi.
+ * @param A The local stencil.
+ * @param b This rank's block of the right hand side.
+ * @param x The initial guess on input, and this rank's block of the solution on output.
+ * @return The solution, with x gathered onto rank 0 of the decomposition, and left empty elsewhere.
+ */
+template <typename T>
+MyBLAS::Solver::Solution<T> applyPointJacobi(const Operator<T> &A, const HaloField<T> &b, HaloField<T> &x,
+                                             const size_t max_iterations, const T tolerance, const T relaxation_factor = 1) {
+    MyBLAS::Solver::Solution<T> results;
+    results.method = MyRelaxationMethod::METHOD_POINT_JACOBI;
+
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2));
+    T iterative_error_squared = std::numeric_limits<T>::max();
+    const T weight = relaxation_factor / A.getDiagonal();
+
+    HaloField<T> new_x(x.getDecomposition());
+    for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            break;
+        }
+
+        T change_squared = 0;
+        overlapExchange(x, [&](const size_t idx) {
+            const T sum = A.offDiagonalProduct(x, idx);
+            new_x[idx] = (static_cast<T>(1) - relaxation_factor) * x[idx] + weight * (b[idx] - sum);
+            const T change = new_x[idx] - x[idx];
+            change_squared += change * change;
+        });
+        std::swap(x, new_x);
+        iterative_error_squared = allreduceSum(change_squared, x.getDecomposition());
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    results.x = x.gather();
+    return results;
+}
+
+/**
+ * @brief Red-black SOR on the distributed mesh, colored by the parity of the global (i + j).
+ * @details The ghost layer is refreshed before each color sweep, since the sweep reads the other color from the
+ * neighboring blocks. The nodes are updated in place, so the sweeps cannot overlap the exchange. The iterates are the
+ * same as those of MyRelaxationMethod::applyRedBlackSOR on the full mesh.
+ * @param A The local stencil.
+ * @param b This rank's block of the right hand side.
+ * @param x The initial guess on input, and this rank's block of the solution on output.
+ * @return The solution, with x gathered onto rank 0 of the decomposition, and left empty elsewhere.
+ */
+template <typename T>
+MyBLAS::Solver::Solution<T> applyRedBlackSOR(const Operator<T> &A, const HaloField<T> &b, HaloField<T> &x,
+                                             const size_t max_iterations, const T tolerance, const T relaxation_factor = 1) {
+    MyBLAS::Solver::Solution<T> results;
+    results.method = MyRelaxationMethod::METHOD_SOR;
+
+    const CartesianDecomposition &decomposition = x.getDecomposition();
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2));
+    T iterative_error_squared = std::numeric_limits<T>::max();
+    const T weight = relaxation_factor / A.getDiagonal();
+
+    for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            break;
+        }
+
+        T change_squared = 0;
+        for (const size_t color : {MyRelaxationMethod::MESH_COLOR_RED, MyRelaxationMethod::MESH_COLOR_BLACK}) {
+            x.exchange();
+            for (size_t i = 0; i < x.getRows(); i++) {
+                const size_t first = (decomposition.getFirstRow() + i + decomposition.getFirstCol() + color) % 2;
+                for (size_t j = first; j < x.getCols(); j += 2) {
+                    const size_t idx = x.index(i, j);
+                    const T sum = A.offDiagonalProduct(x, idx);
+                    const T updated = (static_cast<T>(1) - relaxation_factor) * x[idx] + weight * (b[idx] - sum);
+                    const T change = updated - x[idx];
+                    change_squared += change * change;
+                    x[idx] = updated;
+                }
+            }
+        }
+        iterative_error_squared = allreduceSum(change_squared, decomposition);
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    results.x = x.gather();
+    return results;
+}
+
+/**
+ * @brief Conjugate gradient on the distributed mesh, starting from a zero guess.
+ * @details The matrix-vector product overlaps the ghost layer exchange of the search direction, and each iteration
+ * makes two global reductions, for p.Ap and r.r. The convergence measure is the L2 norm of the residual, as in
+ * MyRelaxationMethod::applyConjugateGradient.
+ * @param A The local stencil.
+ * @param b This rank's block of the right hand side.
+ * @param x This rank's block of the solution on output.
+ * @return The solution, with x gathered onto rank 0 of the decomposition, and left empty elsewhere.
+ */
+template <typename T>
+MyBLAS::Solver::Solution<T> applyConjugateGradient(const Operator<T> &A, const HaloField<T> &b, HaloField<T> &x,
+                                                   const size_t max_iterations, const T tolerance) {
+    MyBLAS::Solver::Solution<T> results;
+    results.method = MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT;
+
+    const CartesianDecomposition &decomposition = x.getDecomposition();
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2));
+    T iterative_error_squared = std::numeric_limits<T>::max();
+
+    x = HaloField<T>(decomposition);
+    HaloField<T> r = b;
+    HaloField<T> p = b;
+    HaloField<T> Ap(decomposition);
+    T r_dot = dot(r, r);
+
+    for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        A.apply(p, Ap);
+        const T pAp = dot(p, Ap);
+        if (pAp == static_cast<T>(0)) {
+            break;
+        }
+
+        const T alpha = r_dot / pAp;
+        T local_r_dot = 0;
+        for (size_t i = 0; i < x.getRows(); i++) {
+            for (size_t j = 0; j < x.getCols(); j++) {
+                const size_t idx = x.index(i, j);
+                x[idx] += alpha * p[idx];
+                r[idx] -= alpha * Ap[idx];
+                local_r_dot += r[idx] * r[idx];
+            }
+        }
+        iterative_error_squared = allreduceSum(local_r_dot, decomposition);
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            break;
+        }
+
+        const T beta = iterative_error_squared / r_dot;
+        for (size_t i = 0; i < x.getRows(); i++) {
+            for (size_t j = 0; j < x.getCols(); j++) {
+                const size_t idx = x.index(i, j);
+                p[idx] = r[idx] + beta * p[idx];
+            }
+        }
+        r_dot = iterative_error_squared;
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    results.x = x.gather();
+    return results;
+}
+
+} // namespace MyMPI::Diffusion
+
+#endif // NE591_008_DISTRIBUTEDDIFFUSION_H
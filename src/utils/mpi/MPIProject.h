@@ -43,7 +43,7 @@ template <typename InputType, typename CommandLineParserType, typename OutputTyp
         MPI_Comm_size(MPI_COMM_WORLD, &this->_size);
         MPI_Comm_rank(MPI_COMM_WORLD, &this->_rank);
         _uuid = "["+hostname()+"]["+std::to_string(this->_rank)+"]: ";
-        _inputs = getInputs(header, args, this->_rank, this->_size);
+        _inputs = getInputs(header, args, this->_rank, this->_size, this->_workingPrecision);
     }
 
     /**
@@ -68,6 +68,10 @@ template <typename InputType, typename CommandLineParserType, typename OutputTyp
      * @brief The inputs for the project.
      */
     InputType _inputs;
+    /**
+     * @brief The floating point type selected with --working-precision, broadcast from the main process.
+     */
+    MyBLAS::Precision _workingPrecision = MyBLAS::PRECISION_LONG_DOUBLE;
     /**
      * @brief The outputs of the project.
      */
@@ -75,31 +79,59 @@ template <typename InputType, typename CommandLineParserType, typename OutputTyp
 
     /**
      * @brief Gets the inputs for the project. If the rank is not 0, it receives the inputs from the main process. If
-     * the rank is 0, it sends the inputs to all other processes.
+     * the rank is 0, it sends the inputs to all other processes. The working precision and the profiler settings, which
+     * only the main process parses, are broadcast alongside, so that every rank runs the same warmup and stopping rule.
      * @param header The header information for the project.
      * @param args The command line arguments.
      * @param rank The rank of the current process.
      * @param size The total number of processes.
+     * @param workingPrecision Set to the working precision parsed by the main process.
      * @return The inputs for the project.
      */
-    static InputType getInputs(HeaderInfo header, CommandLineArgs args, const int rank, const int size) {
-        // receive from main
+    static InputType getInputs(HeaderInfo header, CommandLineArgs args, const int rank, const int size,
+                               MyBLAS::Precision &workingPrecision) {
+        InputType inputs;
+        int precision = MyBLAS::PRECISION_LONG_DOUBLE;
         if (rank != 0) {
-            return blockingReceive<InputType>();
+            // receive from main
+            inputs = blockingReceive<InputType>();
+        } else {
+            // send to all but main
+            auto terminal = CommandLineParserType(header, args);
+            inputs = terminal.getInputs();
+            precision = terminal.getWorkingPrecision();
+            for(int i = 1; i < size; i++) {
+                blockingSend(inputs, i);
+            }
         }
+        MPI_Bcast(&precision, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        workingPrecision = static_cast<MyBLAS::Precision>(precision);
 
-        // send to all but main
-        InputType inputs;
-        auto terminal = CommandLineParserType(header, args);
-        inputs = terminal.getInputs();
-        for(int i = 1; i < size; i++) {
-            blockingSend(inputs, i);
-        }
+        int counters = PerformanceCounters::enabled() ? 1 : 0;
+        MPI_Bcast(&counters, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        PerformanceCounters::enabled() = counters != 0;
+        MPI_Bcast(&MemorySampler::interval(), 1, MPI_LONG_DOUBLE, 0, MPI_COMM_WORLD);
+        static_assert(std::is_trivially_copyable_v<Sampling>, "Sampling is broadcast as bytes");
+        MPI_Bcast(&Sampling::defaults(), sizeof(Sampling), MPI_BYTE, 0, MPI_COMM_WORLD);
         return inputs;
     }
 
+    /**
+     * @brief Calls func with the PrecisionTag of the working precision, on every rank.
+     * @tparam Func A generic callable, invoked as func(MyBLAS::PrecisionTag<T>{}).
+     * @param func The compute path to instantiate.
+     * @return Whatever func returns.
+     */
+    template <typename Func>
+    decltype(auto) dispatchWorkingPrecision(Func &&func) {
+        return MyBLAS::dispatchPrecision(_workingPrecision, std::forward<Func>(func));
+    }
+
     /**
      * @brief Creates a Profiler object with the given function, number of samples, timeout, and description.
+     * @details Before each run, the main process decides whether to keep running, and broadcasts it, so that every
+     * rank runs the function the same number of times even when the function is a collective, the timeout expires or
+     * the adaptive stopping rule is used.
      * @tparam Func The type of the function to be profiled.
      * @param func The function to be profiled.
      * @param samples The number of samples to be taken.
@@ -109,7 +141,13 @@ template <typename InputType, typename CommandLineParserType, typename OutputTyp
      */
     template <typename Func>
     auto getProfiler(Func func, size_t samples, long double timeout = 0, std::string description = "") {
-        return Profiler(func, samples, timeout, description);
+        auto profiler = Profiler(func, samples, timeout, description);
+        profiler.setConsensus([](const int decision) {
+            int shared = decision;
+            MPI_Bcast(&shared, 1, MPI_INT, 0, MPI_COMM_WORLD);
+            return shared;
+        });
+        return profiler;
     }
 
   public:
@@ -0,0 +1,192 @@
+/**
+* @file DistributedDiffusionTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for the domain-decomposed diffusion solvers. They pass on any number of ranks,
+* and compare the distributed solvers against the shared memory solvers on the full mesh.
+*/
+
+#include "mpi/CartesianDecomposition.h"
+#include "mpi/DistributedDiffusion.h"
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/RedBlackSOR.h"
+#include "math/relaxation/SORPJ.h"
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace MyMPI {
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> FloatTypes;
+TYPED_TEST_SUITE(DistributedDiffusionTests, FloatTypes);
+
+/**
+* @class DistributedDiffusionTests
+* @brief Test fixture for the domain-decomposed diffusion solvers with various floating-point types.
+* @tparam T The floating-point type to be used for testing.
+ */
+template <typename T>
+class DistributedDiffusionTests : public ::testing::Test {
+  protected:
+    static constexpr size_t meshRows = 13;
+    static constexpr size_t meshCols = 9;
+
+    static MyPhysics::Diffusion::Params<T> makeParams() { return TestProblems::makeParams<T>(meshRows, meshCols, 2); }
+
+    static MyBLAS::Matrix<T> makeSources() {
+        return MyBLAS::Matrix<T>(meshRows, meshCols, [](size_t i, size_t j) { return static_cast<T>((3 * i + 5 * j) % 7) + 1; });
+    }
+
+    static MyBLAS::Vector<T> flatten(const MyBLAS::Matrix<T> &sources) {
+        MyBLAS::Vector<T> b(meshRows * meshCols, 0);
+        for (size_t i = 0; i < meshRows; i++) {
+            for (size_t j = 0; j < meshCols; j++) {
+                b[i * meshCols + j] = sources[i][j];
+            }
+        }
+        return b;
+    }
+
+    static bool isRoot(const CartesianDecomposition &decomposition) { return decomposition.getRank() == 0; }
+};
+
+/**
+* @brief Test case for checking that every rank owns a disjoint block, and that the blocks cover the mesh.
+ */
+TYPED_TEST(DistributedDiffusionTests, DecompositionCoversMeshTest) {
+    const CartesianDecomposition decomposition(TestFixture::meshRows, TestFixture::meshCols);
+    unsigned long long owned = decomposition.getRows() * decomposition.getCols();
+    MPI_Allreduce(MPI_IN_PLACE, &owned, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, decomposition.getComm());
+    EXPECT_EQ(owned, TestFixture::meshRows * TestFixture::meshCols);
+    EXPECT_EQ(decomposition.getDims()[0] * decomposition.getDims()[1], decomposition.getSize());
+}
+
+/**
+* @brief Test case for checking that the ghost layer holds the neighboring mesh nodes after an exchange, and zero
+* outside the mesh, and that gathering reassembles the global field on rank 0.
+ */
+TYPED_TEST(DistributedDiffusionTests, HaloExchangeAndGatherTest) {
+    const size_t m = TestFixture::meshRows, n = TestFixture::meshCols;
+    const CartesianDecomposition decomposition(m, n);
+    const auto value = [n](const size_t i, const size_t j) { return static_cast<TypeParam>(i * n + j + 1); };
+
+    HaloField<TypeParam> field(decomposition);
+    const size_t firstRow = decomposition.getFirstRow(), firstCol = decomposition.getFirstCol();
+    for (size_t i = 0; i < field.getRows(); i++) {
+        for (size_t j = 0; j < field.getCols(); j++) {
+            field(i, j) = value(firstRow + i, firstCol + j);
+        }
+    }
+    field.exchange();
+
+    const size_t stride = field.getStride();
+    for (size_t i = 0; i < field.getRows(); i++) {
+        for (size_t j = 0; j < field.getCols(); j++) {
+            const size_t gi = firstRow + i, gj = firstCol + j, idx = field.index(i, j);
+            EXPECT_EQ(field[idx - stride], gi > 0 ? value(gi - 1, gj) : 0);
+            EXPECT_EQ(field[idx + stride], gi + 1 < m ? value(gi + 1, gj) : 0);
+            EXPECT_EQ(field[idx - 1], gj > 0 ? value(gi, gj - 1) : 0);
+            EXPECT_EQ(field[idx + 1], gj + 1 < n ? value(gi, gj + 1) : 0);
+        }
+    }
+
+    const auto global = field.gather();
+    if (TestFixture::isRoot(decomposition)) {
+        ASSERT_EQ(global.size(), m * n);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < n; j++) {
+                EXPECT_EQ(global[i * n + j], value(i, j));
+            }
+        }
+    } else {
+        EXPECT_EQ(global.size(), 0);
+    }
+}
+
+/**
+* @brief Test case for checking that the distributed stencil product matches the diffusion matrix product.
+ */
+TYPED_TEST(DistributedDiffusionTests, OperatorApplyTest) {
+    const auto params = TestFixture::makeParams();
+    const auto sources = TestFixture::makeSources();
+    const CartesianDecomposition decomposition(TestFixture::meshRows, TestFixture::meshCols);
+    const Diffusion::Operator<TypeParam> A(params);
+
+    auto x = Diffusion::localBlock(decomposition, sources);
+    HaloField<TypeParam> y(decomposition);
+    A.apply(x, y);
+
+    const auto product = y.gather();
+    if (TestFixture::isRoot(decomposition)) {
+        const MyPhysics::Diffusion::Matrix<TypeParam> matrix(params);
+        const auto expected = matrix * TestFixture::flatten(sources);
+        EXPECT_EQ(product, expected);
+    }
+}
+
+/**
+* @brief Test case for checking that the distributed Jacobi, red-black SOR and CG solvers follow the shared memory
+* solvers on the full mesh.
+ */
+TYPED_TEST(DistributedDiffusionTests, SolversMatchSharedMemoryTest) {
+    const size_t m = TestFixture::meshRows, n = TestFixture::meshCols;
+    const auto params = TestFixture::makeParams();
+    const auto sources = TestFixture::makeSources();
+    const CartesianDecomposition decomposition(m, n);
+    const Diffusion::Operator<TypeParam> A(params);
+    const auto b = Diffusion::localBlock(decomposition, sources);
+
+    const TypeParam threshold = std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+    const auto omega = static_cast<TypeParam>(1.3);
+    const size_t max_iterations = 2000;
+
+    HaloField<TypeParam> x(decomposition);
+    const auto jacobi = Diffusion::applyPointJacobi(A, b, x, max_iterations, threshold);
+    x = HaloField<TypeParam>(decomposition);
+    const auto redBlack = Diffusion::applyRedBlackSOR(A, b, x, max_iterations, threshold, omega);
+    const auto cg = Diffusion::applyConjugateGradient(A, b, x, max_iterations, threshold);
+
+    // the residual is computed on the ranks, and only gathered for the check
+    const auto r = Diffusion::residual(A, b, x);
+    const TypeParam r_norm = std::sqrt(Diffusion::dot(r, r));
+    EXPECT_LE(r_norm, 10 * threshold);
+
+    EXPECT_TRUE(jacobi.converged);
+    EXPECT_TRUE(redBlack.converged);
+    EXPECT_TRUE(cg.converged);
+    EXPECT_EQ(jacobi.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_POINT_JACOBI));
+    EXPECT_EQ(redBlack.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_SOR));
+    EXPECT_EQ(cg.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_CONJUGATE_GRADIENT));
+
+    if (!TestFixture::isRoot(decomposition)) {
+        return;
+    }
+
+    const MyPhysics::Diffusion::Matrix<TypeParam> matrix(params);
+    const auto flat = TestFixture::flatten(sources);
+    const auto check = [](const MyBLAS::Solver::Solution<TypeParam> &distributed,
+                          const MyBLAS::Solver::Solution<TypeParam> &shared, const TypeParam tolerance) {
+        EXPECT_LE(distributed.iterations, shared.iterations + 1);
+        EXPECT_GE(distributed.iterations + 1, shared.iterations);
+        ASSERT_EQ(distributed.x.size(), shared.x.size());
+        for (size_t i = 0; i < shared.x.size(); i++) {
+            EXPECT_LE(std::abs(distributed.x[i] - shared.x[i]), tolerance);
+        }
+    };
+
+    check(jacobi, MyRelaxationMethod::applyPointJacobi(matrix, flat, max_iterations, threshold), threshold);
+    check(redBlack, MyRelaxationMethod::applyRedBlackSOR(matrix, flat, m, n, max_iterations, threshold, omega), threshold);
+    check(cg, MyRelaxationMethod::applyConjugateGradient(matrix, flat, max_iterations, threshold), threshold);
+}
+
+} // namespace MyMPI
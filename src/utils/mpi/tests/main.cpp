@@ -0,0 +1,10 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
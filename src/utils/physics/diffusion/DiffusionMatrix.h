@@ -13,6 +13,10 @@
 #include "DiffusionConstants.h"
 #include "DiffusionParams.h"
 #include "math/blas/matrix/LazyMatrix.h"
+#include "math/blas/matrix/SparseMatrix.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/vector/Vector.h"
+#include <cassert>
 #include <ostream>
 
 /**
@@ -24,6 +28,12 @@ namespace MyPhysics::Diffusion {
 /**
  * @class Matrix
  * @brief This class represents a diffusion matrix. It extends the MyBLAS::LazyMatrix class.
+ * @details The matrix is the five-point finite difference stencil on an m x n mesh, with the unknown at node (i, j)
+ * stored at index i * n + j. Besides element-wise access through the generator, it implements the stencil operator
+ * interface from MyBLAS::is_stencil_operator, so the relaxation and CG solvers only ever touch the diagonal and the
+ * four neighbors (+/-1 along a mesh row, +/-n across mesh rows) of each node.
+ * @note Matrices built with a custom generator keep the stencil interface, but it falls back to calling the generator
+ * for every column of a row, so they are no faster than a dense matrix.
  * @tparam T The type of the elements in the matrix.
  */
 template <typename T>
@@ -49,6 +59,10 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
      * @brief The constants used in the diffusion process.
      */
     Constants<T> _constants{};
+    /**
+     * @brief Whether the elements come from the five-point generator, so the stencil methods can skip the generator.
+     */
+    bool _fivePoint = true;
 
   public:
     /**
@@ -82,13 +96,16 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
      * @brief Copy constructor.
      * @param matrix The matrix to copy.
      */
-    Matrix(const Matrix<T> &matrix): MyBLAS::LazyMatrix<T>(matrix), _params(matrix._params), _constants(Constants<T>::compute(matrix._params)) {
+    Matrix(const Matrix<T> &matrix): MyBLAS::LazyMatrix<T>(matrix), _params(matrix._params), _constants(Constants<T>::compute(matrix._params)), _fivePoint(matrix._fivePoint) {
         _size = matrix._size;
         this->setRows(_size);
         this->setCols(_size);
-        this->setGenerator([this](size_t i, size_t j) {
-            return generate(i, j, _constants);
-        });
+        // a custom generator was already copied by the base class
+        if (_fivePoint) {
+            this->setGenerator([this](size_t i, size_t j) {
+                return generate(i, j, _constants);
+            });
+        }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -96,9 +113,17 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
      * @brief Move constructor.
      * @param other The matrix to move from. It will be left in an unusable state.
      */
-    Matrix(Matrix<T> &&other) noexcept : MyBLAS::LazyMatrix<T>(std::move(other)), _params(std::move(other._params)), _constants(std::move(other._constants)) {
+    Matrix(Matrix<T> &&other) noexcept : MyBLAS::LazyMatrix<T>(std::move(other)), _params(std::move(other._params)), _constants(std::move(other._constants)), _fivePoint(other._fivePoint) {
         _size = other._size;
         other._size = 0;
+        this->setRows(_size);
+        this->setCols(_size);
+        // the moved generator still points at the other matrix's constants, so bind a new one to this matrix
+        if (_fivePoint) {
+            this->setGenerator([this](size_t i, size_t j) {
+                return generate(i, j, _constants);
+            });
+        }
         ResourceMonitor<Matrix<T>>::registerInstance(this);
     }
 
@@ -118,15 +143,18 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
      */
     Matrix& operator=(const Matrix& other) {
         if (this != &other) {
+            MyBLAS::LazyMatrix<T>::operator=(other);
             _params = other._params;
             _size = other._size;
             _constants = other._constants;
+            _fivePoint = other._fivePoint;
             this->setRows(_size);
             this->setCols(_size);
-            this->setGenerator([this](size_t i, size_t j) {
-                return generate(i, j, _constants);
-            });
-            ResourceMonitor<Matrix<T>>::registerInstance(this);
+            if (_fivePoint) {
+                this->setGenerator([this](size_t i, size_t j) {
+                    return generate(i, j, _constants);
+                });
+            }
         }
         return *this;
     }
@@ -151,12 +179,113 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
         }
         return 0;
     }
+    /**
+     * @brief Returns the diagonal entry of a row, without going through the five-point generator.
+     * @param row The row index.
+     * @return The diagonal entry, which is the same for every node of the mesh unless the generator is custom.
+     */
+    [[nodiscard]] T getStencilDiagonal(const size_t row) const {
+        if (!_fivePoint) {
+            return (*this)(row, row);
+        }
+        return _constants.diagonal;
+    }
+
+    /**
+     * @brief Calls function(col, value) for each of the (at most four) off-diagonal nonzeros in a row.
+     * @details Neighbors are visited in increasing column order: (i-1, j), (i, j-1), (i, j+1), (i+1, j). With a custom
+     * generator, every column of the row is generated instead, and the nonzeros are visited in the same order.
+     * @param row The row index.
+     * @param function The callable to invoke for every neighbor.
+     */
+    template <typename Function>
+    void forEachNeighbor(const size_t row, Function &&function) const {
+        if (!_fivePoint) {
+            for (size_t col = 0; col < _size; col++) {
+                const T value = (*this)(row, col);
+                if (col != row && value != 0) {
+                    function(col, value);
+                }
+            }
+            return;
+        }
+        const size_t n = _constants.n;
+        const size_t j = row % n;
+        if (row >= n) {
+            function(row - n, _constants.minus_D_over_delta_squared);
+        }
+        if (j > 0) {
+            function(row - 1, _constants.minus_D_over_gamma_squared);
+        }
+        if (j + 1 < n) {
+            function(row + 1, _constants.minus_D_over_gamma_squared);
+        }
+        if (row + n < _size) {
+            function(row + n, _constants.minus_D_over_delta_squared);
+        }
+    }
+
+    /**
+     * @brief Computes the off-diagonal part of a row product, i.e. the sum of a(row, col) * x[col] over col != row.
+     * @param row The row index.
+     * @param x The vector to multiply with.
+     * @return The off-diagonal row product.
+     */
+    template <class VectorType>
+    [[nodiscard]] T offDiagonalProduct(const size_t row, const VectorType &x) const {
+        T sum = 0;
+        forEachNeighbor(row, [&sum, &x](const size_t col, const T value) {
+            sum += value * x[col];
+        });
+        return sum;
+    }
+
+    /**
+     * @brief Fused matrix-vector product y = A * x, written into a caller-owned buffer.
+     * @param x The vector to multiply with.
+     * @param y The output vector. It must already have getRows() elements.
+     */
+    template <class VectorType>
+    void apply(const VectorType &x, VectorType &y) const {
+        assert(x.size() == _size);
+        assert(y.size() == _size);
+        const size_t size = _size;
+        #pragma omp parallel for default(none) shared(x, y, size)
+        for (size_t row = 0; row < size; row++) {
+            y[row] = getStencilDiagonal(row) * x[row] + offDiagonalProduct(row, x);
+        }
+    }
+
+    /**
+     * @brief Matrix-vector product y = A * x.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    template <class VectorType>
+    [[nodiscard]] VectorType apply(const VectorType &x) const {
+        VectorType y(_size, 0);
+        apply(x, y);
+        return y;
+    }
+
+    /**
+     * @brief Overload of the multiplication operator for multiplying a diffusion matrix and a MyBLAS::Vector.
+     * @details Preferred over the generic LazyMatrix overload, so that A * x only visits the nonzeros.
+     * @param A The diffusion matrix.
+     * @param x The vector to multiply with.
+     * @return The product A * x.
+     */
+    friend MyBLAS::Vector<T> operator*(const Matrix &A, const MyBLAS::Vector<T> &x) {
+        return A.apply(x);
+    }
+
     /**
      * @brief Constructor that takes diffusion parameters and a generator function.
+     * @details The stencil methods fall back to the generator, since its nonzeros need not be the five-point ones.
      * @param params The diffusion parameters.
      * @param generator The generator function.
      */
-    Matrix(const Params<T> &params, Generator generator): _params(params), _constants(Constants<T>::compute(params)) {
+    Matrix(const Params<T> &params, Generator generator): _params(params), _constants(Constants<T>::compute(params)), _fivePoint(false) {
         _size = _params.getM() * _params.getN();
         this->setRows(_size);
         this->setCols(_size);
@@ -173,6 +302,11 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
      * @return The diffusion constants.
      */
     [[maybe_unused]] [[nodiscard]] const Constants<T> &getConstants() const { return _constants; }
+    /**
+     * @brief Returns whether the elements come from the five-point generator.
+     * @return False if the matrix was built with a custom generator.
+     */
+    [[nodiscard]] bool isFivePoint() const { return _fivePoint; }
     /**
      * @brief Returns the number of rows in the matrix.
      * @return The number of rows in the matrix.
@@ -188,5 +322,18 @@ class Matrix : public MyBLAS::LazyMatrix<T> {
         return _size;
     }
 };
+
+/**
+ * @brief Builds the diffusion matrix for the given parameters directly in compressed sparse row format.
+ * @details Only the five stencil diagonals are visited, so neither the dense matrix nor the (m*n)^2 generator calls
+ * are ever needed.
+ * @tparam T The type of the elements in the matrix.
+ * @param params The diffusion parameters.
+ * @return The sparse diffusion matrix.
+ */
+template <typename T>
+MyBLAS::SparseMatrix<T> makeSparseMatrix(const Params<T> &params) {
+    return MyBLAS::SparseMatrix<T>(Matrix<T>(params));
+}
 }
 #endif // NE591_008_DIFFUSIONMATRIX_H
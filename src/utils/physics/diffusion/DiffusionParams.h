@@ -154,6 +154,25 @@ struct Params {
         setSources(sources);
     }
 
+    /**
+     * @brief Converts parameters of another precision, such as the float copy of the operator in a mixed precision
+     * solve. The mesh spacings are recomputed in FloatType.
+     *
+     * @param other The parameters to convert.
+     */
+    template <typename OtherType>
+    explicit Params(const Params<OtherType> &other) {
+        setM(other.getM());
+        setN(other.getN());
+        setA(static_cast<FloatType>(other.getA()));
+        setB(static_cast<FloatType>(other.getB()));
+        setDiffusionCoefficient(static_cast<FloatType>(other.getDiffusionCoefficient()));
+        setMacroscopicRemovalCrossSection(static_cast<FloatType>(other.getMacroscopicRemovalCrossSection()));
+        if (other.getSources().getRows() > 0) {
+            setSources(MyBLAS::Matrix<FloatType>(other.getSources()));
+        }
+    }
+
     /**
      * @brief Set the length of the rectangular region in the x-direction.
      *
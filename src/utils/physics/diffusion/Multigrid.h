@@ -0,0 +1,422 @@
+/**
+ * @file Multigrid.h
+ * @author Arjun Earthperson
+ * @date 10/17/2026
+ * @brief Geometric multigrid for the diffusion equation on the m x n mesh, as a standalone solver and as a
+ * preconditioner for conjugate gradient.
+ *
+ * Relaxation methods only damp the error components that oscillate on the scale of the mesh spacing, so their
+ * iteration counts grow with the mesh size. Multigrid smooths the error with a few red-black Gauss-Seidel sweeps, and
+ * removes the remaining smooth error on a coarser mesh, where it oscillates again. Applied recursively down to a mesh
+ * small enough to solve directly, each cycle reduces the error by a factor that does not depend on the mesh size, for
+ * O(m * n) work per cycle.
+ */
+
+#ifndef NE591_008_DIFFUSION_MULTIGRID_H
+#define NE591_008_DIFFUSION_MULTIGRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "DiffusionMatrix.h"
+#include "DiffusionParams.h"
+#include "math/blas/Ops.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/Factorization.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/RedBlackSOR.h"
+#include "math/relaxation/RelaxationMethods.h"
+#include "math/blas/solver/LinearSolver.h"
+
+namespace MyPhysics::Diffusion {
+
+/**
+ * @brief The shape of the recursion over the coarse meshes in each multigrid cycle.
+ */
+enum MultigridCycle {
+    CYCLE_V, ///< One coarse correction per level.
+    CYCLE_W, ///< Two coarse corrections per level, which is more robust but does more work on the coarse meshes.
+    CYCLE_F, ///< An F-cycle on the coarse mesh followed by a V-cycle, between the V and W cycles in cost.
+};
+
+/**
+ * @class Multigrid
+ * @brief A hierarchy of successively coarser diffusion meshes, with the transfer operators between them.
+ *
+ * Each coarse mesh keeps the physical dimensions a and b, and has about half as many nodes in each direction, with
+ * (m - 1) / 2 nodes for odd m and m / 2 for even m. When m = 2^k - 1 the coarse nodes are every other fine node, and
+ * the transfers reduce to the textbook full-weighting restriction and bilinear prolongation. Otherwise the coarse nodes
+ * do not line up with the fine ones, and the prolongation still interpolates bilinearly from the coarse nodes around
+ * each fine node. The restriction is always the transpose of the prolongation, scaled by the ratio of the cell areas,
+ * which keeps the cycle symmetric, as conjugate gradient needs. The coarse operators are rediscretized from the coarse
+ * Params, so every level is a five-point MyPhysics::Diffusion::Matrix. The coarsest mesh is factorized once, when the
+ * hierarchy is built.
+ *
+ * @tparam T The type of the matrix elements.
+ */
+template <typename T>
+class Multigrid {
+
+  public:
+    /**
+     * @brief The coarsest mesh is solved directly once it has at most this many nodes.
+     */
+    static constexpr size_t DefaultCoarsestSize = 64;
+
+    /**
+     * @brief Builds the mesh hierarchy for the diffusion problem described by params.
+     * @param params The parameters of the finest mesh.
+     * @param _cycle The cycle used by cycle() and apply().
+     * @param _preSmoothing The number of red-black Gauss-Seidel sweeps before each coarse correction.
+     * @param _postSmoothing The number of sweeps after each coarse correction, in the reverse color order.
+     * @param coarsestSize The largest mesh that is solved directly.
+     */
+    explicit Multigrid(const Params<T> &params, const MultigridCycle _cycle = CYCLE_V, const size_t _preSmoothing = 2,
+                       const size_t _postSmoothing = 2, const size_t coarsestSize = DefaultCoarsestSize)
+        : cycleType(_cycle), preSmoothing(_preSmoothing), postSmoothing(_postSmoothing) {
+        levels.emplace_back(params);
+        while (levels.back().size() > coarsestSize) {
+            const Params<T> &fine = levels.back().A.getParams();
+            const size_t m = coarsen(fine.getM()), n = coarsen(fine.getN());
+            if (m == fine.getM() && n == fine.getN()) {
+                break;
+            }
+            Params<T> coarse;
+            coarse.setA(fine.getA()).setB(fine.getB()).setM(m).setN(n);
+            coarse.setDiffusionCoefficient(fine.getDiffusionCoefficient());
+            coarse.setMacroscopicRemovalCrossSection(fine.getMacroscopicRemovalCrossSection());
+            levels.back().buildTransfers(coarse);
+            levels.emplace_back(coarse);
+        }
+        coarsest.factorize(levels.back().A);
+    }
+
+    /**
+     * @brief The number of meshes in the hierarchy, including the finest one.
+     */
+    [[nodiscard]] size_t getLevels() const { return levels.size(); }
+
+    /**
+     * @brief The mesh at a given level, where level 0 is the finest.
+     */
+    [[nodiscard]] const Matrix<T> &getOperator(const size_t level) const { return levels[level].A; }
+
+    /**
+     * @brief Runs one cycle on A * x = b, improving x in place.
+     */
+    void cycle(MyBLAS::Vector<T> &x, const MyBLAS::Vector<T> &b) {
+        levels.front().b = b;
+        levels.front().x = x;
+        cycle(0, cycleType);
+        x = levels.front().x;
+    }
+
+    /**
+     * @brief Applies one cycle from a zero guess, z = M^-1 * r.
+     * @details The smoothing sweeps after the coarse correction visit the colors in the reverse order of the ones
+     * before it, and the restriction is the scaled transpose of the prolongation, so M^-1 is symmetric, and positive
+     * definite for the diffusion operator. It can therefore precondition conjugate gradient, and satisfies
+     * MyRelaxationMethod::is_preconditioner.
+     */
+    void apply(const MyBLAS::Vector<T> &r, MyBLAS::Vector<T> &z) {
+        Level &finest = levels.front();
+        finest.b = r;
+        std::fill(finest.x.begin(), finest.x.end(), static_cast<T>(0));
+        cycle(0, cycleType);
+        z = finest.x;
+    }
+
+    /**
+     * @brief The fine mesh vector interpolated from the next coarser mesh, e_f = P * e_c.
+     */
+    [[nodiscard]] MyBLAS::Vector<T> prolongToFine(const size_t level, const MyBLAS::Vector<T> &coarse) const {
+        MyBLAS::Vector<T> fine(levels[level].size(), 0);
+        levels[level].prolongAdd(coarse, fine);
+        return fine;
+    }
+
+    /**
+     * @brief The fine mesh vector restricted to the next coarser mesh, r_c = R * r_f.
+     */
+    [[nodiscard]] MyBLAS::Vector<T> restrictToCoarse(const size_t level, const MyBLAS::Vector<T> &fine) const {
+        MyBLAS::Vector<T> coarse(levels[level + 1].size(), 0);
+        MyBLAS::Vector<T> scratch = levels[level].partial;
+        levels[level].restrictInto(fine, coarse, scratch);
+        return coarse;
+    }
+
+  private:
+    /**
+     * @brief The linear interpolation of one fine mesh line from the coarse mesh line.
+     * @details With M fine and K coarse nodes, fine node i sits at (i + 1) * (K + 1) / (M + 1) - 1 in coarse node
+     * units. It reads from coarse nodes first[i] and first[i] + 1, with weights 1 - weight[i] and weight[i]. The offsets
+     * are computed in integers, so that fine nodes on top of a coarse node read only from that node. Coarse indices
+     * outside [0, K) lie on the zero flux boundary, and are skipped.
+     */
+    struct Interpolation {
+        std::vector<long long> first;
+        std::vector<T> weight;
+        size_t coarseSize = 0;
+        T scale = 1; ///< The ratio of the fine and coarse mesh spacings, (K + 1) / (M + 1).
+
+        Interpolation() = default;
+        Interpolation(const size_t fineSize, const size_t _coarseSize)
+            : first(fineSize), weight(fineSize), coarseSize(_coarseSize),
+              scale(static_cast<T>(_coarseSize + 1) / static_cast<T>(fineSize + 1)) {
+            for (size_t i = 0; i < fineSize; i++) {
+                const size_t position = (i + 1) * (coarseSize + 1);
+                first[i] = static_cast<long long>(position / (fineSize + 1)) - 1;
+                weight[i] = static_cast<T>(position % (fineSize + 1)) / static_cast<T>(fineSize + 1);
+            }
+        }
+
+        /**
+         * @brief Calls function(coarse, weight) for the (at most two) coarse nodes that fine node i reads from.
+         */
+        template <typename Function>
+        void forEach(const size_t i, Function &&function) const {
+            const long long I = first[i];
+            const auto size = static_cast<long long>(coarseSize);
+            if (I >= 0) {
+                function(static_cast<size_t>(I), static_cast<T>(1) - weight[i]);
+            }
+            if (weight[i] > 0 && I + 1 < size) {
+                function(static_cast<size_t>(I + 1), weight[i]);
+            }
+        }
+    };
+
+    /**
+     * @brief One mesh of the hierarchy, with its work vectors and its transfers to the next coarser mesh.
+     */
+    struct Level {
+        Matrix<T> A;
+        MyBLAS::Vector<T> x;
+        MyBLAS::Vector<T> b;
+        MyBLAS::Vector<T> r;
+        MyBLAS::Vector<T> partial; ///< Scratch for the restriction along the mesh rows, fine m x coarse n.
+        Interpolation rows;
+        Interpolation cols;
+
+        explicit Level(const Params<T> &params)
+            : A(params), x(params.getM() * params.getN(), 0), b(params.getM() * params.getN(), 0),
+              r(params.getM() * params.getN(), 0) {}
+
+        [[nodiscard]] size_t size() const { return x.size(); }
+        [[nodiscard]] size_t m() const { return A.getParams().getM(); }
+        [[nodiscard]] size_t n() const { return A.getParams().getN(); }
+
+        void buildTransfers(const Params<T> &coarse) {
+            rows = Interpolation(m(), coarse.getM());
+            cols = Interpolation(n(), coarse.getN());
+            partial = MyBLAS::Vector<T>(m() * coarse.getN(), 0);
+        }
+
+        /**
+         * @brief fine += P * coarse, one fine node at a time, so the fine rows can be split over threads.
+         */
+        void prolongAdd(const MyBLAS::Vector<T> &coarse, MyBLAS::Vector<T> &fine) const {
+            const Interpolation &rowMap = rows, &colMap = cols;
+            const size_t fineM = m(), fineN = n(), coarseN = colMap.coarseSize;
+            #pragma omp parallel for default(none) shared(coarse, fine, rowMap, colMap, fineM, fineN, coarseN)
+            for (size_t i = 0; i < fineM; i++) {
+                for (size_t j = 0; j < fineN; j++) {
+                    T sum = 0;
+                    rowMap.forEach(i, [&](const size_t I, const T wi) {
+                        colMap.forEach(j, [&](const size_t J, const T wj) {
+                            sum += wi * wj * coarse[I * coarseN + J];
+                        });
+                    });
+                    fine[i * fineN + j] += sum;
+                }
+            }
+        }
+
+        /**
+         * @brief coarse = R * fine, where R is the transpose of P scaled by the ratio of the cell areas.
+         * @details The restriction is done one direction at a time, first along each fine row into the scratch
+         * vector, then along each coarse column, so that every thread only writes to its own row or column.
+         */
+        void restrictInto(const MyBLAS::Vector<T> &fine, MyBLAS::Vector<T> &coarse, MyBLAS::Vector<T> &scratch) const {
+            const Interpolation &rowMap = rows, &colMap = cols;
+            const size_t fineM = m(), fineN = n(), coarseM = rowMap.coarseSize, coarseN = colMap.coarseSize;
+            #pragma omp parallel for default(none) shared(fine, scratch, colMap, fineM, fineN, coarseN)
+            for (size_t i = 0; i < fineM; i++) {
+                for (size_t J = 0; J < coarseN; J++) {
+                    scratch[i * coarseN + J] = 0;
+                }
+                for (size_t j = 0; j < fineN; j++) {
+                    colMap.forEach(j, [&](const size_t J, const T wj) {
+                        scratch[i * coarseN + J] += colMap.scale * wj * fine[i * fineN + j];
+                    });
+                }
+            }
+            #pragma omp parallel for default(none) shared(coarse, scratch, rowMap, fineM, coarseM, coarseN)
+            for (size_t J = 0; J < coarseN; J++) {
+                for (size_t I = 0; I < coarseM; I++) {
+                    coarse[I * coarseN + J] = 0;
+                }
+                for (size_t i = 0; i < fineM; i++) {
+                    rowMap.forEach(i, [&](const size_t I, const T wi) {
+                        coarse[I * coarseN + J] += rowMap.scale * wi * scratch[i * coarseN + J];
+                    });
+                }
+            }
+        }
+
+        /**
+         * @brief Red-black Gauss-Seidel sweeps on A * x = b, red first, or black first when reversed.
+         */
+        void smooth(const size_t sweeps, const bool reversed) {
+            const Matrix<T> &matrix = A;
+            const MyBLAS::Vector<T> &rhs = b;
+            MyBLAS::Vector<T> &solution = x;
+            const size_t rowCount = m(), colCount = n();
+            const auto first = reversed ? MyRelaxationMethod::MESH_COLOR_BLACK : MyRelaxationMethod::MESH_COLOR_RED;
+            const auto second = reversed ? MyRelaxationMethod::MESH_COLOR_RED : MyRelaxationMethod::MESH_COLOR_BLACK;
+            for (size_t sweep = 0; sweep < sweeps; sweep++) {
+                #pragma omp parallel default(none) shared(matrix, rhs, solution, rowCount, colCount, first, second)
+                {
+                    #pragma omp for schedule(static)
+                    for (size_t i = 0; i < rowCount; i++) {
+                        MyRelaxationMethod::relaxMeshRow(matrix, rhs, solution, colCount, i, first, static_cast<T>(1));
+                    }
+                    #pragma omp for schedule(static)
+                    for (size_t i = 0; i < rowCount; i++) {
+                        MyRelaxationMethod::relaxMeshRow(matrix, rhs, solution, colCount, i, second, static_cast<T>(1));
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief r = b - A * x.
+         */
+        void computeResidual() {
+            A.apply(x, r);
+            MyBLAS::xpay(b, static_cast<T>(-1), r);
+        }
+    };
+
+    std::vector<Level> levels;
+    MyFactorizationMethod::Factorization<T> coarsest;
+    MultigridCycle cycleType;
+    size_t preSmoothing;
+    size_t postSmoothing;
+
+    /**
+     * @brief The size of the coarse mesh line, or the same size when the line is too short to coarsen.
+     */
+    static size_t coarsen(const size_t size) {
+        if (size < 3) {
+            return size;
+        }
+        return (size % 2 == 1) ? (size - 1) / 2 : size / 2;
+    }
+
+    /**
+     * @brief Improves levels[level].x for the right hand side levels[level].b, with the given cycle shape.
+     */
+    void cycle(const size_t level, const MultigridCycle shape) {
+        Level &current = levels[level];
+        if (level + 1 == levels.size()) {
+            current.x = current.b;
+            coarsest.solveInPlace(current.x);
+            return;
+        }
+
+        current.smooth(preSmoothing, false);
+        current.computeResidual();
+
+        Level &next = levels[level + 1];
+        current.restrictInto(current.r, next.b, current.partial);
+        std::fill(next.x.begin(), next.x.end(), static_cast<T>(0));
+        switch (shape) {
+        case CYCLE_V:
+            cycle(level + 1, CYCLE_V);
+            break;
+        case CYCLE_W:
+            cycle(level + 1, CYCLE_W);
+            cycle(level + 1, CYCLE_W);
+            break;
+        case CYCLE_F:
+            cycle(level + 1, CYCLE_F);
+            cycle(level + 1, CYCLE_V);
+            break;
+        }
+        current.prolongAdd(next.x, current.x);
+
+        current.smooth(postSmoothing, true);
+    }
+};
+
+/**
+ * @brief Solves the diffusion equation by repeated multigrid cycles, starting from a zero guess.
+ * @param params The diffusion parameters of the mesh.
+ * @param b The right hand side, with node (i, j) at index i * n + j.
+ * @param max_iterations The maximum number of cycles.
+ * @param tolerance The convergence threshold on the L2 norm of the residual b - A * x.
+ * @param cycle The cycle shape.
+ * @return A Solution object containing the solution vector, the number of cycles performed, whether the method
+ * converged, and the final residual norm.
+ */
+template <typename T>
+MyBLAS::Solver::Solution<T> applyMultigrid(const Params<T> &params, const MyBLAS::Vector<T> &b, const size_t max_iterations,
+                                           const T tolerance, const MultigridCycle cycle = CYCLE_V) {
+    Multigrid<T> multigrid(params, cycle);
+    const Matrix<T> &A = multigrid.getOperator(0);
+
+    MyBLAS::Solver::Solution<T> results(b.size());
+    results.method = MyRelaxationMethod::METHOD_MULTIGRID;
+    MyBLAS::Vector<T> &x = results.x;
+    MyBLAS::Vector<T> r(b.size(), 0);
+
+    const T tolerance_squared = std::pow(tolerance, static_cast<T>(2));
+    T iterative_error_squared = b * b; // the residual of the zero guess
+
+    for (results.iterations = 0; results.iterations < max_iterations; ++(results.iterations)) {
+        if (iterative_error_squared < tolerance_squared) {
+            results.converged = true;
+            break;
+        }
+        multigrid.cycle(x, b);
+        A.apply(x, r);
+        MyBLAS::xpay(b, static_cast<T>(-1), r); // r = b - A * x
+        iterative_error_squared = r * r;
+    }
+    if (!results.converged && iterative_error_squared < tolerance_squared) {
+        results.converged = true;
+    }
+
+    results.iterative_error = std::sqrt(iterative_error_squared);
+    return results;
+}
+
+/**
+ * @brief Conjugate gradient on the diffusion equation, preconditioned by one multigrid cycle per iteration.
+ * @details With a V-cycle preconditioner, the number of iterations hardly grows with the mesh size, while each
+ * iteration costs a few times a plain CG iteration.
+ * @param params The diffusion parameters of the mesh.
+ * @param b The right hand side, with node (i, j) at index i * n + j.
+ * @param max_iterations The maximum number of iterations.
+ * @param tolerance The convergence threshold on the L2 norm of the residual.
+ * @param cycle The cycle shape of the preconditioner.
+ * @return A Solution object containing the solution vector, the number of iterations performed, whether the method
+ * converged, and the final residual norm.
+ */
+template <typename T>
+MyBLAS::Solver::Solution<T> applyMultigridPreconditionedConjugateGradient(const Params<T> &params, const MyBLAS::Vector<T> &b,
+                                                                          const size_t max_iterations, const T tolerance,
+                                                                          const MultigridCycle cycle = CYCLE_V) {
+    Multigrid<T> multigrid(params, cycle);
+    auto results = MyRelaxationMethod::applyPreconditionedConjugateGradient(multigrid.getOperator(0), b, multigrid, max_iterations, tolerance);
+    results.method = MyRelaxationMethod::METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT;
+    return results;
+}
+
+} // namespace MyPhysics::Diffusion
+
+#endif // NE591_008_DIFFUSION_MULTIGRID_H
@@ -0,0 +1,149 @@
+/**
+* @file DiffusionMultigridTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for the geometric multigrid solver and preconditioner of the diffusion mesh.
+*/
+
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+#include "physics/diffusion/Multigrid.h"
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+#include "math/relaxation/ConjugateGradient.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace MyPhysics::Diffusion;
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> FloatTypes;
+TYPED_TEST_SUITE(DiffusionMultigridTests, FloatTypes);
+
+/**
+* @class DiffusionMultigridTests
+* @brief Test fixture for testing the multigrid solver with various floating-point types.
+* @tparam T The floating-point type to be used for testing.
+ */
+template <typename T>
+class DiffusionMultigridTests : public ::testing::Test {};
+
+/**
+* @brief Test case for checking that the hierarchy halves each mesh line until the coarsest mesh is small.
+ */
+TYPED_TEST(DiffusionMultigridTests, HierarchyTest) {
+    const Multigrid<TypeParam> multigrid(TestProblems::makeParams<TypeParam>(63, 30));
+    ASSERT_EQ(multigrid.getLevels(), 4);
+    EXPECT_EQ(multigrid.getOperator(1).getParams().getM(), 31);
+    EXPECT_EQ(multigrid.getOperator(1).getParams().getN(), 15);
+    EXPECT_EQ(multigrid.getOperator(2).getParams().getM(), 15);
+    EXPECT_EQ(multigrid.getOperator(2).getParams().getN(), 7);
+    EXPECT_EQ(multigrid.getOperator(3).getParams().getM(), 7);
+    EXPECT_EQ(multigrid.getOperator(3).getParams().getN(), 3);
+    EXPECT_EQ(multigrid.getOperator(3).getParams().getA(), 2);
+    EXPECT_EQ(multigrid.getOperator(3).getParams().getB(), 3);
+}
+
+/**
+* @brief Test case for checking that the transfers are full weighting and bilinear interpolation on nested meshes, and
+* that the restriction is the scaled transpose of the prolongation on nested and non-nested meshes alike.
+ */
+TYPED_TEST(DiffusionMultigridTests, TransfersTest) {
+    const Multigrid<TypeParam> nested(TestProblems::makeParams<TypeParam>(7, 7), CYCLE_V, 2, 2, 0);
+    MyBLAS::Vector<TypeParam> coarse(9, 0);
+    coarse[4] = 1; // the center of the 3 x 3 coarse mesh, on top of fine node (3, 3)
+    const auto fine = nested.prolongToFine(0, coarse);
+    EXPECT_EQ(fine[3 * 7 + 3], 1);
+    EXPECT_EQ(fine[2 * 7 + 3], static_cast<TypeParam>(0.5));
+    EXPECT_EQ(fine[2 * 7 + 2], static_cast<TypeParam>(0.25));
+    EXPECT_EQ(fine[1 * 7 + 3], 0);
+
+    MyBLAS::Vector<TypeParam> spike(49, 0);
+    spike[3 * 7 + 3] = 1;
+    const auto restricted = nested.restrictToCoarse(0, spike);
+    EXPECT_EQ(restricted[4], static_cast<TypeParam>(0.25));
+
+    const TypeParam tolerance = 64 * std::numeric_limits<TypeParam>::epsilon();
+    for (const auto &[rows, cols] : {std::pair<size_t, size_t>{7, 7}, {10, 13}}) {
+        const Multigrid<TypeParam> multigrid(TestProblems::makeParams<TypeParam>(rows, cols), CYCLE_V, 2, 2, 0);
+        const auto &fineParams = multigrid.getOperator(0).getParams();
+        const auto &coarseParams = multigrid.getOperator(1).getParams();
+        const TypeParam area = (coarseParams.getDelta() * coarseParams.getGamma()) /
+                               (fineParams.getDelta() * fineParams.getGamma());
+        const auto u = TestProblems::makeSources<TypeParam>(fineParams.getM() * fineParams.getN());
+        const auto v = TestProblems::makeSources<TypeParam>(coarseParams.getM() * coarseParams.getN() + 3);
+        MyBLAS::Vector<TypeParam> vc(coarseParams.getM() * coarseParams.getN(), 0);
+        for (size_t i = 0; i < vc.size(); i++) {
+            vc[i] = v[i + 3];
+        }
+        // (R u, v) = (fine area / coarse area) * (u, P v)
+        const TypeParam lhs = multigrid.restrictToCoarse(0, u) * vc * area;
+        const TypeParam rhs = u * multigrid.prolongToFine(0, vc);
+        EXPECT_LE(std::abs(lhs - rhs), tolerance * std::abs(rhs));
+    }
+}
+
+/**
+* @brief Test case for checking that the multigrid solution matches the direct solution, with every cycle shape.
+ */
+TYPED_TEST(DiffusionMultigridTests, SolverMatchesDirectTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(15, 12);
+    const Matrix<TypeParam> A(params);
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const auto expected = MyBLAS::LUP::applyLUP(MyBLAS::Matrix<TypeParam>(A), b);
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    for (const auto cycle : {CYCLE_V, CYCLE_W, CYCLE_F}) {
+        const auto solution = applyMultigrid(params, b, 100, threshold, cycle);
+        EXPECT_TRUE(solution.converged);
+        EXPECT_EQ(solution.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_MULTIGRID));
+        EXPECT_LE(solution.iterative_error, threshold);
+        for (size_t i = 0; i < b.size(); i++) {
+            EXPECT_LE(std::abs(solution.x[i] - expected.x[i]), threshold);
+        }
+    }
+}
+
+/**
+* @brief Test case for checking that the number of cycles does not grow with the mesh size, on nested and non-nested
+* meshes.
+ */
+TYPED_TEST(DiffusionMultigridTests, MeshIndependentConvergenceTest) {
+    for (const size_t size : {15, 31, 63, 20, 48}) {
+        const auto params = TestProblems::makeParams<TypeParam>(size, size);
+        const auto b = TestProblems::makeSources<TypeParam>(size * size);
+        const auto solution = applyMultigrid(params, b, 100, TestProblems::threshold(b));
+        EXPECT_TRUE(solution.converged) << "mesh " << size;
+        EXPECT_LE(solution.iterations, 15) << "mesh " << size;
+    }
+}
+
+/**
+* @brief Test case for checking that multigrid preconditioned CG matches plain CG in fewer iterations.
+ */
+TYPED_TEST(DiffusionMultigridTests, PreconditionedConjugateGradientTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(40, 33);
+    const Matrix<TypeParam> A(params);
+    const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+    const TypeParam threshold = TestProblems::threshold(b);
+
+    const auto cg = MyRelaxationMethod::applyConjugateGradient(A, b, 2000, threshold);
+    const auto mgcg = applyMultigridPreconditionedConjugateGradient(params, b, 2000, threshold);
+    EXPECT_TRUE(cg.converged);
+    EXPECT_TRUE(mgcg.converged);
+    EXPECT_EQ(mgcg.method, MyBLAS::Solver::Type(MyRelaxationMethod::METHOD_MULTIGRID_PRECONDITIONED_CONJUGATE_GRADIENT));
+    EXPECT_LT(4 * mgcg.iterations, cg.iterations);
+
+    const auto r = b - A * mgcg.x;
+    EXPECT_LE(std::sqrt(r * r), 2 * threshold);
+    for (size_t i = 0; i < b.size(); i++) {
+        EXPECT_LE(std::abs(mgcg.x[i] - cg.x[i]), threshold);
+    }
+}
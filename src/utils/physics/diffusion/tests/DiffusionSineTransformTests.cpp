@@ -0,0 +1,180 @@
+/**
+* @file DiffusionSineTransformTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for the fast Fourier and sine transforms, and for the sine transform solver of
+* the diffusion mesh.
+*/
+
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+#include "physics/diffusion/SineTransformSolver.h"
+
+#include "math/FFT.h"
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <complex>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+using namespace MyPhysics::Diffusion;
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> FloatTypes;
+TYPED_TEST_SUITE(DiffusionSineTransformTests, FloatTypes);
+
+/**
+* @class DiffusionSineTransformTests
+* @brief Test fixture for testing the sine transform solver with various floating-point types.
+* @tparam T The floating-point type to be used for testing.
+ */
+template <typename T>
+class DiffusionSineTransformTests : public ::testing::Test {
+  protected:
+    static T tolerance() { return 100 * std::numeric_limits<T>::epsilon(); }
+};
+
+/**
+* @brief Test case for checking the mixed-radix and Bluestein transforms against the DFT sum, and their inverses.
+ */
+TYPED_TEST(DiffusionSineTransformTests, FourierTransformTest) {
+    for (const size_t n : {1, 2, 8, 64, 7, 12, 30, 45, 67, 134}) {
+        const FFT::Plan<TypeParam> plan(n);
+        std::vector<std::complex<TypeParam>> input(n), data(n), workspace(plan.workspaceSize());
+        for (size_t j = 0; j < n; j++) {
+            input[j] = std::complex<TypeParam>(static_cast<TypeParam>(std::sin(static_cast<double>(3 * j + 1))),
+                                               static_cast<TypeParam>(j % 3) - 1);
+        }
+        data = input;
+        plan.forward(data.data(), workspace.data());
+
+        for (size_t k = 0; k < n; k++) {
+            std::complex<long double> expected(0, 0);
+            for (size_t j = 0; j < n; j++) {
+                const long double angle = -2.0L * M_PIl * static_cast<long double>((j * k) % n) / static_cast<long double>(n);
+                expected += std::complex<long double>(input[j].real(), input[j].imag()) *
+                            std::complex<long double>(std::cos(angle), std::sin(angle));
+            }
+            EXPECT_LE(std::abs(static_cast<long double>(data[k].real()) - expected.real()), TestFixture::tolerance() * static_cast<TypeParam>(n));
+            EXPECT_LE(std::abs(static_cast<long double>(data[k].imag()) - expected.imag()), TestFixture::tolerance() * static_cast<TypeParam>(n));
+        }
+
+        plan.inverse(data.data(), workspace.data());
+        for (size_t j = 0; j < n; j++) {
+            EXPECT_LE(std::abs(data[j] - input[j]), TestFixture::tolerance());
+        }
+    }
+}
+
+/**
+* @brief Test case for checking the sine transform of a pair of sequences against its definition, for lengths whose
+* extension is and is not a power of two, and that applying it twice scales by (N + 1) / 2.
+ */
+TYPED_TEST(DiffusionSineTransformTests, SineTransformTest) {
+    for (const size_t n : {1, 7, 10, 66}) {
+        const FFT::SinePlan<TypeParam> plan(n);
+        auto work = plan.workspace();
+        std::vector<TypeParam> a(n), b(n);
+        for (size_t j = 0; j < n; j++) {
+            a[j] = static_cast<TypeParam>(j + 1);
+            b[j] = static_cast<TypeParam>(std::cos(static_cast<double>(j)));
+        }
+        const auto a0 = a, b0 = b;
+        plan.transform(a.data(), b.data(), work);
+
+        for (size_t k = 0; k < n; k++) {
+            long double expectedA = 0, expectedB = 0;
+            for (size_t j = 0; j < n; j++) {
+                const long double s = std::sin(M_PIl * static_cast<long double>((j + 1) * (k + 1)) / static_cast<long double>(n + 1));
+                expectedA += a0[j] * s;
+                expectedB += b0[j] * s;
+            }
+            EXPECT_LE(std::abs(static_cast<long double>(a[k]) - expectedA), TestFixture::tolerance() * static_cast<TypeParam>(n * n));
+            EXPECT_LE(std::abs(static_cast<long double>(b[k]) - expectedB), TestFixture::tolerance() * static_cast<TypeParam>(n));
+        }
+
+        plan.transform(a.data(), nullptr, work);
+        const TypeParam scale = static_cast<TypeParam>(n + 1) / 2;
+        for (size_t j = 0; j < n; j++) {
+            EXPECT_LE(std::abs(a[j] - scale * a0[j]), TestFixture::tolerance() * static_cast<TypeParam>(n * n));
+        }
+    }
+}
+
+/**
+* @brief Test case for checking that each sine mode is an eigenvector of the stencil, with the tabulated eigenvalue.
+ */
+TYPED_TEST(DiffusionSineTransformTests, EigenvalueTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(9, 6);
+    const Matrix<TypeParam> A(params);
+    const SineTransformSolver<TypeParam> solver(params);
+    const size_t m = params.getM(), n = params.getN();
+
+    for (const auto &[p, q] : std::vector<std::pair<size_t, size_t>>{{1, 1}, {4, 2}, {9, 6}}) {
+        const MyBLAS::Vector<TypeParam> mode(m * n, [&](size_t idx) {
+            const long double i = static_cast<long double>(idx / n + 1), j = static_cast<long double>(idx % n + 1);
+            return static_cast<TypeParam>(std::sin(M_PIl * static_cast<long double>(p) * i / static_cast<long double>(m + 1)) *
+                                          std::sin(M_PIl * static_cast<long double>(q) * j / static_cast<long double>(n + 1)));
+        });
+        const auto Amode = A * mode;
+        const TypeParam lambda = solver.eigenvalue(p, q);
+        for (size_t k = 0; k < m * n; k++) {
+            EXPECT_LE(std::abs(Amode[k] - lambda * mode[k]), TestFixture::tolerance() * lambda);
+        }
+    }
+}
+
+/**
+* @brief Test case for checking the direct solve against LUP, on meshes with power-of-two and other transform lengths.
+ */
+TYPED_TEST(DiffusionSineTransformTests, SolveTest) {
+    for (const auto &[rows, cols] : std::vector<std::pair<size_t, size_t>>{{15, 15}, {13, 7}, {10, 21}}) {
+        const auto params = TestProblems::makeParams<TypeParam>(rows, cols);
+        const Matrix<TypeParam> A(params);
+        const auto b = TestProblems::makeSources<TypeParam>(A.getRows());
+
+        const auto dst = applySineTransform(params, b);
+        EXPECT_TRUE(dst.converged);
+        EXPECT_EQ(dst.method, MyBLAS::Solver::Type(MyFactorizationMethod::METHOD_DST));
+
+        const auto lup = MyBLAS::LUP::applyLUP(MyBLAS::Matrix<TypeParam>(A), b);
+        TypeParam scale = 0;
+        for (size_t k = 0; k < b.size(); k++) {
+            scale = std::max(scale, std::abs(lup.x[k]));
+        }
+        for (size_t k = 0; k < b.size(); k++) {
+            EXPECT_LE(std::abs(dst.x[k] - lup.x[k]), 10 * TestFixture::tolerance() * scale);
+        }
+
+        const auto r = b - A * dst.x;
+        TypeParam residual = 0;
+        for (size_t k = 0; k < r.size(); k++) {
+            residual = std::max(residual, std::abs(r[k]));
+        }
+        EXPECT_LE(residual, 10 * TestFixture::tolerance() * 4);
+    }
+}
+
+/**
+* @brief Test case for checking that the solve gives the same result in place.
+ */
+TYPED_TEST(DiffusionSineTransformTests, InPlaceTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(11, 5);
+    const SineTransformSolver<TypeParam> solver(params);
+    const auto b = TestProblems::makeSources<TypeParam>(params.getM() * params.getN());
+    auto copy = b;
+
+    MyBLAS::Vector<TypeParam> x(b.size(), 0);
+    solver.solve(b, x);
+    solver.solve(copy, copy);
+    for (size_t k = 0; k < b.size(); k++) {
+        EXPECT_EQ(copy[k], x[k]);
+    }
+}
@@ -0,0 +1,243 @@
+/**
+* @file DiffusionStencilTests.cpp
+* @author Arjun Earthperson
+* @date 10/17/2026
+*
+* @brief This file contains test cases for the matrix-free stencil interface of the DiffusionMatrix class.
+*/
+
+#include "physics/diffusion/DiffusionMatrix.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/matrix/StencilOperator.h"
+#include "math/blas/vector/Vector.h"
+#include "math/factorization/LUP.h"
+#include "math/relaxation/ConjugateGradient.h"
+#include "math/relaxation/RedBlackSOR.h"
+#include "math/relaxation/SOR.h"
+#include "math/relaxation/SORPJ.h"
+#include "math/relaxation/SSOR.h"
+
+#include "DiffusionTestProblems.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace MyPhysics::Diffusion;
+
+// Define a list of types to run the tests with
+typedef ::testing::Types<float, double, long double> FloatTypes;
+TYPED_TEST_SUITE(DiffusionStencilTests, FloatTypes);
+
+/**
+* @class DiffusionStencilTests
+* @brief Test fixture for testing the stencil interface of the DiffusionMatrix class with various floating-point types.
+* @tparam T The floating-point type to be used for testing.
+ */
+template <typename T>
+class DiffusionStencilTests : public ::testing::Test {
+  protected:
+    /**
+     * @brief Builds a non-square mesh, so that the +/-1 and +/-n neighbors have different coefficients.
+     */
+    static Params<T> makeParams() {
+        return TestProblems::makeParams<T>(5, 4, 2);
+    }
+
+    static MyBLAS::Vector<T> makeVector(const size_t size) { return TestProblems::makeSources<T>(size, 7, 4); }
+};
+
+/**
+* @brief Test case for checking that the diffusion matrix is detected as a stencil operator, and a dense matrix is not.
+ */
+TYPED_TEST(DiffusionStencilTests, IsDetectedAsStencilOperatorTest) {
+    EXPECT_TRUE(MyBLAS::is_stencil_operator_v<Matrix<TypeParam>>);
+    EXPECT_FALSE(MyBLAS::is_stencil_operator_v<MyBLAS::Matrix<TypeParam>>);
+    EXPECT_FALSE(MyBLAS::is_stencil_operator_v<MyBLAS::LazyMatrix<TypeParam>>);
+}
+
+/**
+* @brief Test case for checking that the diagonal and the neighbors visited by the stencil are exactly the nonzeros
+* produced by the generator, and nothing else.
+ */
+TYPED_TEST(DiffusionStencilTests, NeighborsMatchGeneratorTest) {
+    const auto params = TestFixture::makeParams();
+    const Matrix<TypeParam> A(params);
+    const size_t size = A.getRows();
+    for (size_t row = 0; row < size; row++) {
+        EXPECT_EQ(A.getStencilDiagonal(row), A(row, row));
+        MyBLAS::Vector<TypeParam> visited(size, 0);
+        size_t count = 0;
+        A.forEachNeighbor(row, [&](const size_t col, const TypeParam value) {
+            EXPECT_NE(col, row);
+            EXPECT_EQ(value, A(row, col));
+            visited[col] = value;
+            count++;
+        });
+        EXPECT_LE(count, 4);
+        for (size_t col = 0; col < size; col++) {
+            if (col != row) {
+                EXPECT_EQ(visited[col], A(row, col));
+            }
+        }
+    }
+}
+
+/**
+* @brief Test case for checking that the fused apply matches the product with the materialized dense matrix.
+ */
+TYPED_TEST(DiffusionStencilTests, ApplyMatchesDenseProductTest) {
+    const auto params = TestFixture::makeParams();
+    const Matrix<TypeParam> A(params);
+    const MyBLAS::Matrix<TypeParam> dense(A);
+    const auto x = TestFixture::makeVector(A.getRows());
+
+    const auto expected = dense * x;
+    MyBLAS::Vector<TypeParam> y(A.getRows(), 0);
+    A.apply(x, y);
+    const auto product = A * x;
+
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_LE(std::abs(y[i] - expected[i]), tolerance);
+        EXPECT_LE(std::abs(product[i] - expected[i]), tolerance);
+    }
+}
+
+/**
+* @brief Test case for checking that a matrix built with a custom generator, including its copies, applies that
+* generator's nonzeros rather than the five-point stencil.
+ */
+TYPED_TEST(DiffusionStencilTests, CustomGeneratorTest) {
+    const auto params = TestFixture::makeParams();
+    const Matrix<TypeParam> stencil(params);
+    const size_t size = stencil.getRows();
+    // twice the five-point matrix, with an extra pair of nonzeros between the first and the last node
+    const Matrix<TypeParam> A(params, [&stencil, size](const size_t i, const size_t j) {
+        const bool corner = (i == 0 && j == size - 1) || (i == size - 1 && j == 0);
+        return 2 * stencil(i, j) + (corner ? static_cast<TypeParam>(-0.5) : 0);
+    });
+    const Matrix<TypeParam> copy(A);
+    const MyBLAS::Matrix<TypeParam> dense(A);
+    const auto x = TestFixture::makeVector(size);
+
+    EXPECT_TRUE(stencil.isFivePoint());
+    EXPECT_FALSE(A.isFivePoint());
+    EXPECT_FALSE(copy.isFivePoint());
+
+    size_t neighbors = 0;
+    A.forEachNeighbor(0, [&](const size_t col, const TypeParam value) {
+        EXPECT_EQ(value, dense[0][col]);
+        neighbors++;
+    });
+    EXPECT_EQ(neighbors, 3);
+
+    const auto expected = dense * x;
+    const auto product = A * x;
+    const auto copied = copy * x;
+    const TypeParam tolerance = 1000 * std::numeric_limits<TypeParam>::epsilon();
+    for (size_t i = 0; i < size; i++) {
+        EXPECT_EQ(A.getStencilDiagonal(i), 2 * stencil.getStencilDiagonal(i));
+        EXPECT_LE(std::abs(product[i] - expected[i]), tolerance);
+        EXPECT_LE(std::abs(copied[i] - expected[i]), tolerance);
+    }
+}
+
+/**
+* @brief Test case for checking that the relaxation and CG solvers give the same answer on the stencil operator as on
+* the materialized dense matrix.
+ */
+TYPED_TEST(DiffusionStencilTests, SolversMatchDenseMatrixTest) {
+    const auto params = TestFixture::makeParams();
+    const Matrix<TypeParam> A(params);
+    const MyBLAS::Matrix<TypeParam> dense(A);
+    const auto b = TestFixture::makeVector(A.getRows());
+    const size_t max_iterations = 1000;
+    const TypeParam threshold = std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+    const auto omega = static_cast<TypeParam>(1.2);
+    const TypeParam tolerance = 100 * threshold;
+
+    const auto check = [&](const MyBLAS::Solver::Solution<TypeParam> &stencil, const MyBLAS::Solver::Solution<TypeParam> &reference) {
+        for (size_t i = 0; i < b.size(); i++) {
+            EXPECT_LE(std::abs(stencil.x[i] - reference.x[i]), tolerance);
+        }
+    };
+
+    check(MyRelaxationMethod::applyPointJacobi(A, b, max_iterations, threshold),
+          MyRelaxationMethod::applyPointJacobi(dense, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applySORSerial(A, b, max_iterations, threshold, omega),
+          MyRelaxationMethod::applySORSerial(dense, b, max_iterations, threshold, omega));
+    check(MyRelaxationMethod::applySSOR(A, b, max_iterations, threshold, omega),
+          MyRelaxationMethod::applySSOR(dense, b, max_iterations, threshold, omega));
+    check(MyRelaxationMethod::applyConjugateGradient(A, b, max_iterations, threshold),
+          MyRelaxationMethod::applyConjugateGradient(dense, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applyJacobiPreconditionedConjugateGradient(A, b, max_iterations, threshold),
+          MyRelaxationMethod::applyJacobiPreconditionedConjugateGradient(dense, b, max_iterations, threshold));
+    check(MyRelaxationMethod::applyPipelinedConjugateGradient(A, b, max_iterations, threshold),
+          MyRelaxationMethod::applyConjugateGradient(dense, b, max_iterations, threshold));
+}
+
+/**
+* @brief Test case for checking that red-black SOR on the mesh coloring converges to the direct solution, and that the
+* tiled wavefront sweeps reproduce the untiled sweeps for any tile height.
+ */
+TYPED_TEST(DiffusionStencilTests, RedBlackSORTest) {
+    const auto params = TestProblems::makeParams<TypeParam>(13, 9, 2);
+    const Matrix<TypeParam> A(params);
+    const MyBLAS::Matrix<TypeParam> dense(A);
+    const auto b = TestFixture::makeVector(A.getRows());
+    const size_t m = params.getM(), n = params.getN();
+    const TypeParam threshold = std::sqrt(std::numeric_limits<TypeParam>::epsilon());
+    const auto omega = static_cast<TypeParam>(1.3);
+
+    const auto exact = MyBLAS::LUP::applyLUP(dense, b);
+    const auto untiled = MyRelaxationMethod::applyRedBlackSOR(A, b, m, n, 1000, threshold, omega);
+    EXPECT_TRUE(untiled.converged);
+    for (size_t i = 0; i < b.size(); i++) {
+        EXPECT_LE(std::abs(untiled.x[i] - exact.x[i]), 100 * threshold);
+    }
+
+    // the first iteration from the zero guess does not depend on the convergence check, so it must match exactly
+    const auto oneUntiled = MyRelaxationMethod::applyRedBlackSOR(A, b, m, n, 1, threshold, omega);
+    for (const size_t tileRows : {1, 2, 3, 5, 13, 20}) {
+        const auto oneTiled = MyRelaxationMethod::applyRedBlackSOR(A, b, m, n, 1, threshold, omega, 2, tileRows);
+        EXPECT_EQ(oneTiled.x, oneUntiled.x) << "tileRows = " << tileRows;
+
+        const auto tiled = MyRelaxationMethod::applyRedBlackSOR(A, b, m, n, 1000, threshold, omega, 2, tileRows);
+        EXPECT_TRUE(tiled.converged);
+        EXPECT_LE(tiled.iterations, untiled.iterations + 1);
+        EXPECT_GE(tiled.iterations + 1, untiled.iterations);
+        for (size_t i = 0; i < b.size(); i++) {
+            EXPECT_LE(std::abs(tiled.x[i] - untiled.x[i]), threshold);
+        }
+    }
+
+    // the dense matrix takes the same path through the generic row helpers
+    const auto fromDense = MyRelaxationMethod::applyRedBlackSOR(dense, b, m, n, 1, threshold, omega);
+    for (size_t i = 0; i < b.size(); i++) {
+        EXPECT_LE(std::abs(fromDense.x[i] - oneUntiled.x[i]), 100 * std::numeric_limits<TypeParam>::epsilon());
+    }
+}
+
+/**
+* @brief Test case for checking that the CSR copy of the diffusion matrix stores exactly the stencil nonzeros.
+ */
+TYPED_TEST(DiffusionStencilTests, SparseMatrixMatchesStencilTest) {
+    const auto params = TestFixture::makeParams();
+    const Matrix<TypeParam> A(params);
+    const auto sparse = makeSparseMatrix(params);
+    const auto x = TestFixture::makeVector(A.getRows());
+
+    // one diagonal per mesh point, plus both directions of every adjacent pair along the rows and the columns
+    const size_t m = 5, n = 4;
+    EXPECT_EQ(sparse.getNonZeros(), m * n + 2 * (m - 1) * n + 2 * m * (n - 1));
+
+    const auto expected = A * x;
+    const auto product = sparse * x;
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_EQ(sparse.getStencilDiagonal(i), A.getStencilDiagonal(i));
+        EXPECT_LE(std::abs(product[i] - expected[i]), 1000 * std::numeric_limits<TypeParam>::epsilon());
+    }
+}
@@ -0,0 +1,127 @@
+/**
+* @file MemorySampler.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief This file contains the MemorySampler class, which records the memory held by the process while the profiled
+* function runs.
+* @details A background thread wakes up every interval and reads the bytes held by the monitored containers and the
+* resident set size of the process, so the memory over time comes from the timed runs themselves, without an extra,
+* untimed run. The thread sleeps in between, and is only counted by the performance counters for the microseconds it
+* takes to read /proc/self/status.
+*/
+
+#ifndef NE591_008_MEMORYSAMPLER_H
+#define NE591_008_MEMORYSAMPLER_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ResourceMonitor.h"
+
+/**
+ * @class MemorySampler
+ * @brief Samples the memory of the process on a background thread, between start() and stop().
+ */
+class MemorySampler {
+  public:
+    /**
+     * @brief One sample: nanoseconds since start(), the bytes held by the monitored containers, and the resident bytes.
+     */
+    using Sample = std::array<long double, 3>;
+
+    /**
+     * @brief The process-wide sampling interval in milliseconds, set from --bench-memory-interval. Zero disables the
+     * sampler, leaving only the peaks.
+     */
+    static long double &interval() {
+        static long double milliseconds = 10;
+        return milliseconds;
+    }
+
+    MemorySampler() = default;
+    MemorySampler(const MemorySampler &) = delete;
+    MemorySampler &operator=(const MemorySampler &) = delete;
+    ~MemorySampler() { stop(); }
+
+    /**
+     * @brief Starts the sampling thread, which takes a first sample right away.
+     */
+    void start() {
+        stop();
+        _samples.clear();
+        if (interval() <= 0) {
+            return;
+        }
+        _stopping = false;
+        _begin = std::chrono::steady_clock::now();
+        _thread = std::thread([this] { loop(); });
+    }
+
+    /**
+     * @brief Takes a last sample and joins the sampling thread.
+     * @return The samples, in the order they were taken.
+     */
+    const std::vector<Sample> &stop() {
+        if (_thread.joinable()) {
+            {
+                const std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _wake.notify_one();
+            _thread.join();
+        }
+        return _samples;
+    }
+
+  private:
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _stopping = false;
+    std::chrono::steady_clock::time_point _begin;
+    std::vector<Sample> _samples; ///< Only written by the sampling thread, and only read after it is joined.
+
+    void sample() {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin);
+        _samples.push_back({static_cast<long double>(elapsed.count()),
+                            static_cast<long double>(Resources::total().current()),
+                            static_cast<long double>(Resources::residentBytes())});
+    }
+
+    /**
+     * @brief Once this many samples are taken, every other one is dropped and the interval is doubled, so that long
+     * benchmarks keep a bounded, evenly spaced series.
+     */
+    static constexpr size_t MaxSamples = 4096;
+
+    void loop() {
+        const auto period = std::chrono::duration<long double, std::milli>(interval());
+        auto step = std::max(std::chrono::duration_cast<std::chrono::steady_clock::duration>(period),
+                             std::chrono::steady_clock::duration(1));
+        auto next = _begin;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            sample();
+            if (_samples.size() >= MaxSamples) {
+                for (size_t k = 0; 2 * k < _samples.size(); k++) {
+                    _samples[k] = _samples[2 * k];
+                }
+                _samples.resize((_samples.size() + 1) / 2);
+                step *= 2;
+            }
+            // a sampler that fell behind skips ahead, rather than catching up with a burst of samples
+            next = std::max(next + step, std::chrono::steady_clock::now());
+            if (_wake.wait_until(lock, next, [this] { return _stopping; })) {
+                sample();
+                return;
+            }
+        }
+    }
+};
+
+#endif // NE591_008_MEMORYSAMPLER_H
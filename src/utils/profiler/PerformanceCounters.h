@@ -0,0 +1,280 @@
+/**
+* @file PerformanceCounters.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief This file contains the PerformanceCounters class, which reads the Linux perf_event_open hardware counters
+* around each profiled run.
+* @details The hardware events are CPU cycles, retired instructions, L1 data cache read misses, last level cache
+* misses, branch misses, and, on Intel CPUs, retired SSE/AVX floating point arithmetic instructions. The task clock,
+* page faults and context switches are software events, which the kernel keeps even where the PMU is not exposed, such
+* as in most virtual machines. Every thread of the process is counted, so OpenMP regions are included. Events that the
+* kernel refuses, because of perf_event_paranoid, a missing PMU, or a non-Linux build, are simply absent from the
+* results.
+*/
+
+#ifndef NE591_008_PERFORMANCECOUNTERS_H
+#define NE591_008_PERFORMANCECOUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @class PerformanceCounters
+ * @brief Counts hardware and software events over an interval, summed over all threads of the process.
+ *
+ * Counters are opened for every thread listed in /proc/self/task when the interval starts, and closed when it stops,
+ * so threads spawned in between are not counted, which is why the Profiler creates the OpenMP thread pool before the
+ * first run. When the kernel multiplexes more events than the PMU has registers, each count is scaled by the fraction
+ * of the interval it was actually counted for.
+ */
+class PerformanceCounters {
+  public:
+    /**
+     * @brief The counted events, in the order of the keys.
+     */
+    enum Event {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,
+        LLC_MISSES,
+        BRANCH_MISSES,
+        FP_INSTRUCTIONS,
+        TASK_CLOCK,
+        PAGE_FAULTS,
+        CONTEXT_SWITCHES,
+        EVENT_COUNT,
+    };
+
+    /**
+     * @brief The counts of one interval. An event that could not be counted is NaN.
+     */
+    using Counts = std::array<long double, EVENT_COUNT>;
+
+    /**
+     * @brief Function to get the string representation of an event, as used in the results JSON.
+     */
+    static const char *Key(const size_t event) {
+        static const char *eventKeys[] = {
+            "cycles",
+            "instructions",
+            "l1d-misses",
+            "llc-misses",
+            "branch-misses",
+            "fp-instructions",
+            "task-clock-ns",
+            "page-faults",
+            "context-switches",
+        };
+        return eventKeys[event];
+    }
+
+    /**
+     * @brief The process-wide switch, set from --bench-no-counters. Disabled counters cost nothing.
+     */
+    static bool &enabled() {
+        static bool enable = true;
+        return enable;
+    }
+
+    PerformanceCounters() = default;
+    PerformanceCounters(const PerformanceCounters &) = delete;
+    PerformanceCounters &operator=(const PerformanceCounters &) = delete;
+    ~PerformanceCounters() { close(); }
+
+    /**
+     * @brief Opens, resets and enables the counters on every thread of the process.
+     */
+    void start() {
+        close();
+        if (!enabled()) {
+            return;
+        }
+#if defined(__linux__)
+        const auto threads = listThreads();
+        int firstError = 0;
+        for (size_t event = 0; event < EVENT_COUNT; event++) {
+            perf_event_attr attributes{};
+            if (!describe(event, attributes)) {
+                continue;
+            }
+            for (const auto thread : threads) {
+                const long descriptor = syscall(SYS_perf_event_open, &attributes, thread, -1, -1, 0);
+                if (descriptor < 0) {
+                    firstError = firstError ? firstError : errno;
+                    continue;
+                }
+                _descriptors[event].push_back(static_cast<int>(descriptor));
+            }
+        }
+        warnOnce(firstError);
+        for (const auto &descriptors : _descriptors) {
+            for (const int descriptor : descriptors) {
+                ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Disables and reads the counters, and closes them.
+     * @return The counts since start(), summed over the threads.
+     */
+    Counts stop() {
+        Counts counts;
+        counts.fill(std::numeric_limits<long double>::quiet_NaN());
+#if defined(__linux__)
+        for (const auto &descriptors : _descriptors) {
+            for (const int descriptor : descriptors) {
+                ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (size_t event = 0; event < EVENT_COUNT; event++) {
+            long double total = 0;
+            bool counted = false;
+            for (const int descriptor : _descriptors[event]) {
+                // value, time enabled, time running
+                std::uint64_t values[3] = {0, 0, 0};
+                if (read(descriptor, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0) {
+                    continue;
+                }
+                total += static_cast<long double>(values[0]) * static_cast<long double>(values[1]) /
+                         static_cast<long double>(values[2]);
+                counted = true;
+            }
+            if (counted) {
+                counts[event] = total;
+            }
+        }
+#endif
+        close();
+        return counts;
+    }
+
+  private:
+    std::array<std::vector<int>, EVENT_COUNT> _descriptors; ///< The open counters of each event, one per thread.
+
+    void close() {
+        for (auto &descriptors : _descriptors) {
+#if defined(__linux__)
+            for (const int descriptor : descriptors) {
+                ::close(descriptor);
+            }
+#endif
+            descriptors.clear();
+        }
+    }
+
+#if defined(__linux__)
+    static std::vector<pid_t> listThreads() {
+        std::vector<pid_t> threads;
+        if (DIR *directory = opendir("/proc/self/task")) {
+            while (const dirent *entry = readdir(directory)) {
+                if (entry->d_name[0] != '.') {
+                    threads.push_back(static_cast<pid_t>(std::stol(entry->d_name)));
+                }
+            }
+            closedir(directory);
+        }
+        if (threads.empty()) {
+            threads.push_back(0);
+        }
+        return threads;
+    }
+
+    /**
+     * @brief Only Intel's FP_ARITH_INST_RETIRED (event 0xC7, all unit masks) counts floating point arithmetic in a
+     * documented way. It counts SSE and AVX instructions, so long double arithmetic, which runs on the x87 unit, is not
+     * included.
+     */
+    static bool isIntel() {
+        static const bool intel = [] {
+            std::ifstream cpuinfo("/proc/cpuinfo");
+            std::string line;
+            while (std::getline(cpuinfo, line)) {
+                if (line.rfind("vendor_id", 0) == 0) {
+                    return line.find("GenuineIntel") != std::string::npos;
+                }
+            }
+            return false;
+        }();
+        return intel;
+    }
+
+    static bool describe(const size_t event, perf_event_attr &attributes) {
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch (event) {
+        case CYCLES:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+            return true;
+        case INSTRUCTIONS:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+            return true;
+        case L1D_MISSES:
+            attributes.type = PERF_TYPE_HW_CACHE;
+            attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            return true;
+        case LLC_MISSES:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+            return true;
+        case BRANCH_MISSES:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+            return true;
+        case FP_INSTRUCTIONS:
+            attributes.type = PERF_TYPE_RAW;
+            attributes.config = 0xFFC7;
+            return isIntel();
+        case TASK_CLOCK:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_TASK_CLOCK;
+            return true;
+        case PAGE_FAULTS:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_PAGE_FAULTS;
+            return true;
+        case CONTEXT_SWITCHES:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static void warnOnce(const int error) {
+        static bool warned = false;
+        if (error && !warned) {
+            warned = true;
+            std::cerr << "Warning: some performance counters are unavailable (perf_event_open: " << std::strerror(error)
+                      << "). Check /proc/sys/kernel/perf_event_paranoid, or pass --bench-no-counters.\n";
+        }
+    }
+#endif
+};
+
+#endif // NE591_008_PERFORMANCECOUNTERS_H
@@ -2,12 +2,22 @@
 * @file Profiler.h
 * @author Arjun Earthperson
 * @date 10/11/2023
-* @brief This file contains the Profiler class which is used to profile the execution time of a function.
+* @brief This file contains the Profiler class which is used to profile the execution time of a function, the
+* hardware performance counters of each run, and the memory held while the runs execute.
+* @details The function is first run a few untimed times, if warmup is set, and then timed either a fixed number of
+* times, or until the confidence interval of the mean is narrow enough, as set in Sampling.h. The durations are
+* summarized with bootstrap confidence intervals of the median and the mean, and a count of the outlying runs.
+*
+* When the project is configured with -DENABLE_PROFILER_ZONES=ON, the zones recorded inside the function are
+* also totalled over the runs and printed with the summary.
 */
 
 #ifndef NE591_008_PROFILER_H
 #define NE591_008_PROFILER_H
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <functional>
 #include <iomanip>
@@ -16,12 +26,15 @@
 #include <utility>
 
 #include "CheckBounds.h"
+#include "MemorySampler.h"
+#include "PerformanceCounters.h"
 #include "ResourceMonitor.h"
+#include "Sampling.h"
 #include "Stopwatch.h"
+#include "Zones.h"
 #include "json.hpp"
 #include "math/blas/matrix/Matrix.h"
 #include "math/blas/vector/Vector.h"
-#include "physics/diffusion/DiffusionMatrix.h"
 #include "utils/math/Stats.h"
 
 /**
@@ -35,15 +48,15 @@ class Profiler {
    /**
     * @brief Constructor for the Profiler class.
     * @param function The function to be profiled.
-    * @param runs The number of times the function should be run for profiling.
-    * @param timeout The maximum time allowed for the function to run.
+    * @param runs The number of times the function should be run for profiling, or the fewest in the adaptive mode.
+    * @param timeout The maximum time in seconds allowed for the timed runs, 0 for no limit.
     * @param description A description of the function being profiled.
     */
    explicit Profiler(FunctionType function, size_t runs = 1, long double timeout = 0, std::string description = ""): _function(function) {
        _timedOut = false;
        _totalRuns = runs > 0 ? runs : 1;
        _timeout = timeout > 0 ? timeout : 0;
-       _stopwatches = std::vector<Stopwatch<Nanoseconds>>(0);
+       _sampling = Sampling::defaults();
        _description = std::move(description);
        _summary = MyBLAS::Stats::Summary<long double>();
    }
@@ -55,9 +68,29 @@ class Profiler {
     */
    Profiler() = default;
 
+   /**
+    * @brief What the timed runs do next, as decided before each run.
+    */
+   enum Decision : int {
+       CONTINUE = 0,
+       STOP = 1,
+       TIMED_OUT = 2,
+   };
+
+   /**
+    * @brief Sets how the processes of a distributed run agree on each Decision, when every run is a collective. The
+    * function is given this process's decision, and returns the one that every process follows. Without it, each
+    * process follows its own.
+    * @return A reference to this Profiler object.
+    */
+   Profiler &setConsensus(std::function<int(int)> consensus) {
+       _consensus = std::move(consensus);
+       return *this;
+   }
+
    /**
     * @brief Gets the total number of runs for profiling.
-    * @return The total number of runs for profiling.
+    * @return The total number of runs for profiling, which in the adaptive mode is the number of runs timed.
     */
    [[nodiscard]] size_t getTotalRuns() const { return _totalRuns; }
 
@@ -67,14 +100,26 @@ class Profiler {
     */
    Profiler &run() {
        resetRuns();
-       _summary.maxBytes = checkMemoryUsage();
-       if (_timeout > 0) {
-           _timedOut = runWithTimeout();
-       } else {
-           runNoTimeout();
-           _timedOut = false;
+       // the OpenMP pool is created before the first run, so that the counters of every run include its threads
+       #pragma omp parallel
+       {
        }
-       summarize(_summary, _stopwatches);
+       warmup();
+       Resources::total().clear();
+       Resources::resetPeakResidentBytes();
+       MemorySampler sampler;
+       sampler.start();
+       _timedOut = runTimed();
+       _summary.memory = sampler.stop();
+       _summary.maxBytes = Resources::total().peak();
+       _summary.peakResidentBytes = Resources::peakResidentBytes();
+       summarize(_summary, _durations, _sampling);
+       summarize(_summary, _counts);
+#if defined(ENABLE_PROFILER_ZONES)
+       const auto events = Zones::Registry::instance().collect();
+       _zones = Zones::aggregate(events);
+       Zones::Registry::instance().trace(events);
+#endif
        return *this;
    }
 
@@ -96,9 +141,13 @@ class Profiler {
     */
    friend std::ostream &operator<<(std::ostream &os, const Profiler &m) {
        os << R"(:::::::::::::::::::::::::::: PROFILE SUMMARY [ns] ::::::::::::::::::::::::::::::)"<<std::endl;
-       os << "["<<m._stopwatches.size()<<"/"<<m._totalRuns<<"] : "<<m._description<<std::endl;
+       os << "["<<m._durations.size()<<"/"<<m._totalRuns<<"] : "<<m._description<<std::endl;
        os << R"(::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::)"<<std::endl;
        os << m._summary << std::endl;
+       if (!m._zones.empty()) {
+           os << R"(::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::)"<<std::endl;
+           Zones::print(os, m._zones);
+       }
        os << R"(::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::)"<<std::endl;
        return os;
    }
@@ -108,7 +157,7 @@ class Profiler {
     * @return The summary of the profiling.
     */
    const MyBLAS::Stats::Summary<long double> &getSummary(bool allocated = false) {
-       _summary.runs = _stopwatches.size();
+       _summary.runs = _durations.size();
        //_summary.memory = getMemoryUsage(_summary.runs, allocated);
        return _summary;
    }
@@ -119,47 +168,70 @@ class Profiler {
    long double _timeout{}; ///< The maximum time allowed for the function to run.
    bool _timedOut{}; ///< Whether the function timed out during profiling.
    std::string _description; ///< A description of the function being profiled.
-   std::vector<Stopwatch<Nanoseconds>> _stopwatches; ///< A vector of stopwatches to time each run of the function.
+   Sampling _sampling; ///< The warmup, stopping rule and confidence intervals.
+   MyBLAS::Stats::Samples<long double> _durations; ///< The duration of each timed run of the function, in nanoseconds.
+   std::vector<PerformanceCounters::Counts> _counts; ///< The performance counters of each run of the function.
    MyBLAS::Stats::Summary<long double> _summary; ///< The summary of the profiling.
-
-   ResourceMonitor<MyBLAS::Matrix<MyBLAS::NumericType>>* _matrixResources = &ResourceMonitor<MyBLAS::Matrix<MyBLAS::NumericType>>::getInstance();
-   ResourceMonitor<MyBLAS::Vector<MyBLAS::NumericType>>* _vectorResources = &ResourceMonitor<MyBLAS::Vector<MyBLAS::NumericType>>::getInstance();
-   ResourceMonitor<MyPhysics::Diffusion::Matrix<MyBLAS::NumericType>>* _lazyMatrixResources = &ResourceMonitor<MyPhysics::Diffusion::Matrix<MyBLAS::NumericType>>::getInstance();
+   std::map<std::string, Zones::Aggregate> _zones; ///< The zones recorded in the timed runs, totalled by name.
+   std::function<int(int)> _consensus; ///< Turns this process's Decision into the one every process follows.
 
    /**
-    * @brief Runs the function for profiling without a timeout.
+    * @brief Runs the function the warmup number of times, untimed and uncounted, and discards the zones they record.
     */
-   void runNoTimeout() {
-       for(size_t i = 0; i < _totalRuns; i++) {
-           auto stopwatch = Stopwatch<Nanoseconds>().restart();
+   void warmup() {
+       for (size_t i = 0; i < _sampling.warmup; i++) {
            _function();
-           stopwatch.click();
-           _stopwatches.emplace_back(stopwatch);
        }
+       Zones::Registry::instance().clear();
    }
 
    /**
-    * @brief Runs the function for profiling with a timeout.
-    * @return Whether the function timed out during profiling.
+    * @brief Times the runs, stopping after the requested number of runs or, in the adaptive mode, once the relative
+    * half-width of the confidence interval of the mean is below the target or the maximum number of runs is reached.
+    * @return Whether the timeout stopped the runs first.
     */
-   bool runWithTimeout() {
-       auto timeoutWatch = Stopwatch<Nanoseconds>();
-       timeoutWatch.restart();
-
-       for(size_t i = 0; i < _totalRuns; i++) {
-           // timed out
-           if(timeoutWatch.peek_elapsed_time().count() > _timeout) {
-               _timedOut = true;
+   bool runTimed() {
+       const bool adaptive = _sampling.targetHalfWidth > 0;
+       const size_t fewest = adaptive ? std::max(_totalRuns, Sampling::MinimumAdaptiveRuns) : _totalRuns;
+       const size_t most = adaptive ? std::max(_sampling.maxRuns, fewest) : _totalRuns;
+       auto timeoutWatch = Stopwatch<Nanoseconds>().restart();
+       PerformanceCounters counters;
+       int decision = CONTINUE;
+
+       while (true) {
+           decision = CONTINUE;
+           const auto elapsed = std::chrono::duration_cast<std::chrono::duration<long double>>(timeoutWatch.peek_elapsed_time());
+           if (_durations.size() >= most) {
+               decision = STOP;
+           } else if (adaptive && _durations.size() >= fewest &&
+                      _durations.relativeHalfWidth(_sampling.confidence) <= _sampling.targetHalfWidth) {
+               // converged
+               decision = STOP;
+           } else if (_timeout > 0 && elapsed.count() > _timeout) {
+               decision = TIMED_OUT;
+           }
+           if (_consensus) {
+               decision = _consensus(decision);
+           }
+           if (decision != CONTINUE) {
                break;
            }
            // run the calculation
+           counters.start();
            auto stopwatch = Stopwatch<Nanoseconds>().restart();
-           _function();
+           {
+               PROFILE_ZONE(_description.c_str());
+               _function();
+           }
            stopwatch.click();
-           _stopwatches.emplace_back(stopwatch);
+           _counts.emplace_back(counters.stop());
+           _durations.add(static_cast<long double>(stopwatch.duration().count()));
        }
 
-       return _timedOut;
+       if (adaptive) {
+           _totalRuns = _durations.size();
+       }
+       return decision == TIMED_OUT;
    }
 
    /**
@@ -167,52 +239,57 @@ class Profiler {
     */
    void resetRuns() {
        _timedOut = false;
-       _stopwatches.clear();
-       _stopwatches.resize(0);
+       _zones.clear();
+       _durations.clear();
+       _counts.clear();
        _summary = MyBLAS::Stats::Summary<long double>();
    }
 
-   size_t preRunMemoryCheck() {
-       _matrixResources->clear();
-       _vectorResources->clear();
-       _lazyMatrixResources->clear();
-       return _matrixResources->getMaxBytesEver() +
-              _vectorResources->getMaxBytesEver() +
-              _lazyMatrixResources->getMaxBytesEver();
-   }
-
-   size_t checkMemoryUsage() {
-       preRunMemoryCheck();
-       _function();
-       return postRunMemoryCheck();
+   /**
+    * @brief Summarizes the results of the profiling.
+    * @details The percentiles share one in-place sort of the durations, rather than each copying them.
+    * @param summary The summary to store the results in.
+    * @param durations The duration of each timed run of the function.
+    * @param sampling The warmup and confidence intervals of the runs.
+    */
+   static void summarize(MyBLAS::Stats::Summary<long double> &summary, MyBLAS::Stats::Samples<long double> &durations, const Sampling &sampling) {
+       summary.min = durations.min();
+       summary.max = durations.max();
+       summary.sum = durations.sum();
+       summary.mean = durations.mean();
+       summary.variance = durations.variance();
+       summary.stddev = std::sqrt(summary.variance);
+       summary.median = durations.median();
+       summary.p5th = durations.percentile(5);
+       summary.p95th = durations.percentile(95);
+       summary.outliers = durations.outliers();
+       summary.warmup = sampling.warmup;
+       summary.confidence = sampling.confidence;
+       const auto bounds = durations.bootstrap(sampling.confidence, sampling.resamples);
+       summary.ciMedian = {bounds[0], bounds[1]};
+       summary.ciMean = {bounds[2], bounds[3]};
    }
 
-   size_t postRunMemoryCheck() {
-       return _matrixResources->getMaxBytesEver() +
-              _vectorResources->getMaxBytesEver() +
-              _lazyMatrixResources->getMaxBytesEver();
-   }
    /**
-    * @brief Summarizes the results of the profiling.
+    * @brief Summarizes the performance counters as their mean per run, over the runs in which they were counted.
     * @param summary The summary to store the results in.
-    * @param stopwatches The stopwatches used to time each run of the function.
+    * @param counts The performance counters of each run of the function.
     */
-   static void summarize(MyBLAS::Stats::Summary<long double> &summary, const std::vector<Stopwatch<Nanoseconds>> &stopwatches) {
-
-       // Create an array of durations
-       MyBLAS::Vector<long double> durations(stopwatches.size());
-       std::transform(stopwatches.begin(), stopwatches.end(), durations.getData().begin(), [](const Stopwatch<Nanoseconds>& stopwatch) { return stopwatch.duration().count(); });
-
-       // Calculate statistics
-       summary.min = MyBLAS::Stats::min(durations);
-       summary.max = MyBLAS::Stats::max(durations);
-       summary.sum = MyBLAS::Stats::sum(durations);
-       summary.mean = MyBLAS::Stats::mean(durations);
-       summary.variance = MyBLAS::Stats::variance(durations);
-       summary.stddev = MyBLAS::Stats::std(durations);
-       summary.median = MyBLAS::Stats::median(durations);
-       summary.p5th = MyBLAS::Stats::percentile(durations, 5);
-       summary.p95th = MyBLAS::Stats::percentile(durations, 95);
+   static void summarize(MyBLAS::Stats::Summary<long double> &summary, const std::vector<PerformanceCounters::Counts> &counts) {
+       summary.counters.clear();
+       for (size_t event = 0; event < PerformanceCounters::EVENT_COUNT; event++) {
+           long double total = 0;
+           size_t counted = 0;
+           for (const auto &run : counts) {
+               if (!std::isnan(run[event])) {
+                   total += run[event];
+                   counted++;
+               }
+           }
+           if (counted > 0) {
+               summary.counters[PerformanceCounters::Key(event)] = total / static_cast<long double>(counted);
+           }
+       }
    }
 };
 
@@ -14,6 +14,10 @@
 #define NE591_008_PROFILERHELPER_H
 
 #include "CheckBounds.h"
+#include "MemorySampler.h"
+#include "PerformanceCounters.h"
+#include "Sampling.h"
+#include "Zones.h"
 #include "json.hpp"
 #include <boost/program_options.hpp>
 
@@ -33,7 +37,13 @@ static boost::program_options::options_description buildCommandlineOptions() {
     boost::program_options::options_description profiler("Performance Benchmarking");
     profiler.add_options()
     ("bench-runs,R", boost::program_options::value<long double>()->default_value(1), "= <R> runs to perform")
-    ("bench-timeout,T", boost::program_options::value<long double>()->default_value(0), "= Timeout after <T> seconds [0=never]");
+    ("bench-timeout,T", boost::program_options::value<long double>()->default_value(0), "= Timeout after <T> seconds [0=never]")
+    ("bench-warmup", boost::program_options::value<long double>()->default_value(0), "= <W> untimed runs before the timed ones")
+    ("bench-target-ci", boost::program_options::value<long double>()->default_value(0), "= Run until the 95% CI of the mean is within <C>% of it [0=off]")
+    ("bench-max-runs", boost::program_options::value<long double>()->default_value(1000), "= At most <M> runs with --bench-target-ci")
+    ("bench-no-counters", "= Do not read the hardware performance counters")
+    ("bench-memory-interval", boost::program_options::value<long double>()->default_value(10), "= Sample the memory every <ms> milliseconds [0=never]")
+    ("bench-trace", boost::program_options::value<std::string>(), "= Write the solver zones as a Chrome trace to <file>");
     return profiler;
 }
 
@@ -54,6 +64,57 @@ static void validateOptions(boost::program_options::variables_map &map) {
     checks.clear();
     checks.emplace_back([](long double value) { return failsNonNegativeNumberCheck(value); });
     performChecksAndUpdateInput<long double>("bench-timeout", inputMap, map, checks);
+    performChecksAndUpdateInput<long double>("bench-memory-interval", inputMap, map, checks);
+    performChecksAndUpdateInput<long double>("bench-warmup", inputMap, map, checks);
+    performChecksAndUpdateInput<long double>("bench-target-ci", inputMap, map, checks);
+    checks.clear();
+    checks.emplace_back([](long double value) { return failsNaturalNumberCheck(value); });
+    performChecksAndUpdateInput<long double>("bench-max-runs", inputMap, map, checks);
+}
+
+/**
+* @brief This function turns the performance counters of every profiler on or off, from --bench-no-counters.
+* @param map A boost::program_options::variables_map object containing the command line options.
+ */
+static void configureCounters(const boost::program_options::variables_map &map) {
+    PerformanceCounters::enabled() = !map.count("bench-no-counters");
+}
+
+/**
+* @brief This function sets the interval of the memory sampler of every profiler, from --bench-memory-interval.
+* @param map A boost::program_options::variables_map object containing the command line options.
+ */
+static void configureMemorySampler(const boost::program_options::variables_map &map) {
+    MemorySampler::interval() = map["bench-memory-interval"].as<long double>();
+}
+
+/**
+* @brief This function sets the warmup and stopping rule of every profiler, from --bench-warmup, --bench-target-ci and
+* --bench-max-runs. The target is given in percent of the mean.
+* @param map A boost::program_options::variables_map object containing the command line options.
+ */
+static void configureSampling(const boost::program_options::variables_map &map) {
+    auto &sampling = Sampling::defaults();
+    sampling.warmup = static_cast<size_t>(map["bench-warmup"].as<long double>());
+    sampling.targetHalfWidth = map["bench-target-ci"].as<long double>() / 100;
+    sampling.maxRuns = static_cast<size_t>(map["bench-max-runs"].as<long double>());
+}
+
+/**
+* @brief This function sets the file the profiler zones are traced to, from --bench-trace.
+* @details The zones are only recorded when the project is configured with -DENABLE_PROFILER_ZONES=ON, so the option
+* only warns otherwise.
+* @param map A boost::program_options::variables_map object containing the command line options.
+ */
+static void configureTrace(const boost::program_options::variables_map &map) {
+    if (!map.count("bench-trace")) {
+        return;
+    }
+#if defined(ENABLE_PROFILER_ZONES)
+    Zones::Registry::instance().setTracePath(map["bench-trace"].as<std::string>());
+#else
+    std::cerr << "Warning: --bench-trace has no effect, reconfigure with -DENABLE_PROFILER_ZONES=ON to record zones.\n";
+#endif
 }
 
 /**
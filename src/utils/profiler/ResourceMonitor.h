@@ -3,59 +3,201 @@
 * @brief Header file for the ResourceMonitor class.
 * @author Arjun Earthperson
 * @date 10/20/2023
+* @details The monitors count the live instances of each container type, and the heap bytes their storage holds. The
+* instance counts are kept per thread, so constructing a temporary inside an OpenMP region costs one uncontended
+* increment, and are only summed when they are read. The bytes are recorded when storage is allocated or released, and
+* also added to a process-wide total, whose peak is what the Profiler reports. The resident set size of the process,
+* read from /proc/self/status, is available next to it as a check on what the monitors do not see.
 */
 
 #ifndef NE591_008_RESOURCE_MONITOR_H
 #define NE591_008_RESOURCE_MONITOR_H
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
-#include <unordered_set>
-#include <unordered_map>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Resources
+ * @brief This namespace contains the counters shared by every ResourceMonitor, and the resident memory of the process.
+ */
+namespace Resources {
+
+/**
+ * @class Bytes
+ * @brief A count of held bytes and its peak, safe to update from any thread.
+ */
+class Bytes {
+  public:
+    void allocate(const size_t bytes) {
+        const size_t held = _current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = _peak.load(std::memory_order_relaxed);
+        while (held > peak && !_peak.compare_exchange_weak(peak, held, std::memory_order_relaxed)) {
+        }
+    }
+
+    void deallocate(const size_t bytes) { _current.fetch_sub(bytes, std::memory_order_relaxed); }
+
+    /**
+     * @brief Restarts the peak from the bytes held now.
+     */
+    void clear() { _peak.store(_current.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+    [[nodiscard]] size_t current() const { return _current.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t peak() const { return _peak.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<size_t> _current{0};
+    std::atomic<size_t> _peak{0};
+};
+
+/**
+ * @brief The bytes held by every monitored container, of every type.
+ */
+inline Bytes &total() {
+    // never destroyed, since containers with static storage may still release their bytes during exit
+    static auto *bytes = new Bytes();
+    return *bytes;
+}
+
+/**
+ * @brief Reads a field of /proc/self/status, which the kernel reports in kB.
+ * @return The field in bytes, or 0 where it is unavailable.
+ */
+inline size_t readStatus(const std::string &field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(field + ":", 0) == 0) {
+            return static_cast<size_t>(std::stoull(line.substr(field.size() + 1))) * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief The resident set size of the process, in bytes.
+ */
+inline size_t residentBytes() { return readStatus("VmRSS"); }
+
+/**
+ * @brief The peak resident set size of the process, in bytes, since it started or since resetPeakResidentBytes().
+ */
+inline size_t peakResidentBytes() { return readStatus("VmHWM"); }
+
+/**
+ * @brief Restarts the peak resident set size from the current one.
+ * @return False if the kernel does not allow it, in which case the peak covers the whole process.
+ */
+inline bool resetPeakResidentBytes() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    return static_cast<bool>(clearRefs.flush());
+}
+
+} // namespace Resources
 
 /**
  * @brief Singleton class that monitors resource instances.
  *
- * This class is used to keep track of instances of type T and record the maximum number of instances
- * that have ever been created at any point in time.
+ * This class counts the live instances of type T, and the heap bytes that they hold. The containers call
+ * registerInstance() from every constructor and unregisterInstance() from their destructor. Their storage reports its
+ * allocations through recordAllocation() and recordDeallocation(), either directly, as the AlignedBuffer of the dense
+ * matrices does, or through an Allocation member that follows the capacity of a std::vector.
  *
  * @tparam T The type of resource to monitor.
  */
 template <typename T>
 class ResourceMonitor {
  private:
-   static ResourceMonitor<T>* monitor;
-   std::unordered_map<T*, size_t> maxInstanceSizes; ///< Map to keep track of instances.
+   /**
+    * @brief The counters of one thread. Only that thread writes to them, so they are never contended, and they are on
+    * their own cache line, so they are not falsely shared either.
+    */
+   struct alignas(64) Slot {
+       std::atomic<size_t> constructed{0};
+       std::atomic<size_t> destroyed{0};
+       std::atomic<size_t> allocations{0};
+   };
+
+   std::mutex _mutex;
+   std::vector<std::unique_ptr<Slot>> _slots; ///< The counters of every thread that has touched a T.
+   Resources::Bytes _bytes; ///< The bytes held by the instances of T.
+   size_t _allocationsAtClear = 0;
 
    /**
     * @brief Private constructor for the Singleton pattern.
     */
-   ResourceMonitor() {
+   ResourceMonitor() = default;
 
+   /**
+    * @brief The counters of the calling thread, registered the first time it touches a T.
+    */
+   static Slot &local() {
+       thread_local Slot *slot = nullptr;
+       if (slot == nullptr) {
+           auto &monitor = getInstance();
+           const std::lock_guard<std::mutex> lock(monitor._mutex);
+           monitor._slots.push_back(std::make_unique<Slot>());
+           slot = monitor._slots.back().get();
+       }
+       return *slot;
    }
 
-   void checkAndUpdateMaxSize(T* instance) {
-       if (instance == nullptr) {
-           return;
-       }
-       const size_t newSize = instance->getAllocatedBytes();
-       auto it = maxInstanceSizes.find(instance);
-       if (it != maxInstanceSizes.end()) {
-           // Key exists in the map, check if the current size is greater than the stored value
-           size_t currentSize = newSize;
-           if (currentSize > it->second) {
-               // Update the value in the map
-               it->second = currentSize;
-           }
-       } else {
-           // Key does not exist in the map, you might want to handle this case as well
-           // For example, you could insert the current size of the instance into the map
-           maxInstanceSizes[instance] = newSize;
+   template <typename Function>
+   static size_t sum(Function &&field) {
+       auto &monitor = getInstance();
+       const std::lock_guard<std::mutex> lock(monitor._mutex);
+       size_t total = 0;
+       for (const auto &slot : monitor._slots) {
+           total += field(*slot).load(std::memory_order_relaxed);
        }
+       return total;
    }
 
  public:
 
+   /**
+    * @class Allocation
+    * @brief The bytes held by one instance whose storage does not report its own allocations, such as a std::vector.
+    * @details The owner calls update() with its heap bytes after every construction or assignment, and the change is
+    * recorded. Storage that grows in between, e.g. through a mutable reference to the std::vector, is caught up at the
+    * next update, or released at destruction. A copy starts out holding nothing, while a move takes the bytes along.
+    */
+   class Allocation {
+     public:
+       Allocation() = default;
+       Allocation(const Allocation &) {}
+       Allocation(Allocation &&other) noexcept : _bytes(std::exchange(other._bytes, 0)) {}
+       Allocation &operator=(const Allocation &) { return *this; }
+       Allocation &operator=(Allocation &&other) noexcept {
+           if (this != &other) {
+               update(0);
+               _bytes = std::exchange(other._bytes, 0);
+           }
+           return *this;
+       }
+       ~Allocation() { update(0); }
+
+       void update(const size_t bytes) {
+           if (bytes > _bytes) {
+               recordAllocation(bytes - _bytes);
+           } else if (bytes < _bytes) {
+               recordDeallocation(_bytes - bytes);
+           }
+           _bytes = bytes;
+       }
+
+     private:
+       size_t _bytes = 0;
+   };
+
    /**
     * @brief Deleted assignment operator to prevent copying.
     */
@@ -69,54 +211,89 @@ class ResourceMonitor {
    /**
     * @brief Method to register a new instance.
     *
-    * Inserts the instance into the set and updates the maximum instances ever if necessary.
+    * Counts the instance as live, on the counters of the calling thread.
     *
     * @param instance Pointer to the instance to register.
     */
    static void registerInstance(T* instance) {
-       getInstance().checkAndUpdateMaxSize(instance);
+       local().constructed.fetch_add(1, std::memory_order_relaxed);
    }
 
-   // TODO:: DOCUMENT
+   /**
+    * @brief Returns the monitor of type T. It is never destroyed, so that instances with static storage can still
+    * unregister during exit.
+    */
    static ResourceMonitor<T>& getInstance() {
-       if (!monitor) {
-           monitor = new ResourceMonitor<T>();
-       }
+       static auto *monitor = new ResourceMonitor<T>();
        return *monitor;
    }
 
+   /**
+    * @brief Restarts the peak bytes and the allocation count. The live instances and held bytes are kept.
+    */
    static void clear() {
-       getInstance().maxInstanceSizes.clear();
+       getInstance()._bytes.clear();
+       getInstance()._allocationsAtClear = sum([](Slot &slot) -> auto & { return slot.allocations; });
    }
 
    /**
     * @brief Method to unregister an instance.
     *
-    * Erases the instance from the set.
+    * Counts the instance as destroyed, on the counters of the calling thread.
     *
     * @param instance Pointer to the instance to unregister.
     */
    static void unregisterInstance(T* instance) {
-       getInstance().checkAndUpdateMaxSize(instance);
+       local().destroyed.fetch_add(1, std::memory_order_relaxed);
+   }
+
+   /**
+    * @brief Records bytes allocated by an instance of T, here and in the process-wide total.
+    */
+   static void recordAllocation(const size_t bytes) {
+       local().allocations.fetch_add(1, std::memory_order_relaxed);
+       getInstance()._bytes.allocate(bytes);
+       Resources::total().allocate(bytes);
+   }
+
+   /**
+    * @brief Records bytes released by an instance of T, here and in the process-wide total.
+    */
+   static void recordDeallocation(const size_t bytes) {
+       getInstance()._bytes.deallocate(bytes);
+       Resources::total().deallocate(bytes);
    }
 
-   // TODO Document.
+   /**
+    * @brief The most bytes the instances of T have held at once, since the last clear().
+    */
    [[nodiscard]] static size_t getMaxBytesEver() {
-       size_t sum = 0;
-       for (const auto& pair : getInstance().maxInstanceSizes) {
-           sum += pair.second;
-       }
-       return sum;
+       return getInstance()._bytes.peak();
    }
 
-   [[nodiscard]] static size_t getCurrentInstanceCount() {
-       return getInstance().maxInstanceSizes.size();
+   /**
+    * @brief The bytes the instances of T hold now.
+    */
+   [[nodiscard]] static size_t getCurrentBytes() {
+       return getInstance()._bytes.current();
    }
 
-};
+   /**
+    * @brief The number of allocations by instances of T since the last clear().
+    */
+   [[nodiscard]] static size_t getAllocationCount() {
+       return sum([](Slot &slot) -> auto & { return slot.allocations; }) - getInstance()._allocationsAtClear;
+   }
 
-template <typename T>
-ResourceMonitor<T>* ResourceMonitor<T>::monitor = nullptr;
+   /**
+    * @brief The number of live instances of T.
+    */
+   [[nodiscard]] static size_t getCurrentInstanceCount() {
+       const size_t constructed = sum([](Slot &slot) -> auto & { return slot.constructed; });
+       const size_t destroyed = sum([](Slot &slot) -> auto & { return slot.destroyed; });
+       return constructed > destroyed ? constructed - destroyed : 0;
+   }
 
+};
 
 #endif //NE591_008_RESOURCE_MONITOR_H
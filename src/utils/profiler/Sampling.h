@@ -0,0 +1,43 @@
+/**
+* @file Sampling.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief This file contains the Sampling settings, which decide how many runs the Profiler times and how it summarizes
+* them.
+* @details By default the Profiler times the requested number of runs. With a target half-width, it keeps timing runs
+* until the confidence interval of the mean is that narrow relative to the mean, or the maximum number of runs or the
+* timeout is reached, so that noisy functions get more runs and steady ones fewer.
+*/
+
+#ifndef NE591_008_SAMPLING_H
+#define NE591_008_SAMPLING_H
+
+#include <cstddef>
+
+/**
+ * @struct Sampling
+ * @brief The warmup, stopping rule and confidence intervals of a Profiler.
+ */
+struct Sampling {
+    size_t warmup = 0; ///< Untimed runs before the timed ones, to fill the caches and fault in the memory.
+    long double targetHalfWidth = 0; ///< The relative half-width of the CI of the mean to stop at, or 0 to run a fixed count.
+    size_t maxRuns = 1000; ///< The most runs the adaptive mode times.
+    long double confidence = 0.95; ///< The confidence level of the intervals.
+    size_t resamples = 2000; ///< The bootstrap resamples behind the intervals of the median and the mean.
+
+    /**
+     * @brief The fewest runs the adaptive mode times, since a t interval over fewer runs is too wide, and too
+     * uncertain itself, to stop on.
+     */
+    static constexpr size_t MinimumAdaptiveRuns = 5;
+
+    /**
+     * @brief The process-wide settings, set from the --bench-* options, which every Profiler copies when constructed.
+     */
+    static Sampling &defaults() {
+        static Sampling sampling;
+        return sampling;
+    }
+};
+
+#endif // NE591_008_SAMPLING_H
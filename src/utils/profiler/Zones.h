@@ -0,0 +1,300 @@
+/**
+* @file Zones.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief This file contains the scoped timing zones, which time the phases inside a profiled function.
+* @details A zone is opened with PROFILE_ZONE("name") and closed at the end of the enclosing scope. Each thread appends
+* its closed zones to its own ring buffer, so recording takes no lock, and costs two clock reads and a store. The
+* Profiler collects the buffers after each run, aggregates the zones into a table, and optionally writes them as a
+* Chrome trace, which opens in chrome://tracing and ui.perfetto.dev.
+*
+* The zones are compiled out unless the project is configured with -DENABLE_PROFILER_ZONES=ON. Otherwise the macros
+* expand to nothing, and the solvers run exactly as before.
+*/
+
+#ifndef NE591_008_ZONES_H
+#define NE591_008_ZONES_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/json.hpp"
+
+#define NE591_ZONE_CONCATENATE_DETAIL(a, b) a##b
+#define NE591_ZONE_CONCATENATE(a, b) NE591_ZONE_CONCATENATE_DETAIL(a, b)
+
+#if defined(ENABLE_PROFILER_ZONES)
+/**
+ * @brief Times the rest of the enclosing scope as a zone with the given name, which must outlive the profiled run.
+ */
+#define PROFILE_ZONE(name) const Zones::Scope NE591_ZONE_CONCATENATE(profile_zone_, __LINE__)(name)
+/**
+ * @brief Opens a zone that is closed by PROFILE_ZONE_STOP(variable), or else at the end of the enclosing scope. This
+ * times statements, such as declarations, whose results must outlive the zone.
+ */
+#define PROFILE_ZONE_NAMED(variable, name) Zones::Scope variable(name)
+#define PROFILE_ZONE_STOP(variable) variable.stop()
+#else
+#define PROFILE_ZONE(name) static_cast<void>(0)
+#define PROFILE_ZONE_NAMED(variable, name) static_cast<void>(0)
+#define PROFILE_ZONE_STOP(variable) static_cast<void>(0)
+#endif
+
+/**
+ * @namespace Zones
+ * @brief This namespace contains the per-thread zone recorder, and the aggregation and export of the recorded zones.
+ */
+namespace Zones {
+
+/**
+ * @brief The number of zones each thread keeps. Once a buffer is full, its oldest zones are overwritten.
+ */
+constexpr size_t RingCapacity = 1 << 16;
+
+/**
+ * @brief A closed zone, with its start and end in nanoseconds on the steady clock.
+ */
+struct Record {
+    const char *name = nullptr;
+    std::int64_t begin = 0;
+    std::int64_t end = 0;
+};
+
+/**
+ * @brief The totals of one zone name, over every thread and every time it was entered.
+ */
+struct Aggregate {
+    size_t count = 0;
+    long double total = 0; ///< Nanoseconds.
+    long double min = 0;
+    long double max = 0;
+};
+
+/**
+ * @brief A closed zone with its thread, as collected from the ring buffers.
+ */
+struct Event {
+    std::string name;
+    size_t thread = 0;
+    std::int64_t begin = 0;
+    std::int64_t end = 0;
+};
+
+/**
+ * @brief Nanoseconds on the steady clock.
+ */
+inline std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @class Ring
+ * @brief The zones recorded by one thread. Only that thread writes to it.
+ */
+class Ring {
+  public:
+    explicit Ring(const size_t thread) : _thread(thread), _records(RingCapacity) {}
+
+    void push(const Record &record) {
+        _records[_written % RingCapacity] = record;
+        _written++;
+    }
+
+    /**
+     * @brief Appends the recorded zones, oldest first, to events, and empties the ring.
+     * @return The number of zones that were overwritten before they could be collected.
+     */
+    size_t drain(std::vector<Event> &events) {
+        const size_t kept = std::min(_written, RingCapacity);
+        for (size_t k = _written - kept; k < _written; k++) {
+            const auto &record = _records[k % RingCapacity];
+            events.push_back({record.name, _thread, record.begin, record.end});
+        }
+        const size_t dropped = _written - kept;
+        _written = 0;
+        return dropped;
+    }
+
+    void clear() { _written = 0; }
+
+  private:
+    size_t _thread;
+    size_t _written = 0;
+    std::vector<Record> _records;
+};
+
+/**
+ * @class Registry
+ * @brief Owns the ring of every thread that has recorded a zone, and the Chrome trace accumulated so far.
+ * @details The rings outlive their threads, since OpenMP keeps its pool threads alive between parallel regions, and
+ * are only read or cleared between profiled runs, when no zone is being recorded.
+ */
+class Registry {
+  public:
+    static Registry &instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    /**
+     * @brief The ring of the calling thread, registered on its first zone.
+     */
+    Ring &local() {
+        thread_local Ring *ring = nullptr;
+        if (ring == nullptr) {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            _rings.push_back(std::make_unique<Ring>(_rings.size()));
+            ring = _rings.back().get();
+        }
+        return *ring;
+    }
+
+    /**
+     * @brief Discards the zones recorded so far.
+     */
+    void clear() {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        for (auto &ring : _rings) {
+            ring->clear();
+        }
+    }
+
+    /**
+     * @brief Empties the rings of every thread.
+     * @return The zones recorded since the last collection or clear, grouped by thread.
+     */
+    std::vector<Event> collect() {
+        std::vector<Event> events;
+        size_t dropped = 0;
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            for (auto &ring : _rings) {
+                dropped += ring->drain(events);
+            }
+        }
+        if (dropped > 0) {
+            std::cerr << "Warning: " << dropped << " profiler zones were overwritten, the oldest zones of a run are "
+                      << "missing from its trace.\n";
+        }
+        return events;
+    }
+
+    /**
+     * @brief Sets the file the Chrome trace is written to, from --bench-trace. Nothing is written if it is empty.
+     */
+    void setTracePath(std::string path) { _tracePath = std::move(path); }
+
+    /**
+     * @brief Appends the events of a run to the trace, and rewrites the trace file, so that it always holds every
+     * profiled run of the process so far.
+     */
+    void trace(const std::vector<Event> &events) {
+        if (_tracePath.empty()) {
+            return;
+        }
+        for (const auto &event : events) {
+            // complete events, with the timestamp and duration in microseconds
+            _trace.push_back({
+                {"name", event.name},
+                {"ph", "X"},
+                {"pid", 0},
+                {"tid", event.thread},
+                {"ts", static_cast<long double>(event.begin) / 1e3L},
+                {"dur", static_cast<long double>(event.end - event.begin) / 1e3L},
+            });
+        }
+        std::ofstream file(_tracePath);
+        if (!file) {
+            std::cerr << "Error: Unable to write the profiler trace to " << _tracePath << "\n";
+            return;
+        }
+        file << nlohmann::json{{"traceEvents", _trace}, {"displayTimeUnit", "ns"}};
+    }
+
+  private:
+    Registry() = default;
+
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Ring>> _rings;
+    std::string _tracePath;
+    nlohmann::json _trace = nlohmann::json::array();
+};
+
+/**
+ * @brief Totals the zones by name.
+ */
+inline std::map<std::string, Aggregate> aggregate(const std::vector<Event> &events) {
+    std::map<std::string, Aggregate> totals;
+    for (const auto &event : events) {
+        const auto duration = static_cast<long double>(event.end - event.begin);
+        auto &total = totals[event.name];
+        total.min = total.count ? std::min(total.min, duration) : duration;
+        total.max = total.count ? std::max(total.max, duration) : duration;
+        total.total += duration;
+        total.count++;
+    }
+    return totals;
+}
+
+/**
+ * @brief Prints the totals as a table, sorted by total time.
+ */
+inline void print(std::ostream &os, const std::map<std::string, Aggregate> &totals) {
+    std::vector<std::pair<std::string, Aggregate>> rows(totals.begin(), totals.end());
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.second.total > b.second.total; });
+    size_t width = 4;
+    for (const auto &row : rows) {
+        width = std::max(width, row.first.size());
+    }
+    const auto precision = os.precision();
+    os << std::left << std::setw(static_cast<int>(width)) << "ZONE" << std::right << std::setw(10) << "COUNT"
+       << std::setw(12) << "TOTAL" << std::setw(12) << "MEAN" << std::setw(12) << "MIN" << std::setw(12) << "MAX"
+       << "  [ns]\n";
+    os << std::setprecision(2) << std::scientific;
+    for (const auto &[name, total] : rows) {
+        os << std::left << std::setw(static_cast<int>(width)) << name << std::right << std::setw(10) << total.count
+           << std::setw(12) << total.total << std::setw(12) << total.total / static_cast<long double>(total.count)
+           << std::setw(12) << total.min << std::setw(12) << total.max << "\n";
+    }
+    os << std::setprecision(static_cast<int>(precision)) << std::defaultfloat;
+}
+
+/**
+ * @class Scope
+ * @brief Records the time from its construction to its destruction as a zone of the calling thread.
+ */
+class Scope {
+  public:
+    explicit Scope(const char *name) : _name(name), _begin(now()) {}
+    ~Scope() { stop(); }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    /**
+     * @brief Closes the zone before the end of its scope. Only the first call records it.
+     */
+    void stop() {
+        if (_name != nullptr) {
+            Registry::instance().local().push({_name, _begin, now()});
+            _name = nullptr;
+        }
+    }
+
+  private:
+    const char *_name;
+    std::int64_t _begin;
+};
+
+} // namespace Zones
+
+#endif // NE591_008_ZONES_H
@@ -0,0 +1,70 @@
+/**
+* @file DiffusionTestProblems.h
+* @author Arjun Earthperson
+* @date 10/17/2026
+* @brief Diffusion test problems and convergence thresholds shared by the test suites of the utils modules.
+*/
+
+#ifndef NE591_008_DIFFUSIONTESTPROBLEMS_H
+#define NE591_008_DIFFUSIONTESTPROBLEMS_H
+
+#include "math/blas/matrix/Matrix.h"
+#include "math/blas/vector/Vector.h"
+#include "physics/diffusion/DiffusionParams.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace TestProblems {
+
+/**
+ * @brief A 2 x 3 slab with unit diffusion coefficient on a rows x cols mesh. With the default, weak removal cross
+ * section, the diffusion matrix is poorly conditioned, which makes the iterative solvers work for their convergence.
+ */
+template <typename T>
+MyPhysics::Diffusion::Params<T> makeParams(const size_t rows, const size_t cols, const T removal = static_cast<T>(0.1)) {
+    MyPhysics::Diffusion::Params<T> params;
+    params.setA(2).setB(3).setM(rows).setN(cols).setDiffusionCoefficient(1).setMacroscopicRemovalCrossSection(removal);
+    return params;
+}
+
+/**
+ * @brief Returns the positive vector 1 + (i % period) / scale, whose neighboring entries differ, so that misplaced
+ * neighbors show up in products.
+ */
+template <typename T>
+MyBLAS::Vector<T> makeSources(const size_t size, const size_t period = 5, const T scale = 4) {
+    return MyBLAS::Vector<T>(size, [period, scale](size_t i) { return static_cast<T>(1) + static_cast<T>(i % period) / scale; });
+}
+
+/**
+ * @brief The five-point Laplacian on a rows x cols mesh, with node (i, j) at index i * cols + j. A diagonal above 4
+ * shifts it away from singularity in the interior.
+ */
+template <typename T>
+MyBLAS::Matrix<T> makeLaplacian(const size_t rows, const size_t cols, const T diagonal = 4) {
+    const size_t size = rows * cols;
+    return MyBLAS::Matrix<T>(size, size, [cols, diagonal](size_t p, size_t q) -> T {
+        if (p == q) {
+            return diagonal;
+        }
+        const bool sameRow = (p / cols == q / cols);
+        const bool horizontal = sameRow && (p == q + 1 || q == p + 1);
+        const bool vertical = (p == q + cols || q == p + cols);
+        return (horizontal || vertical) ? -1 : 0;
+    });
+}
+
+/**
+ * @brief The convergence threshold of the iterative solvers, relative to the norm of the right hand side, since the
+ * residual cannot get much below eps * |A| * |x| in single precision.
+ */
+template <typename T>
+T threshold(const MyBLAS::Vector<T> &b) {
+    return std::sqrt(std::numeric_limits<T>::epsilon() * (b * b));
+}
+
+} // namespace TestProblems
+
+#endif // NE591_008_DIFFUSIONTESTPROBLEMS_H